@@ -26,7 +26,7 @@
 #include "iceoryx_binding_c/types.h"
 #include "iceoryx_binding_c/user_trigger.h"
 
-typedef CLASS Listener* iox_listener_t;
+typedef CLASS cpp2c_Listener* iox_listener_t;
 
 
 /// @brief initializes a listener struct from a storage struct pointer
@@ -69,6 +69,27 @@ uint64_t iox_ws_wait(iox_ws_t const self,
                      const uint64_t notificationInfoArrayCapacity,
                      uint64_t* missedElements);
 
+/// @brief returns the events which occurred without blocking and rearms the readiness file descriptor
+/// @param[in] self handle to the wait set
+/// @param[in] notificationInfoArray preallocated memory to an array of iox_notification_info_t in which
+///             the notification infos, which are describing the occurred event, can be written to
+/// @param[in] notificationInfoArrayCapacity the capacity of the preallocated notificationInfoArray
+/// @param[in] missedElements if the notificationInfoArray has insufficient size the number of missed elements
+///             which could not be written into the array are stored here
+/// @return number of elements which were written into the notificationInfoArray
+uint64_t iox_ws_try_wait(iox_ws_t const self,
+                         iox_notification_info_t* const notificationInfoArray,
+                         const uint64_t notificationInfoArrayCapacity,
+                         uint64_t* missedElements);
+
+/// @brief acquires a file descriptor which becomes readable when the wait set is notified, e.g. to register
+///        it in an epoll based event loop. When it is readable iox_ws_try_wait() returns the occurred events
+///        and rearms the file descriptor. The file descriptor is owned by the wait set and must not be closed.
+/// @param[in] self handle to the wait set
+/// @param[in] fileDescriptor pointer to the memory where the file descriptor is stored
+/// @return WaitSetResult_SUCCESS if the file descriptor is available, otherwise WaitSetResult_READINESS_FD_UNAVAILABLE
+ENUM iox_WaitSetResult iox_ws_get_readiness_fd(iox_ws_t const self, int* const fileDescriptor);
+
 /// @brief returns the number of registered events/states
 uint64_t iox_ws_size(iox_ws_t const self);
 
@@ -16,6 +16,7 @@
 
 #include "iceoryx_binding_c/internal/c2cpp_enum_translation.hpp"
 #include "iceoryx_binding_c/internal/cpp2c_enum_translation.hpp"
+#include "iceoryx_binding_c/internal/cpp2c_listener.hpp"
 #include "iceoryx_binding_c/internal/cpp2c_subscriber.hpp"
 #include "iceoryx_posh/popo/listener.hpp"
 #include "iceoryx_posh/popo/untyped_client.hpp"
@@ -37,7 +38,7 @@ iox_listener_t iox_listener_init(iox_listener_storage_t* self)
 {
     IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
 
-    auto* me = new Listener();
+    auto* me = new cpp2c_Listener();
     self->do_not_touch_me[0] = reinterpret_cast<uint64_t>(me);
     return me;
 }
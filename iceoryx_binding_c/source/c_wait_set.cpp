@@ -105,6 +105,33 @@ uint64_t iox_ws_wait(iox_ws_t const self,
         self->wait(), notificationInfoArray, notificationInfoArrayCapacity, missedElements);
 }
 
+uint64_t iox_ws_try_wait(iox_ws_t const self,
+                         iox_notification_info_t* const notificationInfoArray,
+                         const uint64_t notificationInfoArrayCapacity,
+                         uint64_t* missedElements)
+{
+    IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
+    IOX_ENFORCE(missedElements != nullptr, "'missedElements' must not be a 'nullptr'");
+
+    return notification_info_vector_to_c_array(
+        self->tryWait(), notificationInfoArray, notificationInfoArrayCapacity, missedElements);
+}
+
+iox_WaitSetResult iox_ws_get_readiness_fd(iox_ws_t const self, int* const fileDescriptor)
+{
+    IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
+    IOX_ENFORCE(fileDescriptor != nullptr, "'fileDescriptor' must not be a 'nullptr'");
+
+    auto result = self->getReadinessFileDescriptor();
+    if (result.has_error())
+    {
+        return cpp2c::waitSetResult(result.error());
+    }
+
+    *fileDescriptor = result.value();
+    return iox_WaitSetResult::WaitSetResult_SUCCESS;
+}
+
 uint64_t iox_ws_size(iox_ws_t const self)
 {
     IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
@@ -172,7 +172,7 @@ TEST_F(iox_service_discovery_test, FindServiceWithNullptrsForServiceInstanceEven
                                                                         &missedServices,
                                                                         MessagingPattern_PUB_SUB);
 
-    EXPECT_THAT(numberFoundServices, Eq(6U));
+    EXPECT_THAT(numberFoundServices, Eq(8U));
     EXPECT_THAT(missedServices, Eq(0U));
     for (uint64_t i = 0U; i < numberFoundServices; ++i)
     {
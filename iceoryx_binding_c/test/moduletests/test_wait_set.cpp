@@ -459,6 +459,48 @@ TEST_F(iox_ws_test, TimedWaitNumberOfTriggeredConditionsIsCorrectWhenAllWereTrig
               MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET);
 }
 
+TEST_F(iox_ws_test, TryWaitNumberOfTriggeredConditionsIsZeroWhenNothingWasTriggered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4b6359bb-2470-47d5-8cd1-f1fe1a9a9588");
+    iox_ws_attach_user_trigger_event(m_sut, m_userTrigger[0U], 0U, userTriggerCallback);
+
+    EXPECT_EQ(iox_ws_try_wait(m_sut, m_eventInfoStorage, MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET, &m_missedElements),
+              0U);
+}
+
+TEST_F(iox_ws_test, TryWaitNumberOfTriggeredConditionsIsCorrectWhenMultipleWereTriggered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "34449d1f-4486-44c9-ae93-2ce6e05d9704");
+    for (uint64_t i = 0U; i < 10U; ++i)
+    {
+        iox_ws_attach_user_trigger_event(m_sut, m_userTrigger[i], 0U, userTriggerCallback);
+        iox_user_trigger_trigger(m_userTrigger[i]);
+    }
+
+    EXPECT_EQ(iox_ws_try_wait(m_sut, m_eventInfoStorage, MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET, &m_missedElements),
+              10U);
+}
+
+TEST_F(iox_ws_test, GetReadinessFdProvidesValidFileDescriptor)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "55f8e291-3340-4afb-87fb-723f53aebbcc");
+    int fileDescriptor{-1};
+
+    EXPECT_EQ(iox_ws_get_readiness_fd(m_sut, &fileDescriptor), WaitSetResult_SUCCESS);
+    EXPECT_THAT(fileDescriptor, Ge(0));
+}
+
+TEST_F(iox_ws_test, GetReadinessFdProvidesSameFileDescriptorOnConsecutiveCalls)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e12d9649-120e-4869-8b6f-8496d76678b8");
+    int firstFileDescriptor{-1};
+    int secondFileDescriptor{-1};
+
+    ASSERT_EQ(iox_ws_get_readiness_fd(m_sut, &firstFileDescriptor), WaitSetResult_SUCCESS);
+    ASSERT_EQ(iox_ws_get_readiness_fd(m_sut, &secondFileDescriptor), WaitSetResult_SUCCESS);
+    EXPECT_THAT(firstFileDescriptor, Eq(secondFileDescriptor));
+}
+
 TEST_F(iox_ws_test, SingleTriggerCaseTimedWaitReturnsCorrectTrigger)
 {
     ::testing::Test::RecordProperty("TEST_ID", "6fae144f-056b-4ac6-a849-3cd47135e2db");
@@ -588,6 +630,21 @@ TEST_F(iox_ws_test, WaitSetWaitWithNullptrFails)
     IOX_EXPECT_FATAL_FAILURE([&] { iox_ws_wait(nullptr, NULL, 0U, nullptr); }, iox::er::ENFORCE_VIOLATION);
 }
 
+TEST_F(iox_ws_test, WaitSetTryWaitWithNullptrFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e85bec26-a68b-4827-b9b8-1442e326383e");
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_ws_try_wait(m_sut, NULL, 0U, nullptr); }, iox::er::ENFORCE_VIOLATION);
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_ws_try_wait(nullptr, NULL, 0U, nullptr); }, iox::er::ENFORCE_VIOLATION);
+}
+
+TEST_F(iox_ws_test, WaitSetGetReadinessFdWithNullptrFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d0308603-2b23-4b7b-af71-49fe1ac1f407");
+    int fileDescriptor{-1};
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_ws_get_readiness_fd(m_sut, nullptr); }, iox::er::ENFORCE_VIOLATION);
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_ws_get_readiness_fd(nullptr, &fileDescriptor); }, iox::er::ENFORCE_VIOLATION);
+}
+
 TEST_F(iox_ws_test, WaitSetSizeWithNullptrFails)
 {
     ::testing::Test::RecordProperty("TEST_ID", "1f4da6e0-4912-4863-af2f-4c46d9d843fa");
@@ -1542,7 +1599,10 @@ TEST_F(iox_ws_test, AttachingServiceDiscoveryEventWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "a8be9cbd-d9b6-45a3-b34f-d58fb864d40d");
     iox_service_discovery_storage_t serviceDiscoveryStorage;
-    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _)).WillOnce(Return(&m_portDataVector[0]));
+    // the ServiceDiscovery subscribes to the registry snapshots first and then to the deltas which trigger the event
+    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _))
+        .WillOnce(Return(&m_portDataVector[1]))
+        .WillOnce(Return(&m_portDataVector[0]));
 
     iox_service_discovery_t serviceDiscovery = iox_service_discovery_init(&serviceDiscoveryStorage);
 
@@ -1561,7 +1621,9 @@ TEST_F(iox_ws_test, AttachingServiceDiscoveryEventWithContextDataWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "69515627-1590-4616-8502-975cd9256ecf");
     iox_service_discovery_storage_t serviceDiscoveryStorage;
-    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _)).WillOnce(Return(&m_portDataVector[0]));
+    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _))
+        .WillOnce(Return(&m_portDataVector[1]))
+        .WillOnce(Return(&m_portDataVector[0]));
 
     iox_service_discovery_t serviceDiscovery = iox_service_discovery_init(&serviceDiscoveryStorage);
 
@@ -1588,7 +1650,9 @@ TEST_F(iox_ws_test, NotifyingServiceDiscoveryEventWorks)
     ::testing::Test::RecordProperty("TEST_ID", "945dcf94-4679-469f-aa47-1a87d536da72");
     constexpr uint64_t EVENT_ID = 13;
     iox_service_discovery_storage_t serviceDiscoveryStorage;
-    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _)).WillOnce(Return(&m_portDataVector[0]));
+    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _))
+        .WillOnce(Return(&m_portDataVector[1]))
+        .WillOnce(Return(&m_portDataVector[0]));
 
     iox_service_discovery_t serviceDiscovery = iox_service_discovery_init(&serviceDiscoveryStorage);
 
@@ -1617,7 +1681,9 @@ TEST_F(iox_ws_test, NotifyingServiceDiscoveryEventWithContextDataWorks)
     ::testing::Test::RecordProperty("TEST_ID", "510a0351-afeb-4c0f-a4b6-3032f1f3f831");
     constexpr uint64_t EVENT_ID = 31;
     iox_service_discovery_storage_t serviceDiscoveryStorage;
-    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _)).WillOnce(Return(&m_portDataVector[0]));
+    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _))
+        .WillOnce(Return(&m_portDataVector[1]))
+        .WillOnce(Return(&m_portDataVector[0]));
 
     iox_service_discovery_t serviceDiscovery = iox_service_discovery_init(&serviceDiscoveryStorage);
     uint64_t someContextData = 0U;
@@ -23,6 +23,7 @@
 
 #include <cmath>
 #include <cstdint>
+#include <limits>
 #include <tuple>
 namespace
 {
@@ -101,6 +102,13 @@ TEST_F(convert_test, toString_Integer)
     EXPECT_THAT(iox::convert::toString(DATA), Eq("33331"));
 }
 
+TEST_F(convert_test, toString_IntegerLimits)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f27c94a1-5e08-4b3d-9c61-8a0d4e7b2f53");
+    EXPECT_THAT(iox::convert::toString(std::numeric_limits<int64_t>::min()), Eq("-9223372036854775808"));
+    EXPECT_THAT(iox::convert::toString(std::numeric_limits<uint64_t>::max()), Eq("18446744073709551615"));
+}
+
 TEST_F(convert_test, toString_Float)
 {
     ::testing::Test::RecordProperty("TEST_ID", "e00f7b9c-325c-4eb1-885c-83f8d5fa3f72");
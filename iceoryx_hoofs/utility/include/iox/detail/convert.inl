@@ -47,9 +47,18 @@ template <typename Source>
 inline typename std::enable_if<!std::is_convertible<Source, std::string>::value, std::string>::type
 convert::toString(const Source& t) noexcept
 {
-    std::stringstream ss;
-    ss << t;
-    return ss.str();
+    if constexpr (std::is_integral<Source>::value && !std::is_same<Source, bool>::value
+                  && !std::is_same<Source, char>::value)
+    {
+        // integers are the most common conversion and do not need a string stream
+        return std::to_string(t);
+    }
+    else
+    {
+        std::stringstream ss;
+        ss << t;
+        return ss.str();
+    }
 }
 
 template <typename Source>
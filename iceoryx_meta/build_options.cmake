@@ -37,6 +37,8 @@ option(TEST_WITH_ADDITIONAL_USER "Build Test with additional user accounts for t
 option(TEST_WITH_HUGE_PAYLOAD "Build Tests which use payload bigger than 2GB" OFF)
 option(TOML_CONFIG "TOML support for RouDi with dynamic configuration" ON)
 option(IOX_EXPERIMENTAL_POSH "Export experimental posh features (no guarantees)" OFF)
+option(IOX_TRACEPOINTS "Record the loan, publish, take and notify tracepoints in a ring per thread" OFF)
+option(IOX_LATENCY_STATISTICS "Stamp the chunks with the publish time and record the latency per subscriber and the chunk loan statistics per mempool" OFF)
 option(IOX_IGNORE_32_BIT_CHECK "Ignores the check for 32 bit systems! It is not recommended to turn this on in production systems" OFF)
 option(IOX_REPRODUCIBLE_BUILD "Create reproducible builds by omit setting the build timestamp in the version header" ON)
 
@@ -97,6 +99,8 @@ function(show_config_options)
   message("          TEST_WITH_HUGE_PAYLOAD ..............: " ${TEST_WITH_HUGE_PAYLOAD})
   message("          TOML_CONFIG..........................: " ${TOML_CONFIG})
   message("          IOX_EXPERIMENTAL_POSH................: " ${IOX_EXPERIMENTAL_POSH})
+  message("          IOX_TRACEPOINTS......................: " ${IOX_TRACEPOINTS})
+  message("          IOX_LATENCY_STATISTICS...............: " ${IOX_LATENCY_STATISTICS})
   message("          IOX_IGNORE_32_BIT_CHECK..............: " ${IOX_IGNORE_32_BIT_CHECK})
   message("          IOX_REPRODUCIBLE_BUILD...............: " ${IOX_REPRODUCIBLE_BUILD})
 endfunction()
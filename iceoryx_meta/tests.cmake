@@ -35,6 +35,10 @@ if (BUILD_TEST)
         list(APPEND MODULETEST_CMD COMMAND ./${cmp}/test/${cmp}_moduletests --gtest_filter=-*.TimingTest_* --gtest_output=xml:${CMAKE_BINARY_DIR}/testresults/${cmp}_ModuleTestResults.xml)
     endforeach()
 
+    if (INTROSPECTION)
+        list(APPEND MODULETEST_CMD COMMAND ./introspection/test/introspection_moduletests --gtest_filter=-*.TimingTest_* --gtest_output=xml:${CMAKE_BINARY_DIR}/testresults/introspection_ModuleTestResults.xml)
+    endif()
+
     foreach(cmp IN ITEMS ${COMPONENTS})
         list(APPEND INTEGRATIONTEST_CMD COMMAND ./${cmp}/test/${cmp}_integrationtests --gtest_filter=-*.TimingTest_* --gtest_output=xml:${CMAKE_BINARY_DIR}/testresults/${cmp}_IntegrationTestResults.xml)
     endforeach()
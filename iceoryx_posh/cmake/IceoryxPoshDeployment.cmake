@@ -144,5 +144,19 @@ else()
 endif()
 message(STATUS "[i] IOX_EXPERIMENTAL_POSH_FLAG: ${IOX_EXPERIMENTAL_POSH_FLAG}")
 
+if(IOX_TRACEPOINTS)
+     set(IOX_TRACEPOINTS_ENABLED 1)
+else()
+     set(IOX_TRACEPOINTS_ENABLED 0)
+endif()
+message(STATUS "[i] IOX_TRACEPOINTS_ENABLED: ${IOX_TRACEPOINTS_ENABLED}")
+
+if(IOX_LATENCY_STATISTICS)
+     set(IOX_LATENCY_STATISTICS_FLAG true)
+else()
+     set(IOX_LATENCY_STATISTICS_FLAG false)
+endif()
+message(STATUS "[i] IOX_LATENCY_STATISTICS_FLAG: ${IOX_LATENCY_STATISTICS_FLAG}")
+
 message(STATUS "[i] <<<<<<<<<<<<<< End iceoryx_posh configuration: >>>>>>>>>>>>>>")
 
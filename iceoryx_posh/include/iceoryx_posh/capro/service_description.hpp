@@ -110,7 +110,8 @@ class ServiceDescription
                        ClassHash m_classHash = {0U, 0U, 0U, 0U},
                        Interfaces interfaceSource = Interfaces::INTERNAL) noexcept;
 
-    /// @brief compare operator.
+    /// @brief compare operator. The precomputed hashes are compared first so that the strings are only compared when
+    ///        both ServiceDescriptions are most likely equal.
     bool operator==(const ServiceDescription& rhs) const noexcept;
 
     /// @brief negation of compare operator.
@@ -151,9 +152,16 @@ class ServiceDescription
     ClassHash getClassHash() const noexcept;
     ///@}
 
+    /// @brief Returns the 64-bit hash of the service, instance and event strings which is computed on construction.
+    ///        Equal ServiceDescriptions have equal hashes, therefore it can be used as key for hash based containers.
+    uint64_t getHash() const noexcept;
+
     /// @brief Returns the interface form where the service is coming from.
     Interfaces getSourceInterface() const noexcept;
 
+  private:
+    static uint64_t computeHash(const IdString_t& service, const IdString_t& instance, const IdString_t& event) noexcept;
+
   private:
     /// @brief string representation of the service
     IdString_t m_serviceString;
@@ -162,6 +170,9 @@ class ServiceDescription
     /// @brief string representation of the event
     IdString_t m_eventString;
 
+    /// @brief hash of the service, instance and event string; must be updated whenever one of them changes
+    uint64_t m_hash{0U};
+
     /// @brief 128-Bit class hash (32-Bit * 4)
     ClassHash m_classHash{0, 0, 0, 0};
 
@@ -172,6 +183,19 @@ class ServiceDescription
     Interfaces m_interfaceSource{Interfaces::INTERNAL};
 };
 
+/// @brief Computes the 64-bit hash of a single string with the same algorithm which is used for
+///        ServiceDescription::getHash, e.g. to index services by only one of their strings
+/// @param[in] idString the string to hash
+/// @return the hash of the string
+uint64_t hashIdString(const IdString_t& idString) noexcept;
+
+/// @brief Computes the 64-bit hash of an arbitrary string with the same algorithm as hashIdString, e.g. to index
+///        other fixed strings like the RuntimeName_t
+/// @param[in] characters of the string
+/// @param[in] size of the string without the terminating zero
+/// @return the hash of the string
+uint64_t hashString(const char* const characters, const uint64_t size) noexcept;
+
 /// @brief Compare two service descriptions via their values in member
 /// variables
 /// and return bool if match
@@ -74,8 +74,11 @@ constexpr uint32_t MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBE
 // 1x publisherPort mempool introspection
 // 1x publisherPort process introspection
 // 3x publisherPort port introspection
-constexpr uint32_t PUBLISHERS_RESERVED_FOR_INTROSPECTION = 5;
-constexpr uint32_t PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY = 1;
+// 1x publisherPort chunk ownership introspection
+constexpr uint32_t PUBLISHERS_RESERVED_FOR_INTROSPECTION = 6;
+// 1x publisherPort service registry snapshot
+// 1x publisherPort service registry delta
+constexpr uint32_t PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY = 2;
 constexpr uint32_t NUMBER_OF_INTERNAL_PUBLISHERS =
     PUBLISHERS_RESERVED_FOR_INTROSPECTION + PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY;
 /// With MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY we couple the maximum number of
@@ -111,6 +114,9 @@ constexpr uint32_t MAX_NUMBER_OF_NOTIFIERS = build::IOX_MAX_NUMBER_OF_NOTIFIERS;
 /// the variable above must be increased
 constexpr uint32_t MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET = MAX_NUMBER_OF_NOTIFIERS;
 constexpr uint32_t MAX_NUMBER_OF_EVENTS_PER_LISTENER = MAX_NUMBER_OF_NOTIFIERS;
+/// @note Timers are evaluated by the waiting thread, therefore the number of timers which can be attached to a single
+/// Waitset or Listener is kept small
+constexpr uint32_t MAX_NUMBER_OF_TIMERS_PER_CONDITION_VARIABLE = 16U;
 //--------- Communication Resources End---------------------
 
 // Memory
@@ -129,6 +135,10 @@ constexpr uint32_t ROUDI_MAX_MESSAGES = 5U;
 constexpr uint32_t ROUDI_MESSAGE_SIZE = 512U;
 constexpr uint32_t APP_MAX_MESSAGES = 5U;
 constexpr uint32_t APP_MESSAGE_SIZE = 512U;
+// the request channel is in the management segment and not restricted by the message size of the IPC channels
+constexpr uint32_t REQUEST_CHANNEL_MESSAGE_SIZE = 4096U;
+// the responses to a batched port request must fit into the request channel message, see PoshRuntime::requestPorts
+constexpr uint32_t MAX_PORT_REQUESTS_PER_BATCH = 64U;
 
 
 // Processes
@@ -141,6 +151,7 @@ constexpr uint32_t MAX_FINDSERVICE_RESULT_SIZE = SERVICE_REGISTRY_CAPACITY;
 constexpr const char SERVICE_DISCOVERY_SERVICE_NAME[] = "ServiceDiscovery";
 constexpr const char SERVICE_DISCOVERY_INSTANCE_NAME[] = "RouDi_ID";
 constexpr const char SERVICE_DISCOVERY_EVENT_NAME[] = "ServiceRegistry";
+constexpr const char SERVICE_DISCOVERY_DELTA_EVENT_NAME[] = "ServiceRegistryDelta";
 
 // Resource prefix
 constexpr uint32_t RESOURCE_PREFIX_LENGTH = 13; // 'iox1_' + MAX_UINT16_SIZE + '_i_'/'_u_'
@@ -290,6 +301,7 @@ constexpr units::Duration PROCESS_DEFAULT_TERMINATION_DELAY = 0_s;
 constexpr units::Duration PROCESS_DEFAULT_KILL_DELAY = 45_s;
 constexpr units::Duration PROCESS_TERMINATED_CHECK_INTERVAL = 250_ms;
 constexpr units::Duration DISCOVERY_INTERVAL = 100_ms;
+constexpr units::Duration CHUNK_OWNERSHIP_INTROSPECTION_INTERVAL = 1_s;
 
 /// @brief Controls process alive monitoring. Upon timeout, a monitored process is removed
 /// and its resources are made available. The process can then start and register itself again.
@@ -309,6 +321,9 @@ iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const Monitoring
 namespace mepoo
 {
 using SequenceNumber_t = std::uint64_t;
+/// @brief the number of buckets of the histogram of the chunk utilization, i.e. the ratio of the required chunk size
+/// of an allocation and the chunk size of the mempool which served it
+constexpr uint32_t NUMBER_OF_CHUNK_UTILIZATION_BUCKETS{8U};
 } // namespace mepoo
 
 namespace runtime
@@ -317,6 +332,7 @@ using namespace units::duration_literals;
 constexpr units::Duration PROCESS_WAITING_FOR_ROUDI_TIMEOUT = 60_s;
 constexpr units::Duration PROCESS_KEEP_ALIVE_INTERVAL = 3 * roudi::DISCOVERY_INTERVAL;  // > DISCOVERY_INTERVAL
 constexpr units::Duration PROCESS_KEEP_ALIVE_TIMEOUT = 5 * PROCESS_KEEP_ALIVE_INTERVAL; // > PROCESS_KEEP_ALIVE_INTERVAL
+constexpr units::Duration PROCESS_REQUEST_RESPONSE_TIMEOUT = 60_s;
 } // namespace runtime
 
 namespace version
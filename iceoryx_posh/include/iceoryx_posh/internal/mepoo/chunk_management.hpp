@@ -17,6 +17,7 @@
 #ifndef IOX_POSH_MEPOO_CHUNK_MANAGEMENT_HPP
 #define IOX_POSH_MEPOO_CHUNK_MANAGEMENT_HPP
 
+#include "iceoryx_posh/iceoryx_posh_deployment.hpp"
 #include "iox/not_null.hpp"
 #include "iox/relative_pointer.hpp"
 
@@ -40,11 +41,18 @@ struct ChunkManagement
                     const not_null<MemPool*> mempool,
                     const not_null<MemPool*> chunkManagementPool) noexcept;
 
+    /// @brief Returns the current time of the steady clock in nanoseconds which is used for the loan timestamp
+    static uint64_t currentLoanTime() noexcept;
+
     iox::RelativePointer<base_t> m_chunkHeader;
     referenceCounter_t m_referenceCounter{1U};
 
     iox::RelativePointer<MemPool> m_mempool;
     iox::RelativePointer<MemPool> m_chunkManagementPool;
+
+    /// @brief the time at which the chunk was taken from the mempool, used for the loan duration statistics; the
+    /// clock is only read with 'IOX_LATENCY_STATISTICS'
+    uint64_t m_loanTimestamp{build::IOX_LATENCY_STATISTICS_FLAG ? currentLoanTime() : 0U};
 };
 } // namespace mepoo
 } // namespace iox
@@ -18,6 +18,8 @@
 #ifndef IOX_POSH_MEPOO_MEM_POOL_HPP
 #define IOX_POSH_MEPOO_MEM_POOL_HPP
 
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iox/algorithm.hpp"
 #include "iox/bump_allocator.hpp"
@@ -43,6 +45,13 @@ struct MemPoolInfo
     uint32_t m_minFreeChunks{0};
     uint32_t m_numChunks{0};
     uint64_t m_chunkSize{0};
+    uint64_t m_numberOfAllocations{0};
+    uint64_t m_numberOfFrees{0};
+    uint64_t m_numberOfFailedAllocations{0};
+    /// @brief bucket i counts the allocations which required more than i/N and at most (i+1)/N of the chunk size
+    uint64_t m_chunkUtilization[NUMBER_OF_CHUNK_UTILIZATION_BUCKETS]{};
+    uint64_t m_loanDurationP50InNanoseconds{0};
+    uint64_t m_loanDurationP99InNanoseconds{0};
 };
 
 class MemPool
@@ -70,6 +79,19 @@ class MemPool
 
     void freeChunk(const void* chunk) noexcept;
 
+    /// @brief Checks whether a chunk belongs to this MemPool
+    /// @param[in] chunk is the pointer to the start of the chunk
+    /// @return true if the pointer is the start of a chunk in the raw memory of this MemPool, false otherwise
+    bool containsChunk(const void* const chunk) const noexcept;
+
+    /// @brief Records how much of a chunk is required by an allocation which was served by this MemPool
+    /// @param[in] requiredChunkSize is the chunk size which was requested from the MemoryManager
+    void recordChunkUtilization(const uint64_t requiredChunkSize) noexcept;
+
+    /// @brief Records the time a chunk of this MemPool was loaned until it was freed
+    /// @param[in] loanDurationInNanoseconds is the time between the allocation and the release of the chunk
+    void recordLoanDuration(const uint64_t loanDurationInNanoseconds) noexcept;
+
     /// @brief Converts an index to a chunk in the MemPool to a pointer
     /// @param[in] index of the chunk
     /// @param[in] chunkSize is the size of the chunk
@@ -99,6 +121,12 @@ class MemPool
     std::atomic<uint32_t> m_usedChunks{0U};
     std::atomic<uint32_t> m_minFree{0U};
 
+    std::atomic<uint64_t> m_numberOfAllocations{0U};
+    std::atomic<uint64_t> m_numberOfFrees{0U};
+    std::atomic<uint64_t> m_numberOfFailedAllocations{0U};
+    std::atomic<uint64_t> m_chunkUtilization[NUMBER_OF_CHUNK_UTILIZATION_BUCKETS]{};
+    popo::LatencyHistogram m_loanDuration;
+
     freeList_t m_freeIndices;
 };
 
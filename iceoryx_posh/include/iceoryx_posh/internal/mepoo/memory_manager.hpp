@@ -25,6 +25,7 @@
 #include "iox/bump_allocator.hpp"
 #include "iox/expected.hpp"
 #include "iox/memory.hpp"
+#include "iox/optional.hpp"
 #include "iox/vector.hpp"
 
 #include <cstdint>
@@ -76,6 +77,17 @@ class MemoryManager
 
     MemPoolInfo getMemPoolInfo(const uint32_t index) const noexcept;
 
+    /// @brief Looks up the MemPool a chunk was obtained from
+    /// @param[in] chunk is the pointer to the start of the chunk, i.e. the ChunkHeader
+    /// @return the index of the MemPool which contains the chunk or nullopt if the chunk is not managed by this
+    /// MemoryManager
+    optional<uint32_t> getMemPoolIndex(const void* const chunk) const noexcept;
+
+    /// @brief Checks whether a pointer refers to a ChunkManagement of this MemoryManager without dereferencing it
+    /// @param[in] chunkManagement is the pointer to check
+    /// @return true if the pointer is the start of a chunk in the ChunkManagement pool, false otherwise
+    bool containsChunkManagement(const ChunkManagement* const chunkManagement) const noexcept;
+
     static uint64_t requiredChunkMemorySize(const MePooConfig& mePooConfig) noexcept;
     static uint64_t requiredManagementMemorySize(const MePooConfig& mePooConfig) noexcept;
     static uint64_t requiredFullMemorySize(const MePooConfig& mePooConfig) noexcept;
@@ -34,6 +34,7 @@ namespace roudi
 {
 template <typename MemoryManager, typename SegmentManager, typename PublisherPort>
 class MemPoolIntrospection;
+class PortManager;
 }
 
 namespace mepoo
@@ -98,6 +99,7 @@ class SegmentManager
   private:
     template <typename MemoryManger, typename SegmentManager, typename PublisherPort>
     friend class roudi::MemPoolIntrospection;
+    friend class roudi::PortManager;
 
     BumpAllocator* m_managementAllocator;
     vector<SegmentType, MAX_SHM_SEGMENTS> m_segmentContainer;
@@ -19,6 +19,8 @@
 
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iox/detail/relative_pointer_data.hpp"
+#include "iox/function_ref.hpp"
+#include "iox/optional.hpp"
 
 namespace iox
 {
@@ -54,6 +56,16 @@ class ShmSafeUnmanagedChunk
     /// true
     const ChunkHeader* getChunkHeader() const noexcept;
 
+    /// @brief const access to the ChunkHeader of a chunk which can be changed or released concurrently by its owner,
+    /// e.g. when RouDi inspects the ports of a running application
+    /// @param[in] isChunkManagement checks whether a pointer refers to a ChunkManagement before it is dereferenced
+    /// @return the const pointer to the ChunkHeader of the underlying chunk or nullopt if this is logically a nullptr,
+    /// does not refer to a ChunkManagement or was changed while it was read
+    /// @note the chunk can be released at any time, the ChunkHeader must therefore only be used to identify the chunk
+    /// by its address and must not be dereferenced
+    optional<const ChunkHeader*>
+    getChunkHeaderSnapshot(const function_ref<bool(const ChunkManagement*)> isChunkManagement) const noexcept;
+
     /// @brief Checks if the underlying RelativePointerData to the chunk is neither logically a nullptr nor that the
     /// chunk has other owner
     /// @return true if neither logically a nullptr nor other owner chunk owners present, otherwise false
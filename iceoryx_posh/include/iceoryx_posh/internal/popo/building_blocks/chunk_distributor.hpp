@@ -20,8 +20,10 @@
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/tracepoint.hpp"
 #include "iox/detail/adaptive_wait.hpp"
 #include "iox/detail/unique_id.hpp"
+#include "iox/function_ref.hpp"
 #include "iox/not_null.hpp"
 
 #include <algorithm>
@@ -136,6 +138,10 @@ class ChunkDistributor
     /// @brief Clears the chunk history
     void clearHistory() noexcept;
 
+    /// @brief Calls the callable with the ChunkHeader of every chunk in the history
+    /// @param[in] callable which is called for every chunk
+    void forEachChunkInHistory(const function_ref<void(const mepoo::ChunkHeader*)> callable) noexcept;
+
     /// @brief cleanup the used shrared memory chunks
     void cleanup() noexcept;
 
@@ -146,6 +152,9 @@ class ChunkDistributor
     bool pushToQueue(not_null<ChunkQueueData_t* const> queue, mepoo::SharedChunk chunk) noexcept;
 
   private:
+    /// @brief Counts a failed delivery; must only be called while the distributor is locked
+    void incrementQueueOverflows() noexcept;
+
     MemberType_t* m_chunkDistrubutorDataPtr{nullptr};
 };
 
@@ -80,9 +80,16 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(not_null<ChunkQueueData_
             // total history
             const auto startIndex =
                 (requestedHistory <= currChunkHistorySize) ? currChunkHistorySize - requestedHistory : 0u;
+            ChunkQueueData_t* const queue = queueToAdd;
             for (auto i = startIndex; i < currChunkHistorySize; ++i)
             {
-                pushToQueue(queueToAdd, getMembers()->m_history[i].cloneToSharedChunk());
+                auto historyChunk = getMembers()->m_history[i].cloneToSharedChunk();
+                const auto publishTimestamp = historyChunk.getChunkHeader()->publishTimestamp();
+                if (publishTimestamp > queue->m_newestHistoryPublishTimestamp.load(std::memory_order_relaxed))
+                {
+                    queue->m_newestHistoryPublishTimestamp.store(publishTimestamp, std::memory_order_relaxed);
+                }
+                pushToQueue(queueToAdd, historyChunk);
             }
 
             return ok();
@@ -167,6 +174,7 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
                 {
                     ++numberOfQueuesTheChunkWasDeliveredTo;
                     ChunkQueuePusher_t(queue.get()).lostAChunk();
+                    incrementQueueOverflows();
                 }
             }
         }
@@ -222,6 +230,7 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
     }
 
     addToHistoryWithoutDelivery(chunk);
+    IOX_TRACEPOINT(Tracepoint::CHUNK_DELIVERED, numberOfQueuesTheChunkWasDeliveredTo);
 
     return numberOfQueuesTheChunkWasDeliveredTo;
 }
@@ -233,6 +242,14 @@ inline bool ChunkDistributor<ChunkDistributorDataType>::pushToQueue(not_null<Chu
     return ChunkQueuePusher_t(queue).push(chunk);
 }
 
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::incrementQueueOverflows() noexcept
+{
+    // the lock makes this the only writer, therefore no read-modify-write is required
+    auto& queueOverflows = getMembers()->m_numberOfQueueOverflows;
+    queueOverflows.store(queueOverflows.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+}
+
 template <typename ChunkDistributorDataType>
 inline expected<void, ChunkDistributorError>
 ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const UniqueId uniqueQueueId,
@@ -267,9 +284,11 @@ ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const UniqueId unique
             else
             {
                 ChunkQueuePusher_t(queue.get()).lostAChunk();
+                incrementQueueOverflows();
             }
         }
     } while (retry);
+    IOX_TRACEPOINT(Tracepoint::CHUNK_DELIVERED, 1U);
 
     return ok();
 }
@@ -328,6 +347,18 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::getHistorySize() noe
     return getMembers()->m_history.size();
 }
 
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::forEachChunkInHistory(
+    const function_ref<void(const mepoo::ChunkHeader*)> callable) noexcept
+{
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+
+    for (const auto& chunk : getMembers()->m_history)
+    {
+        callable(chunk.getChunkHeader());
+    }
+}
+
 template <typename ChunkDistributorDataType>
 inline uint64_t ChunkDistributor<ChunkDistributorDataType>::getHistoryCapacity() const noexcept
 {
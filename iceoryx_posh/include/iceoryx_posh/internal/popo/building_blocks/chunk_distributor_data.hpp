@@ -27,6 +27,7 @@
 #include "iox/relative_pointer.hpp"
 #include "iox/vector.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <mutex>
 
@@ -43,6 +44,8 @@ struct ChunkDistributorData : public LockingPolicy
     using ChunkQueueData_t = typename ChunkQueuePusherType::MemberType_t;
     using ChunkDistributorDataProperties_t = ChunkDistributorDataProperties;
 
+    static constexpr uint64_t CACHE_LINE_SIZE{64U};
+
     ChunkDistributorData(const ConsumerTooSlowPolicy policy, const uint64_t historyCapacity = 0u) noexcept;
 
     const uint64_t m_historyCapacity;
@@ -58,6 +61,11 @@ struct ChunkDistributorData : public LockingPolicy
         vector<mepoo::ShmSafeUnmanagedChunk, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY>;
     HistoryContainer_t m_history;
     const ConsumerTooSlowPolicy m_consumerTooSlowPolicy;
+
+    /// @brief monotonic counter of the deliveries which failed since a queue was full and did not block the producer;
+    ///        it is only written while the distributor is locked and sampled by the introspection of RouDi, therefore
+    ///        it is on a cache line of its own
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> m_numberOfQueueOverflows{0U};
 };
 
 } // namespace popo
@@ -21,6 +21,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/variant_queue.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 #include "iox/detail/unique_id.hpp"
 #include "iox/relative_pointer.hpp"
@@ -45,6 +46,14 @@ struct ChunkQueueData : public LockingPolicy
     static constexpr uint64_t MAX_CAPACITY = ChunkQueueDataProperties_t::MAX_QUEUE_CAPACITY;
     VariantQueue<mepoo::ShmSafeUnmanagedChunk, MAX_CAPACITY> m_queue;
     std::atomic_bool m_queueHasLostChunks{false};
+    /// @brief monotonic counter of the chunks which were dropped from or not delivered to this queue; in contrast to
+    /// m_queueHasLostChunks it is never reset
+    std::atomic<uint64_t> m_numberOfLostChunks{0U};
+    /// @brief the maximum number of chunks which were stored in the queue at the same time
+    std::atomic<uint64_t> m_queueHighWaterMark{0U};
+    /// @brief the publish timestamp of the newest history chunk which was delivered to this queue; the history chunks
+    /// report their age instead of the latency, therefore chunks which are not newer are not recorded as latency
+    std::atomic<uint64_t> m_newestHistoryPublishTimestamp{mepoo::ChunkHeader::NO_PUBLISH_TIMESTAMP};
 
     RelativePointer<ConditionVariableData> m_conditionVariableDataPtr;
     optional<uint64_t> m_conditionVariableNotificationIndex;
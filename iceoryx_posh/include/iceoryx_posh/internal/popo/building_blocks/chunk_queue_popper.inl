@@ -66,6 +66,7 @@ inline optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::tryPop
                        iox::er::RUNTIME_ERROR);
             return nullopt_t();
         }
+        IOX_TRACEPOINT(Tracepoint::CHUNK_TAKEN, chunk.getChunkHeader()->sequenceNumber());
         return make_optional<mepoo::SharedChunk>(chunk);
     }
     else
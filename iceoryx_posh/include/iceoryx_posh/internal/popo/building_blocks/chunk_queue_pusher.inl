@@ -55,6 +55,16 @@ inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk)
         // tell the ChunkDistributor that we had an overflow and dropped a sample
         hasQueueOverflow = true;
     }
+    IOX_TRACEPOINT(Tracepoint::CHUNK_PUSHED, chunk.getChunkHeader()->sequenceNumber());
+
+    // the size is only an approximation with concurrent pushes and pops, which is sufficient for the introspection
+    const auto queueSize = getMembers()->m_queue.size();
+    auto highWaterMark = getMembers()->m_queueHighWaterMark.load(std::memory_order_relaxed);
+    while (queueSize > highWaterMark
+           && !getMembers()->m_queueHighWaterMark.compare_exchange_weak(
+               highWaterMark, queueSize, std::memory_order_relaxed, std::memory_order_relaxed))
+    {
+    }
 
     {
         typename MemberType_t::LockGuard_t lock(*getMembers());
@@ -73,6 +83,7 @@ template <typename ChunkQueueDataType>
 inline void ChunkQueuePusher<ChunkQueueDataType>::lostAChunk() noexcept
 {
     getMembers()->m_queueHasLostChunks.store(true, std::memory_order_relaxed);
+    getMembers()->m_numberOfLostChunks.fetch_add(1U, std::memory_order_relaxed);
 }
 
 } // namespace popo
@@ -21,6 +21,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver_data.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iox/expected.hpp"
+#include "iox/function_ref.hpp"
 #include "iox/not_null.hpp"
 
 namespace iox
@@ -87,6 +88,14 @@ class ChunkReceiver : public ChunkQueuePopper<typename ChunkReceiverDataType::Ch
     /// chunks in the system
     void releaseAll() noexcept;
 
+    /// @brief Calls the callable with the ChunkHeader of every chunk which was received and not yet released by the
+    /// user
+    /// @param[in] isChunkManagement checks whether a chunk refers to a ChunkManagement before it is dereferenced
+    /// @param[in] callable which is called for every chunk
+    /// @note the user can change the received chunks concurrently, therefore this is only a snapshot
+    void forEachChunkInUse(const function_ref<bool(const mepoo::ChunkManagement*)> isChunkManagement,
+                           const function_ref<void(const mepoo::ChunkHeader*)> callable) const noexcept;
+
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
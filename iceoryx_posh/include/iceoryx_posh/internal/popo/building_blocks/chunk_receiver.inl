@@ -111,6 +111,14 @@ inline void ChunkReceiver<ChunkReceiverDataType>::releaseAll() noexcept
     this->clear();
 }
 
+template <typename ChunkReceiverDataType>
+inline void ChunkReceiver<ChunkReceiverDataType>::forEachChunkInUse(
+    const function_ref<bool(const mepoo::ChunkManagement*)> isChunkManagement,
+    const function_ref<void(const mepoo::ChunkHeader*)> callable) const noexcept
+{
+    getMembers()->m_chunksInUse.forEachChunk(isChunkManagement, callable);
+}
+
 } // namespace popo
 } // namespace iox
 
@@ -20,11 +20,13 @@
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_sender_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/tracepoint.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/unique_port_id.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iox/detail/unique_id.hpp"
 #include "iox/expected.hpp"
+#include "iox/function_ref.hpp"
 #include "iox/into.hpp"
 #include "iox/not_null.hpp"
 #include "iox/optional.hpp"
@@ -138,6 +140,21 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// chunks in the system
     void releaseAll() noexcept;
 
+    /// @brief Calls the callable with the ChunkHeader of every chunk which is loaned by the user
+    /// @param[in] isChunkManagement checks whether a chunk refers to a ChunkManagement before it is dereferenced
+    /// @param[in] callable which is called for every chunk
+    /// @note the user can change the loaned chunks concurrently, therefore this is only a snapshot
+    void forEachChunkInUse(const function_ref<bool(const mepoo::ChunkManagement*)> isChunkManagement,
+                           const function_ref<void(const mepoo::ChunkHeader*)> callable) const noexcept;
+
+    /// @brief Calls the callable with the ChunkHeader of every chunk which is retained after sending, i.e. the
+    /// chunks in the history and the last sent chunk
+    /// @param[in] isChunkManagement checks whether the last sent chunk refers to a ChunkManagement before it is
+    /// dereferenced since it is replaced by the user without a lock
+    /// @param[in] callable which is called for every chunk
+    void forEachRetainedChunk(const function_ref<bool(const mepoo::ChunkManagement*)> isChunkManagement,
+                              const function_ref<void(const mepoo::ChunkHeader*)> callable) noexcept;
+
   private:
     /// @brief Get the SharedChunk from the provided ChunkHeader and do all that is required to send the chunk
     /// @param[in] chunkHeader of the chunk that shall be send
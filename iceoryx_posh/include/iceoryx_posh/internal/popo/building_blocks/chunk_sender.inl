@@ -129,6 +129,7 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
             lastChunkChunkHeader->~ChunkHeader();
             new (lastChunkChunkHeader) mepoo::ChunkHeader(chunkSize, chunkSettings);
             lastChunkChunkHeader->setOriginId(originId);
+            IOX_TRACEPOINT(Tracepoint::CHUNK_LOANED, chunkSize);
             return ok(lastChunkChunkHeader);
         }
         else
@@ -155,6 +156,7 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
         {
             // END of critical section
             chunk.getChunkHeader()->setOriginId(originId);
+            IOX_TRACEPOINT(Tracepoint::CHUNK_LOANED, chunk.getChunkHeader()->chunkSize());
             return ok(chunk.getChunkHeader());
         }
         else
@@ -252,6 +254,29 @@ inline void ChunkSender<ChunkSenderDataType>::releaseAll() noexcept
     getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
 }
 
+template <typename ChunkSenderDataType>
+inline void ChunkSender<ChunkSenderDataType>::forEachChunkInUse(
+    const function_ref<bool(const mepoo::ChunkManagement*)> isChunkManagement,
+    const function_ref<void(const mepoo::ChunkHeader*)> callable) const noexcept
+{
+    getMembers()->m_chunksInUse.forEachChunk(isChunkManagement, callable);
+}
+
+template <typename ChunkSenderDataType>
+inline void ChunkSender<ChunkSenderDataType>::forEachRetainedChunk(
+    const function_ref<bool(const mepoo::ChunkManagement*)> isChunkManagement,
+    const function_ref<void(const mepoo::ChunkHeader*)> callable) noexcept
+{
+    this->forEachChunkInHistory(callable);
+
+    // with a history, the last sent chunk is also the newest chunk in the history
+    if (this->getHistoryCapacity() == 0U)
+    {
+        getMembers()->m_lastChunkUnmanaged.getChunkHeaderSnapshot(isChunkManagement)
+            .and_then([&](const auto chunkHeader) { callable(chunkHeader); });
+    }
+}
+
 template <typename ChunkSenderDataType>
 inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(const mepoo::ChunkHeader* const chunkHeader,
                                                                    mepoo::SharedChunk& chunk) noexcept
@@ -259,6 +284,11 @@ inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(const mepoo::
     if (getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
     {
         chunk.getChunkHeader()->setSequenceNumber(getMembers()->m_sequenceNumber++);
+        if (build::IOX_LATENCY_STATISTICS_FLAG)
+        {
+            chunk.getChunkHeader()->setPublishTimestamp(mepoo::ChunkHeader::currentPublishTime());
+        }
+        IOX_TRACEPOINT(Tracepoint::CHUNK_PUBLISHED, chunk.getChunkHeader()->sequenceNumber());
         return true;
     }
     else
@@ -53,6 +53,7 @@ class ConditionListener
     /// never empty unless destroy() was called, then it's always empty.
     ///
     /// @return a sorted vector of active notifications
+    /// @note The notifications of attached timers become active when their deadline is reached
     NotificationVector_t wait() noexcept;
 
     /// @brief returns a sorted vector of indices of active notifications; blocking for the specified time if
@@ -64,14 +65,27 @@ class ConditionListener
     /// @return a sorted vector of active notifications
     NotificationVector_t timedWait(const units::Duration& timeToWait) noexcept;
 
+    /// @brief returns a sorted vector of indices of active notifications without blocking. The indices of active
+    /// notifications are empty when ConditionVariableData was not notified or when destroy() was called before.
+    ///
+    /// @return a sorted vector of active notifications
+    NotificationVector_t tryWait() noexcept;
+
   protected:
     const ConditionVariableData* getMembers() volatile const noexcept;
     ConditionVariableData* getMembers() volatile noexcept;
 
   private:
-    void resetUnchecked(const uint64_t index) noexcept;
+    void collectActiveNotifications(NotificationVector_t& activeNotifications) noexcept;
     void resetSemaphore() noexcept;
 
+    /// @brief Marks the notifications of all expired timers as active
+    void fireExpiredTimers() noexcept;
+    /// @brief Returns the earliest deadline of all armed timers or TimerSlot::DISARMED
+    uint64_t findNextTimerDeadline() const noexcept;
+    /// @brief Waits on the semaphore until it is posted or the deadline is reached
+    void waitUntil(const uint64_t deadline) noexcept;
+
     NotificationVector_t waitImpl(const function_ref<bool()> waitCall) noexcept;
 
   private:
@@ -18,6 +18,7 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CONDITION_VARIABLE_DATA_HPP
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/timer_slot.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iox/unnamed_semaphore.hpp"
 
@@ -29,6 +30,20 @@ namespace popo
 {
 struct ConditionVariableData
 {
+    static constexpr uint64_t INVALID_READINESS_FIFO_ID{0U};
+    static constexpr uint64_t CACHE_LINE_SIZE{64U};
+    static constexpr uint64_t BITS_PER_BITMAP_WORD{64U};
+    static constexpr uint64_t NUMBER_OF_BITMAP_WORDS{(MAX_NUMBER_OF_NOTIFIERS + BITS_PER_BITMAP_WORD - 1U)
+                                                     / BITS_PER_BITMAP_WORD};
+
+    /// @brief The notification state of a single notifier. Every notifier owns a cache line, therefore repeated
+    ///        notifications which were not yet collected by the waiter do not write to memory which is shared
+    ///        with other notifiers.
+    struct alignas(CACHE_LINE_SIZE) NotifierSlot
+    {
+        std::atomic_bool m_isActive{false};
+    };
+
     ConditionVariableData() noexcept;
     explicit ConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
@@ -38,11 +53,25 @@ struct ConditionVariableData
     ConditionVariableData& operator=(ConditionVariableData&& rhs) = delete;
     ~ConditionVariableData() noexcept = default;
 
+    /// @brief Activates the notification of a notifier
+    /// @param[in] index the index of the notifier
+    /// @return true if the notification was inactive before, false if it was already active and not yet collected
+    bool activateNotification(const uint64_t index) noexcept;
+
+    /// @brief Checks if there are active notifications which were not yet collected
+    bool hasActiveNotifications() const noexcept;
+
     optional<UnnamedSemaphore> m_semaphore;
     RuntimeName_t m_runtimeName;
     std::atomic_bool m_toBeDestroyed{false};
-    std::atomic_bool m_activeNotifications[MAX_NUMBER_OF_NOTIFIERS];
-    std::atomic_bool m_wasNotified{false};
+    NotifierSlot m_notifierSlots[MAX_NUMBER_OF_NOTIFIERS];
+    /// @brief summary of the notifier slots; a set bit marks an active notification which was not yet collected
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> m_activeNotificationBitmap[NUMBER_OF_BITMAP_WORDS];
+    /// @brief id of the ReadinessFifo the waiter attached; INVALID_READINESS_FIFO_ID if there is none
+    std::atomic<uint64_t> m_readinessFifoId{INVALID_READINESS_FIFO_ID};
+    std::atomic_bool m_isReadinessSignalPending{false};
+    /// @brief deadlines of the timers attached to the waiter, evaluated by the waiting thread itself
+    TimerSlot m_timerSlots[MAX_NUMBER_OF_TIMERS_PER_CONDITION_VARIABLE];
 };
 
 } // namespace popo
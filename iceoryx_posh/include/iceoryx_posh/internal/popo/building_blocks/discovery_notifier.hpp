@@ -0,0 +1,131 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFIER_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFIER_HPP
+
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The origins of the notifications which wake up the discovery loop of RouDi. The numeric value is used as
+///        notification index of the ConditionVariableData the discovery loop is waiting on.
+enum class DiscoveryNotificationOrigin : uint64_t
+{
+    PUBLISHER_PORT,
+    SUBSCRIBER_PORT,
+    SERVER_PORT,
+    CLIENT_PORT,
+    INTERFACE_PORT,
+    DISCOVERY_LOOP_TRIGGER,
+};
+
+/// @brief A bitmap with one bit per port of a specific kind. A port marks its bit when it has a pending CaPro message
+///        so that RouDi only has to process the marked ports instead of sweeping over all ports.
+/// @tparam Capacity the maximum number of ports of this kind
+template <uint64_t Capacity>
+class DirtyPortBitmap
+{
+  public:
+    static constexpr uint64_t BITS_PER_WORD{64U};
+    static constexpr uint64_t NUMBER_OF_WORDS{(Capacity + BITS_PER_WORD - 1U) / BITS_PER_WORD};
+
+    /// @brief Marks the port with the provided index as dirty
+    /// @param[in] index of the port in its container
+    void mark(const uint64_t index) noexcept;
+
+    /// @brief Returns the word which holds the bit of the port with the provided index
+    /// @param[in] index of the port in its container
+    std::atomic<uint64_t>& word(const uint64_t index) noexcept;
+
+    /// @brief Returns the mask of the bit of the port with the provided index within its word
+    /// @param[in] index of the port in its container
+    static constexpr uint64_t mask(const uint64_t index) noexcept;
+
+    /// @brief Clears all marks and calls the provided callable with the index of every port which was marked
+    /// @param[in] callable which is called with the index of every marked port
+    template <typename Callable>
+    void consume(const Callable& callable) noexcept;
+
+  private:
+    std::atomic<uint64_t> m_words[NUMBER_OF_WORDS]{};
+};
+
+/// @brief Part of the data of a port. The user side of the port calls notify() after it changed a state which results
+///        in a CaPro message, e.g. with offer() or subscribe(). This marks the port in the DirtyPortBitmap of its kind
+///        and wakes up the discovery loop of RouDi, which then handles the port right away instead of with the next
+///        discovery interval. As long as the notifier is not attached, notify() does nothing and the port is only
+///        handled by the cyclic discovery.
+class DiscoveryNotifier
+{
+  public:
+    DiscoveryNotifier() noexcept = default;
+    ~DiscoveryNotifier() noexcept = default;
+
+    DiscoveryNotifier(const DiscoveryNotifier& rhs) = delete;
+    DiscoveryNotifier(DiscoveryNotifier&& rhs) noexcept = delete;
+    DiscoveryNotifier& operator=(const DiscoveryNotifier& rhs) = delete;
+    DiscoveryNotifier& operator=(DiscoveryNotifier&& rhs) noexcept = delete;
+
+    /// @brief Attaches the notifier to the discovery loop of RouDi
+    /// @param[in] condVarData the ConditionVariableData the discovery loop is waiting on
+    /// @param[in] origin the kind of port which is notifying, used as notification index
+    /// @param[in] dirtyPorts the DirtyPortBitmap of the kind of port
+    /// @param[in] index of the port in its container
+    template <uint64_t Capacity>
+    void attach(ConditionVariableData& condVarData,
+                const DiscoveryNotificationOrigin origin,
+                DirtyPortBitmap<Capacity>& dirtyPorts,
+                const uint64_t index) noexcept;
+
+    /// @brief Attaches the notifier to the discovery loop of RouDi without marking the port as dirty. The discovery
+    ///        loop handles all ports of the kind when it is notified by such a port.
+    /// @param[in] condVarData the ConditionVariableData the discovery loop is waiting on
+    /// @param[in] origin the kind of port which is notifying, used as notification index
+    void attach(ConditionVariableData& condVarData, const DiscoveryNotificationOrigin origin) noexcept;
+
+    /// @brief Returns true when the notifier is attached to the discovery loop of RouDi, otherwise false
+    bool isAttached() const noexcept;
+
+    /// @brief Marks the port as dirty and wakes up the discovery loop of RouDi if the notifier is attached
+    void notify() noexcept;
+
+  private:
+    int64_t offsetTo(const void* const target) const noexcept;
+    void* fromOffset(const int64_t offset) noexcept;
+
+  private:
+    /// @note the targets are addressed relative to the notifier itself since they are in the same memory block as
+    ///       the port data; unlike a RelativePointer this does not depend on the registration of the segment, which
+    ///       is already gone when the RouDi internal ports stop offering during the destruction of RouDi
+    static constexpr int64_t NULL_OFFSET{0};
+    int64_t m_condVarDataOffset{NULL_OFFSET};
+    int64_t m_dirtyWordOffset{NULL_OFFSET};
+    uint64_t m_dirtyMask{0U};
+    uint64_t m_notificationIndex{0U};
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier.inl"
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFIER_HPP
@@ -0,0 +1,81 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFIER_INL
+#define IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFIER_INL
+
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier.hpp"
+
+namespace iox
+{
+namespace popo
+{
+template <uint64_t Capacity>
+inline void DirtyPortBitmap<Capacity>::mark(const uint64_t index) noexcept
+{
+    word(index).fetch_or(mask(index), std::memory_order_acq_rel);
+}
+
+template <uint64_t Capacity>
+inline std::atomic<uint64_t>& DirtyPortBitmap<Capacity>::word(const uint64_t index) noexcept
+{
+    return m_words[index / BITS_PER_WORD];
+}
+
+template <uint64_t Capacity>
+inline constexpr uint64_t DirtyPortBitmap<Capacity>::mask(const uint64_t index) noexcept
+{
+    return 1ULL << (index % BITS_PER_WORD);
+}
+
+template <uint64_t Capacity>
+template <typename Callable>
+inline void DirtyPortBitmap<Capacity>::consume(const Callable& callable) noexcept
+{
+    for (uint64_t word = 0U; word < NUMBER_OF_WORDS; ++word)
+    {
+        // reading the word first avoids writing to the cache line when there is nothing to consume
+        if (m_words[word].load(std::memory_order_relaxed) == 0U)
+        {
+            continue;
+        }
+
+        auto dirtyBits = m_words[word].exchange(0U, std::memory_order_acq_rel);
+        for (uint64_t bit = 0U; dirtyBits != 0U; ++bit, dirtyBits >>= 1U)
+        {
+            if ((dirtyBits & 1U) != 0U)
+            {
+                callable(word * BITS_PER_WORD + bit);
+            }
+        }
+    }
+}
+
+template <uint64_t Capacity>
+inline void DiscoveryNotifier::attach(ConditionVariableData& condVarData,
+                                      const DiscoveryNotificationOrigin origin,
+                                      DirtyPortBitmap<Capacity>& dirtyPorts,
+                                      const uint64_t index) noexcept
+{
+    m_dirtyWordOffset = offsetTo(&dirtyPorts.word(index));
+    m_dirtyMask = DirtyPortBitmap<Capacity>::mask(index);
+    attach(condVarData, origin);
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFIER_INL
@@ -0,0 +1,95 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief A lock-free log-linear histogram for latencies in nanoseconds which can be placed in the shared memory.
+///        The first SUB_BUCKETS buckets have a width of one, afterwards each power of two is split into
+///        SUB_BUCKETS buckets of equal width. The relative error of a value is therefore at most 1 / SUB_BUCKETS.
+///        Values which exceed the range of the histogram are counted in the last bucket.
+/// @note record() may be called concurrently by multiple threads and processes, e.g. by every process which releases
+///       chunks of a mempool, since the buckets are incremented atomically. percentile() reads the buckets one after
+///       another and the result is therefore only approximate when values are recorded concurrently.
+class LatencyHistogram
+{
+  public:
+    static constexpr uint64_t SUB_BUCKET_BITS{2U};
+    static constexpr uint64_t SUB_BUCKETS{1U << SUB_BUCKET_BITS};
+    /// @brief with 32 powers of two, the histogram covers latencies up to approximately 8.6 seconds
+    static constexpr uint64_t NUMBER_OF_POWERS{32U};
+    static constexpr uint64_t NUMBER_OF_BUCKETS{SUB_BUCKETS * NUMBER_OF_POWERS};
+
+    LatencyHistogram() noexcept = default;
+
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram(LatencyHistogram&&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(LatencyHistogram&&) = delete;
+
+    /// @brief Adds a latency to the histogram
+    /// @param[in] latencyInNanoseconds the latency to add
+    void record(const uint64_t latencyInNanoseconds) noexcept;
+
+    /// @brief Returns the number of recorded latencies
+    uint64_t count() const noexcept;
+
+    /// @brief Returns the upper bound of the bucket which contains the requested percentile
+    /// @param[in] fraction of the recorded latencies which are less or equal to the returned value, e.g. 0.99 for p99
+    /// @return the latency in nanoseconds or 0 if nothing was recorded
+    uint64_t percentile(const double fraction) const noexcept;
+
+    /// @brief Returns the index of the bucket in which a latency is counted
+    static uint64_t bucketIndex(const uint64_t latencyInNanoseconds) noexcept;
+
+    /// @brief Returns the largest latency which is counted in a bucket
+    static uint64_t bucketUpperBound(const uint64_t index) noexcept;
+
+  private:
+    std::atomic<uint64_t> m_buckets[NUMBER_OF_BUCKETS]{};
+};
+
+/// @brief Has the interface of the LatencyHistogram without any storage. It is used in place of the LatencyHistogram
+///        when the latencies are not recorded, e.g. when 'IOX_LATENCY_STATISTICS' is disabled.
+class DisabledLatencyHistogram
+{
+  public:
+    void record(const uint64_t) noexcept
+    {
+    }
+
+    uint64_t count() const noexcept
+    {
+        return 0U;
+    }
+
+    uint64_t percentile(const double) const noexcept
+    {
+        return 0U;
+    }
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
@@ -0,0 +1,90 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_READINESS_FIFO_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_READINESS_FIFO_HPP
+
+#include "iceoryx_platform/platform_settings.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iox/expected.hpp"
+#include "iox/filesystem.hpp"
+#include "iox/string.hpp"
+
+namespace iox
+{
+namespace popo
+{
+enum class ReadinessFifoError : uint8_t
+{
+    NOT_SUPPORTED,
+    UNABLE_TO_CREATE_FIFO,
+    UNABLE_TO_OPEN_FIFO,
+};
+
+/// @brief A named pipe which becomes readable when the ConditionVariableData it is attached to gets notified.
+///        Since the file descriptor of the pipe can be used with poll, select or epoll, the notifications of a
+///        WaitSet can be multiplexed in an external event loop without an additional thread which waits on the
+///        semaphore of the ConditionVariableData.
+/// @note The pipe is signalled at most once until the waiter calls rearm(). A notifier therefore only performs
+///       the additional system calls when the waiter has consumed the previous readiness signal.
+class ReadinessFifo
+{
+  public:
+    using Path_t = string<platform::IOX_MAX_PATH_LENGTH>;
+    static constexpr int32_t INVALID_FILE_DESCRIPTOR{-1};
+    /// @brief Notifiers of other users can signal the pipe if they share the group, like the shared memory segments
+    ///        which are also only accessible by the owner and the group; other users cannot open the pipe
+    static constexpr access_rights FIFO_PERMISSIONS = perms::owner_read | perms::owner_write | perms::group_write;
+
+    explicit ReadinessFifo(ConditionVariableData& condVarData) noexcept;
+    ~ReadinessFifo() noexcept;
+
+    ReadinessFifo(const ReadinessFifo& rhs) = delete;
+    ReadinessFifo(ReadinessFifo&& rhs) noexcept = delete;
+    ReadinessFifo& operator=(const ReadinessFifo& rhs) = delete;
+    ReadinessFifo& operator=(ReadinessFifo&& rhs) noexcept = delete;
+
+    /// @brief Creates the named pipe with the first call and attaches it to the ConditionVariableData
+    /// @return the file descriptor of the read end of the named pipe or the reason why it could not be created
+    expected<int32_t, ReadinessFifoError> getFileDescriptor() noexcept;
+
+    /// @brief Consumes the readiness signal so that the next notification makes the file descriptor readable
+    ///        again. Must be called before the active notifications are collected, otherwise notifications which
+    ///        arrive in between could get lost for the external event loop.
+    void rearm() noexcept;
+
+    /// @brief Signals the named pipe which is attached to the ConditionVariableData, if there is any
+    /// @param[in] condVarData the ConditionVariableData which was notified
+    static void signal(ConditionVariableData& condVarData) noexcept;
+
+    /// @brief Returns the path of the named pipe with the provided id
+    /// @param[in] fifoId the id of the named pipe
+    static Path_t path(const uint64_t fifoId) noexcept;
+
+    /// @brief Detaches the named pipe from the ConditionVariableData and removes it; called by the destructor but
+    ///        must be called explicitly when the ConditionVariableData is released before the ReadinessFifo is
+    ///        destroyed
+    void detach() noexcept;
+
+  private:
+    ConditionVariableData* m_condVarDataPtr{nullptr};
+    uint64_t m_fifoId{ConditionVariableData::INVALID_READINESS_FIFO_ID};
+    int32_t m_fileDescriptor{INVALID_FILE_DESCRIPTOR};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_READINESS_FIFO_HPP
@@ -0,0 +1,84 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_TIMER_SLOT_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_TIMER_SLOT_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Stores the deadline of a Timer in the ConditionVariableData of the WaitSet or Listener it is attached to.
+///        The deadlines are evaluated by the ConditionListener of the waiting thread which marks the notification
+///        of an expired timer as active, therefore no additional thread and no semaphore post are required.
+/// @note All points in time are nanoseconds of the monotonic clock.
+class TimerSlot
+{
+  public:
+    static constexpr uint64_t INVALID_NOTIFICATION_INDEX{std::numeric_limits<uint64_t>::max()};
+    static constexpr uint64_t DISARMED{std::numeric_limits<uint64_t>::max()};
+
+    TimerSlot() noexcept = default;
+
+    TimerSlot(const TimerSlot& rhs) = delete;
+    TimerSlot(TimerSlot&& rhs) = delete;
+    TimerSlot& operator=(const TimerSlot& rhs) = delete;
+    TimerSlot& operator=(TimerSlot&& rhs) = delete;
+    ~TimerSlot() noexcept = default;
+
+    /// @brief Acquires the slot for the notification with the provided index
+    /// @param[in] notificationIndex the index of the notification which becomes active when the timer expires
+    /// @return true if the slot was free, otherwise false
+    bool acquire(const uint64_t notificationIndex) noexcept;
+
+    /// @brief Disarms the slot and makes it available for other timers
+    void release() noexcept;
+
+    /// @brief Arms the slot
+    /// @param[in] deadline the absolute point in time when the timer expires for the first time
+    /// @param[in] period the period with which the timer expires afterwards, zero for a one-shot timer
+    void arm(const uint64_t deadline, const uint64_t period) noexcept;
+
+    /// @brief Disarms the slot
+    /// @return the deadline the slot was armed with or DISARMED
+    uint64_t disarm() noexcept;
+
+    /// @brief Returns the next deadline or DISARMED
+    uint64_t deadline() const noexcept;
+
+    /// @brief Advances the deadline by whole periods when it was reached. Periods which were missed completely are
+    ///        skipped so that the following deadlines stay aligned to the first one and do not drift.
+    /// @param[in] now the current point in time
+    /// @return the notification index of the timer when it expired, otherwise INVALID_NOTIFICATION_INDEX
+    uint64_t expire(const uint64_t now) noexcept;
+
+    /// @brief Returns the current point in time of the monotonic clock in nanoseconds
+    static uint64_t now() noexcept;
+
+  private:
+    std::atomic<uint64_t> m_notificationIndex{INVALID_NOTIFICATION_INDEX};
+    std::atomic<uint64_t> m_deadline{DISARMED};
+    std::atomic<uint64_t> m_period{0U};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_TIMER_SLOT_HPP
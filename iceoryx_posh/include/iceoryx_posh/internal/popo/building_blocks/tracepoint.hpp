@@ -0,0 +1,136 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_TRACEPOINT_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_TRACEPOINT_HPP
+
+#include "iceoryx_posh/iceoryx_posh_deployment.hpp"
+#include "iox/function_ref.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The points in the data path which are recorded when iceoryx is built with 'IOX_TRACEPOINTS'; the comment
+///        names the argument which is recorded with the tracepoint
+enum class Tracepoint : uint8_t
+{
+    CHUNK_LOANED,    // size of the chunk
+    CHUNK_PUBLISHED, // sequence number of the chunk
+    CHUNK_DELIVERED, // number of queues the chunk was delivered to
+    CHUNK_PUSHED,    // sequence number of the chunk
+    CHUNK_TAKEN,     // sequence number of the chunk
+    NOTIFIED,        // notification index
+    WOKEN_UP,        // number of collected notifications
+};
+
+/// @brief Converts the Tracepoint to a string literal
+/// @param[in] value to convert to a string literal
+/// @return pointer to a string literal
+const char* asStringLiteral(const Tracepoint value) noexcept;
+
+struct TraceEvent
+{
+    /// @brief the time of the steady clock in nanoseconds, which is also used for the publish timestamp of the chunks
+    uint64_t timestamp{0U};
+    uint64_t argument{0U};
+    Tracepoint tracepoint{Tracepoint::CHUNK_LOANED};
+};
+
+/// @brief A ring of trace events which belongs to a single thread. The owning thread records the events lock-free
+///        and overwrites the oldest events when the ring is full. Other threads can read the events concurrently;
+///        events which are overwritten while they are read are skipped.
+class TraceRing
+{
+  public:
+    static constexpr uint64_t CAPACITY{4096U};
+
+    /// @param[in] threadId the id of the owning thread which is written to the exported trace
+    explicit TraceRing(const uint64_t threadId) noexcept;
+
+    TraceRing(const TraceRing&) = delete;
+    TraceRing(TraceRing&&) = delete;
+    TraceRing& operator=(const TraceRing&) = delete;
+    TraceRing& operator=(TraceRing&&) = delete;
+
+    /// @brief Records an event with the current time; must only be called by the owning thread
+    /// @param[in] tracepoint which was passed
+    /// @param[in] argument of the tracepoint
+    void record(const Tracepoint tracepoint, const uint64_t argument) noexcept;
+
+    /// @brief Calls the callable for each event in the ring, from the oldest to the newest one
+    /// @param[in] callable which is called with the events
+    void forEachEvent(const function_ref<void(const TraceEvent&)> callable) const noexcept;
+
+    /// @brief Returns the id of the owning thread
+    uint64_t threadId() const noexcept;
+
+    /// @brief Returns the ring of the calling thread; it is created and registered on the first call. When the thread
+    ///        exits, the ring keeps its events until it is reused by a new thread.
+    static TraceRing& threadLocalRing() noexcept;
+
+    /// @brief Calls the callable for each ring which was created in this process
+    /// @param[in] callable which is called with the rings
+    static void forEachRing(const function_ref<void(const TraceRing&)> callable) noexcept;
+
+  private:
+    friend class TraceRingRegistry;
+
+    void reset(const uint64_t threadId) noexcept;
+
+    struct Slot
+    {
+        std::atomic<uint64_t> sequenceNumber{0U};
+        std::atomic<uint64_t> timestamp{0U};
+        std::atomic<uint64_t> argument{0U};
+        std::atomic<uint8_t> tracepoint{0U};
+    };
+
+    std::atomic<uint64_t> m_threadId{0U};
+    std::atomic<uint64_t> m_writeIndex{0U};
+    Slot m_slots[CAPACITY];
+};
+
+/// @brief Writes the events of all trace rings of this process in the Chrome trace event format, which can be
+///        opened with Perfetto or chrome://tracing
+/// @param[in] stream to which the events are written
+void writeTraceEventsAsChromeJson(std::ostream& stream) noexcept;
+
+} // namespace popo
+} // namespace iox
+
+// NOLINTBEGIN(cppcoreguidelines-macro-usage) the tracepoints must be removed completely when they are disabled
+
+/// @brief Records a tracepoint in the ring of the calling thread. Without 'IOX_TRACEPOINTS' the tracepoint is removed
+///        by the preprocessor and the argument is not evaluated.
+/// @param[in] tracepoint the iox::popo::Tracepoint which was passed
+/// @param[in] argument the argument of the tracepoint, it must be implicitly convertible to uint64_t
+#if IOX_TRACEPOINTS_ENABLED
+#define IOX_TRACEPOINT(tracepoint, argument) iox::popo::TraceRing::threadLocalRing().record(tracepoint, argument)
+#else
+#define IOX_TRACEPOINT(tracepoint, argument)                                                                           \
+    do                                                                                                                 \
+    {                                                                                                                  \
+    } while (false)
+#endif
+
+// NOLINTEND(cppcoreguidelines-macro-usage)
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_TRACEPOINT_HPP
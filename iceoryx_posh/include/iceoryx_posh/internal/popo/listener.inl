@@ -17,14 +17,179 @@
 #ifndef IOX_POSH_POPO_LISTENER_INL
 #define IOX_POSH_POPO_LISTENER_INL
 #include "iceoryx_posh/popo/listener.hpp"
+#include "iox/assertions.hpp"
+
+#include <algorithm>
 
 namespace iox
 {
 namespace popo
 {
+template <uint64_t Capacity>
+inline ListenerImpl<Capacity>::ListenerImpl() noexcept
+    : ListenerImpl(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable())
+{
+}
+
+template <uint64_t Capacity>
+inline ListenerImpl<Capacity>::ListenerImpl(ConditionVariableData& conditionVariable) noexcept
+    : m_conditionVariableData(&conditionVariable)
+    , m_conditionListener(conditionVariable)
+{
+    m_thread = std::thread(&ListenerImpl::threadLoop, this);
+}
+
+template <uint64_t Capacity>
+inline ListenerImpl<Capacity>::~ListenerImpl() noexcept
+{
+    m_wasDtorCalled.store(true, std::memory_order_relaxed);
+    m_conditionListener.destroy();
+
+    m_thread.join();
+    m_conditionVariableData->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+}
+
+template <uint64_t Capacity>
+inline uint64_t ListenerImpl<Capacity>::size() const noexcept
+{
+    return m_indexManager.indicesInUse();
+}
+
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::threadLoop() noexcept
+{
+    while (m_wasDtorCalled.load(std::memory_order_relaxed) == false)
+    {
+        auto activateNotificationIds = m_conditionListener.wait();
+
+        if (m_numberOfPrioritizedEvents.load(std::memory_order_relaxed) != 0U)
+        {
+            executeCallbacksByPriority(activateNotificationIds);
+            continue;
+        }
+
+        for (auto& id : activateNotificationIds)
+        {
+            m_events[id]->executeCallback();
+        }
+    }
+}
+
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::executeCallbacksByPriority(
+    ConditionListener::NotificationVector_t& activeNotificationIds) noexcept
+{
+    // the ids are sorted in ascending priority so that the next callback can be taken from the back
+    sortByPriority(activeNotificationIds);
+    while (!activeNotificationIds.empty())
+    {
+        const auto id = activeNotificationIds.back();
+        activeNotificationIds.pop_back();
+        m_events[id]->executeCallback();
+
+        // events which fired in the meantime are merged into the remaining batch, otherwise a high priority event
+        // would have to wait until all low priority callbacks of the current batch are executed
+        if (!activeNotificationIds.empty() && m_conditionListener.wasNotified())
+        {
+            for (const auto newId : m_conditionListener.tryWait())
+            {
+                if (std::find(activeNotificationIds.begin(), activeNotificationIds.end(), newId)
+                    == activeNotificationIds.end())
+                {
+                    activeNotificationIds.emplace_back(newId);
+                }
+            }
+            sortByPriority(activeNotificationIds);
+        }
+    }
+}
+
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::sortByPriority(
+    ConditionListener::NotificationVector_t& notificationIds) const noexcept
+{
+    // insertion sort since it is stable, does not allocate and the batches are usually small and presorted
+    auto precedes = [this](const uint64_t lhs, const uint64_t rhs) {
+        const auto lhsPriority = m_eventPriorities[lhs].load(std::memory_order_relaxed);
+        const auto rhsPriority = m_eventPriorities[rhs].load(std::memory_order_relaxed);
+        // events with the same priority are executed in the order of their ids
+        return lhsPriority < rhsPriority || (lhsPriority == rhsPriority && lhs > rhs);
+    };
+
+    for (uint64_t i = 1U; i < notificationIds.size(); ++i)
+    {
+        const auto id = notificationIds[i];
+        auto j = i;
+        while (j > 0U && precedes(id, notificationIds[j - 1U]))
+        {
+            notificationIds[j] = notificationIds[j - 1U];
+            --j;
+        }
+        notificationIds[j] = id;
+    }
+}
+
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::removeTrigger(const uint64_t index) noexcept
+{
+    if (index >= MAX_NUMBER_OF_EVENTS)
+    {
+        return;
+    }
+
+    if (m_events[index]->reset())
+    {
+        if (m_eventPriorities[index].exchange(DEFAULT_EVENT_PRIORITY, std::memory_order_relaxed)
+            != DEFAULT_EVENT_PRIORITY)
+        {
+            m_numberOfPrioritizedEvents.fetch_sub(1U, std::memory_order_relaxed);
+        }
+        m_indexManager.push(static_cast<uint32_t>(index));
+    }
+}
+
+///////////////////////
+// BEGIN IndexManager_t
+///////////////////////
+template <uint64_t Capacity>
+inline ListenerImpl<Capacity>::IndexManager_t::IndexManager_t() noexcept
+{
+    m_loffli.init(m_loffliStorage, MAX_NUMBER_OF_EVENTS);
+}
+
+template <uint64_t Capacity>
+inline bool ListenerImpl<Capacity>::IndexManager_t::pop(uint32_t& value) noexcept
+{
+    if (m_loffli.pop(value))
+    {
+        ++m_indicesInUse;
+        return true;
+    }
+    return false;
+}
+
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::IndexManager_t::push(const uint32_t index) noexcept
+{
+    IOX_ENFORCE(m_loffli.push(index), "Releasing used index back to free list");
+    --m_indicesInUse;
+}
+
+template <uint64_t Capacity>
+inline uint64_t ListenerImpl<Capacity>::IndexManager_t::indicesInUse() const noexcept
+{
+    return m_indicesInUse.load(std::memory_order_relaxed);
+}
+/////////////////////
+// END IndexManager_t
+/////////////////////
+
+template <uint64_t Capacity>
 template <typename T, typename ContextDataType>
 inline expected<void, ListenerError>
-Listener::attachEvent(T& eventOrigin, const NotificationCallback<T, ContextDataType>& eventCallback) noexcept
+ListenerImpl<Capacity>::attachEvent(T& eventOrigin,
+                                    const NotificationCallback<T, ContextDataType>& eventCallback,
+                                    const EventPriority_t priority) noexcept
 {
     if (eventCallback.m_callback == nullptr)
     {
@@ -37,16 +202,21 @@ Listener::attachEvent(T& eventOrigin, const NotificationCallback<T, ContextDataT
                     typeid(NoEnumUsed).hash_code(),
                     reinterpret_cast<internal::GenericCallbackRef_t>(*eventCallback.m_callback),
                     internal::TranslateAndCallTypelessCallback<T, ContextDataType>::call,
-                    NotificationAttorney::getInvalidateTriggerMethod(eventOrigin))
+                    NotificationAttorney::getInvalidateTriggerMethod(eventOrigin),
+                    priority)
         .and_then([&](auto& eventId) {
             NotificationAttorney::enableEvent(
-                eventOrigin, TriggerHandle(*m_conditionVariableData, {*this, &Listener::removeTrigger}, eventId));
+                eventOrigin, TriggerHandle(*m_conditionVariableData, {*this, &ListenerImpl::removeTrigger}, eventId));
         });
 }
 
+template <uint64_t Capacity>
 template <typename T, typename EventType, typename ContextDataType, typename>
-inline expected<void, ListenerError> Listener::attachEvent(
-    T& eventOrigin, const EventType eventType, const NotificationCallback<T, ContextDataType>& eventCallback) noexcept
+inline expected<void, ListenerError>
+ListenerImpl<Capacity>::attachEvent(T& eventOrigin,
+                                    const EventType eventType,
+                                    const NotificationCallback<T, ContextDataType>& eventCallback,
+                                    const EventPriority_t priority) noexcept
 {
     if (eventCallback.m_callback == nullptr)
     {
@@ -59,23 +229,26 @@ inline expected<void, ListenerError> Listener::attachEvent(
                     typeid(EventType).hash_code(),
                     reinterpret_cast<internal::GenericCallbackRef_t>(*eventCallback.m_callback),
                     internal::TranslateAndCallTypelessCallback<T, ContextDataType>::call,
-                    NotificationAttorney::getInvalidateTriggerMethod(eventOrigin))
+                    NotificationAttorney::getInvalidateTriggerMethod(eventOrigin),
+                    priority)
         .and_then([&](auto& eventId) {
             NotificationAttorney::enableEvent(
                 eventOrigin,
-                TriggerHandle(*m_conditionVariableData, {*this, &Listener::removeTrigger}, eventId),
+                TriggerHandle(*m_conditionVariableData, {*this, &ListenerImpl::removeTrigger}, eventId),
                 eventType);
         });
 }
 
+template <uint64_t Capacity>
 inline expected<uint32_t, ListenerError>
-Listener::addEvent(void* const origin,
-                   void* const userType,
-                   const uint64_t eventType,
-                   const uint64_t eventTypeHash,
-                   internal::GenericCallbackRef_t callback,
-                   internal::TranslationCallbackRef_t translationCallback,
-                   const function<void(uint64_t)> invalidationCallback) noexcept
+ListenerImpl<Capacity>::addEvent(void* const origin,
+                                 void* const userType,
+                                 const uint64_t eventType,
+                                 const uint64_t eventTypeHash,
+                                 internal::GenericCallbackRef_t callback,
+                                 internal::TranslationCallbackRef_t translationCallback,
+                                 const function<void(uint64_t)> invalidationCallback,
+                                 const EventPriority_t priority) noexcept
 {
     std::lock_guard<std::mutex> lock(m_addEventMutex);
 
@@ -95,24 +268,32 @@ Listener::addEvent(void* const origin,
 
     m_events[index]->init(
         index, origin, userType, eventType, eventTypeHash, callback, translationCallback, invalidationCallback);
+    m_eventPriorities[index].store(priority, std::memory_order_relaxed);
+    if (priority != DEFAULT_EVENT_PRIORITY)
+    {
+        m_numberOfPrioritizedEvents.fetch_add(1U, std::memory_order_relaxed);
+    }
     return ok(index);
 }
 
+template <uint64_t Capacity>
 template <typename T, typename EventType, typename>
-inline void Listener::detachEvent(T& eventOrigin, const EventType eventType) noexcept
+inline void ListenerImpl<Capacity>::detachEvent(T& eventOrigin, const EventType eventType) noexcept
 {
     static_assert(IS_EVENT_ENUM<EventType>,
                   "Only enums with an underlying EventEnumIdentifier can be attached/detached to the Listener");
     NotificationAttorney::disableEvent(eventOrigin, eventType);
 }
 
+template <uint64_t Capacity>
 template <typename T>
-inline void Listener::detachEvent(T& eventOrigin) noexcept
+inline void ListenerImpl<Capacity>::detachEvent(T& eventOrigin) noexcept
 {
     NotificationAttorney::disableEvent(eventOrigin);
 }
 
-inline constexpr uint64_t Listener::capacity() noexcept
+template <uint64_t Capacity>
+inline constexpr uint64_t ListenerImpl<Capacity>::capacity() noexcept
 {
     return MAX_NUMBER_OF_EVENTS;
 }
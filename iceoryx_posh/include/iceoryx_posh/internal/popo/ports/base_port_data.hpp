@@ -20,6 +20,7 @@
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/capro/capro_message.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/unique_port_id.hpp"
 #include "iox/relative_pointer.hpp"
 
@@ -51,6 +52,7 @@ struct BasePortData
     RuntimeName_t m_runtimeName;
     UniquePortId m_uniqueId;
     std::atomic_bool m_toBeDestroyed{false};
+    DiscoveryNotifier m_discoveryNotifier;
 };
 
 } // namespace popo
@@ -0,0 +1,60 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_PORTS_PORT_STATISTICS_HPP
+#define IOX_POSH_POPO_PORTS_PORT_STATISTICS_HPP
+
+#include "iceoryx_posh/iceoryx_posh_deployment.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The counters are only written by the thread which uses the port and sampled by the introspection of RouDi.
+/// They are relaxed atomics on a cache line of their own, so that neither the sampling nor the writes of RouDi to the
+/// rest of the port data slow down the hot path.
+static constexpr uint64_t PORT_STATISTICS_ALIGNMENT{64U};
+
+/// @brief The histogram occupies a kilobyte per subscriber port and is therefore only placed in the shared memory when
+/// the latencies are recorded
+using SubscriberLatencyHistogram =
+    std::conditional<build::IOX_LATENCY_STATISTICS_FLAG, LatencyHistogram, DisabledLatencyHistogram>::type;
+
+/// @brief Monotonic counters of a publisher port
+struct alignas(PORT_STATISTICS_ALIGNMENT) PublisherPortStatistics
+{
+    std::atomic<uint64_t> m_chunksSent{0U};
+    std::atomic<uint64_t> m_bytesSent{0U};
+    std::atomic<uint64_t> m_lastChunkSize{0U};
+};
+
+/// @brief Monotonic counters of a subscriber port
+struct alignas(PORT_STATISTICS_ALIGNMENT) SubscriberPortStatistics
+{
+    std::atomic<uint64_t> m_chunksReceived{0U};
+    /// @brief the time between sending and taking of the chunks; always empty without 'IOX_LATENCY_STATISTICS'
+    SubscriberLatencyHistogram m_latency;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_PORTS_PORT_STATISTICS_HPP
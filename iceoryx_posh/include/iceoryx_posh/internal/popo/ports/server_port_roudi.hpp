@@ -67,6 +67,15 @@ class ServerPortRouDi : public BasePort
     /// Caution: Contract is that user process is no more running when cleanup is called
     void releaseAllChunks() noexcept;
 
+    /// @brief Calls the callables with the ChunkHeader of the chunks which are held by the port
+    /// @param[in] isChunkManagement checks whether a chunk refers to a ChunkManagement before it is dereferenced
+    /// @param[in] chunkInUse is called for every chunk which is loaned or received and not yet released by the user
+    /// @param[in] retainedChunk is called for every chunk which is retained after sending, e.g. for the history
+    /// @note the user can change the chunks in use concurrently, therefore this is only a snapshot
+    void forEachHeldChunk(const function_ref<bool(const mepoo::ChunkManagement*)> isChunkManagement,
+                          const function_ref<void(const mepoo::ChunkHeader*)> chunkInUse,
+                          const function_ref<void(const mepoo::ChunkHeader*)> retainedChunk) noexcept;
+
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
@@ -21,6 +21,7 @@
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/variant_queue.hpp"
 #include "iceoryx_posh/internal/popo/ports/base_port_data.hpp"
+#include "iceoryx_posh/internal/popo/ports/port_statistics.hpp"
 #include "iceoryx_posh/internal/popo/ports/pub_sub_port_types.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 
@@ -52,6 +53,8 @@ struct SubscriberPortData : public BasePortData
 
     std::atomic_bool m_subscribeRequested{false};
     std::atomic<SubscribeState> m_subscriptionState{SubscribeState::NOT_SUBSCRIBED};
+
+    SubscriberPortStatistics m_statistics;
 };
 
 } // namespace popo
@@ -64,6 +64,14 @@ class SubscriberPortRouDi : public BasePort
     /// Caution: Contract is that user process is no more running when cleanup is called
     void releaseAllChunks() noexcept;
 
+    /// @brief Calls the callable with the ChunkHeader of every chunk which was received and not yet released by the
+    /// user
+    /// @param[in] isChunkManagement checks whether a chunk refers to a ChunkManagement before it is dereferenced
+    /// @param[in] chunkInUse is called for every chunk
+    /// @note the user can change the chunks in use concurrently, therefore this is only a snapshot
+    void forEachChunkInUse(const function_ref<bool(const mepoo::ChunkManagement*)> isChunkManagement,
+                           const function_ref<void(const mepoo::ChunkHeader*)> chunkInUse) const noexcept;
+
   protected:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
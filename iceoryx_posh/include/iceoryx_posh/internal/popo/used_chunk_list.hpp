@@ -20,6 +20,7 @@
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iox/function_ref.hpp"
 
 #include <atomic>
 #include <cstdint>
@@ -65,6 +66,15 @@ class UsedChunkList
     /// still running.
     void cleanup() noexcept;
 
+    /// @brief Calls the callable with the ChunkHeader of every chunk in the list without changing the list
+    /// @param[in] isChunkManagement checks whether an entry refers to a ChunkManagement before it is dereferenced
+    /// @param[in] callable which is called for every chunk
+    /// @note from RouDi context while the application is running; the list is only a snapshot since the application
+    /// can change it concurrently, entries which are changed while they are read are skipped and the ChunkHeader must
+    /// not be dereferenced
+    void forEachChunk(const function_ref<bool(const mepoo::ChunkManagement*)> isChunkManagement,
+                      const function_ref<void(const mepoo::ChunkHeader*)> callable) const noexcept;
+
   private:
     void init() noexcept;
 
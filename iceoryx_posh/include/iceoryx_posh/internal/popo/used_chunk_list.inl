@@ -117,6 +117,18 @@ void UsedChunkList<Capacity>::cleanup() noexcept
     init(); // just to save us from the future self
 }
 
+template <uint32_t Capacity>
+void UsedChunkList<Capacity>::forEachChunk(const function_ref<bool(const mepoo::ChunkManagement*)> isChunkManagement,
+                                           const function_ref<void(const mepoo::ChunkHeader*)> callable) const noexcept
+{
+    // the used list is not traversed since its indices could be changed concurrently; the entries of the free list
+    // are logical nullptr
+    for (const auto& data : m_listData)
+    {
+        data.getChunkHeaderSnapshot(isChunkManagement).and_then([&](const auto chunkHeader) { callable(chunkHeader); });
+    }
+}
+
 template <uint32_t Capacity>
 void UsedChunkList<Capacity>::init() noexcept
 {
@@ -81,6 +81,7 @@ template <uint64_t Capacity>
 inline WaitSet<Capacity>::WaitSet(ConditionVariableData& condVarData) noexcept
     : m_conditionVariableDataPtr(&condVarData)
     , m_conditionListener(condVarData)
+    , m_readinessFifo(condVarData)
 {
     for (uint64_t i = 0U; i < Capacity; ++i)
     {
@@ -92,6 +93,9 @@ template <uint64_t Capacity>
 inline WaitSet<Capacity>::~WaitSet() noexcept
 {
     removeAllTriggers();
+    // the readiness fifo must be detached while the condition variable is still owned by this WaitSet, otherwise a
+    // new owner could already have attached its own readiness fifo when the member is destroyed
+    m_readinessFifo.detach();
     m_conditionVariableDataPtr->m_toBeDestroyed.store(true, std::memory_order_relaxed);
 }
 
@@ -333,6 +337,24 @@ inline typename WaitSet<Capacity>::NotificationInfoVector WaitSet<Capacity>::wai
     return waitAndReturnTriggeredTriggers([this] { return this->m_conditionListener.wait(); });
 }
 
+template <uint64_t Capacity>
+inline typename WaitSet<Capacity>::NotificationInfoVector WaitSet<Capacity>::tryWait() noexcept
+{
+    m_readinessFifo.rearm();
+    return waitAndReturnTriggeredTriggers([this] { return this->m_conditionListener.tryWait(); });
+}
+
+template <uint64_t Capacity>
+inline expected<int32_t, WaitSetError> WaitSet<Capacity>::getReadinessFileDescriptor() noexcept
+{
+    auto fileDescriptor = m_readinessFifo.getFileDescriptor();
+    if (fileDescriptor.has_error())
+    {
+        return err(WaitSetError::READINESS_FD_UNAVAILABLE);
+    }
+    return ok(fileDescriptor.value());
+}
+
 template <uint64_t Capacity>
 inline typename WaitSet<Capacity>::NotificationInfoVector
 WaitSet<Capacity>::createVectorWithTriggeredTriggers() noexcept
@@ -70,6 +70,7 @@ namespace iox
     error(POSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT) \
     error(POSH__RUNTIME_NO_NAME_PROVIDED) \
     error(POSH__RUNTIME_NAME_NOT_VALID_FILE_NAME) \
+    error(POSH__RUNTIME_REQUEST_CHANNEL_FAILED_TO_CREATE_SEMAPHORE) \
     error(POSH__SERVICE_DISCOVERY_UNKNOWN_EVENT_PROVIDED) \
     error(POSH__SERVICE_DISCOVERY_UNKNOWN_MESSAGE_PATTERN_PROVIDED) \
     error(POSH__PORT_MANAGER_PUBLISHERPORT_NOT_UNIQUE) \
@@ -155,6 +156,7 @@ namespace iox
     error(ROUDI__DEFAULT_ROUDI_MEMORY_FAILED_TO_ADD_INTROSPECTION_MEMORY_BLOCK) \
     error(ROUDI__DEFAULT_ROUDI_MEMORY_FAILED_TO_ADD_DISCOVERY_MEMORY_BLOCK) \
     error(ROUDI__DEFAULT_ROUDI_MEMORY_FAILED_TO_ADD_HEARTBEAT_MEMORY_BLOCK) \
+    error(ROUDI__DEFAULT_ROUDI_MEMORY_FAILED_TO_ADD_REQUEST_CHANNEL_MEMORY_BLOCK) \
     error(ROUDI__PRECONDITIONS_FOR_PROCESS_MANAGER_NOT_FULFILLED) \
     error(MEMORY_PROVIDER__INSUFFICIENT_SEGMENT_IDS) \
     error(ICEORYX_ROUDI_MEMORY_MANAGER__COULD_NOT_ACQUIRE_FILE_LOCK) \
@@ -0,0 +1,72 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_DISCOVERY_WORKERS_HPP
+#define IOX_POSH_ROUDI_DISCOVERY_WORKERS_HPP
+
+#include "iox/function_ref.hpp"
+#include "iox/optional.hpp"
+#include "iox/unnamed_semaphore.hpp"
+#include "iox/vector.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Threads which handle disjoint shards of the ports in the cyclic discovery of the PortManager. The thread
+///        which calls run handles the first shard itself, therefore N shards require N - 1 additional threads.
+class DiscoveryWorkers
+{
+  public:
+    static constexpr uint32_t MAX_NUMBER_OF_SHARDS{16U};
+
+    /// @brief Starts the threads for the shards
+    /// @param[in] numberOfShards the number of shards; it is limited to [1, MAX_NUMBER_OF_SHARDS]
+    explicit DiscoveryWorkers(const uint32_t numberOfShards) noexcept;
+    ~DiscoveryWorkers() noexcept;
+
+    DiscoveryWorkers(const DiscoveryWorkers&) = delete;
+    DiscoveryWorkers(DiscoveryWorkers&&) = delete;
+    DiscoveryWorkers& operator=(const DiscoveryWorkers&) = delete;
+    DiscoveryWorkers& operator=(DiscoveryWorkers&&) = delete;
+
+    uint32_t numberOfShards() const noexcept;
+
+    /// @brief Calls the handler concurrently for every shard and returns when all shards are handled
+    /// @param[in] shardHandler the callable which handles the shard with the provided index
+    void run(const function_ref<void(const uint32_t)> shardHandler) noexcept;
+
+  private:
+    void work(const uint32_t shard) noexcept;
+
+  private:
+    uint32_t m_numberOfShards{1U};
+    std::atomic<bool> m_keepRunning{true};
+    // only accessed between posting the start semaphores and waiting for the finished semaphore
+    const function_ref<void(const uint32_t)>* m_shardHandler{nullptr};
+    optional<UnnamedSemaphore> m_startSemaphores[MAX_NUMBER_OF_SHARDS];
+    optional<UnnamedSemaphore> m_finishedSemaphore;
+    vector<std::thread, MAX_NUMBER_OF_SHARDS> m_threads;
+};
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_DISCOVERY_WORKERS_HPP
@@ -24,6 +24,7 @@
 #include "iox/function.hpp"
 #include "iox/logging.hpp"
 
+#include <chrono>
 #include <cstdint>
 
 namespace iox
@@ -82,11 +83,29 @@ class MemPoolIntrospection
                                            const PosixGroup& writerGroup,
                                            uint32_t id) noexcept;
 
+    /// @brief the counters of a mempool at the time of the last sample, used to calculate the rates
+    struct MemPoolCounters
+    {
+        uint64_t numberOfAllocations{0U};
+        uint64_t numberOfFrees{0U};
+    };
+    using MemPoolCountersContainer = vector<MemPoolCounters, MAX_NUMBER_OF_MEMPOOLS>;
+
     /// @brief copy data fro internal struct into interface struct
-    void copyMemPoolInfo(const MemoryManager& memoryManager, MemPoolInfoContainer& dest) noexcept;
+    /// @param[in] memoryManager whose mempools are copied
+    /// @param[in] lastCounters are the counters of the mempools of the last sample which are updated
+    /// @param[in] secondsSinceLastSample is the time since the last sample
+    /// @param[out] dest is the interface struct
+    void copyMemPoolInfo(const MemoryManager& memoryManager,
+                         MemPoolCountersContainer& lastCounters,
+                         const double secondsSinceLastSample,
+                         MemPoolInfoContainer& dest) noexcept;
 
   private:
     units::Duration m_sendInterval{units::Duration::fromSeconds(1U)};
+    /// @brief index 0 is RouDi's segment, the others are the user segments in the order of the segment container
+    MemPoolCountersContainer m_lastCounters[MAX_SHM_SEGMENTS + 1U];
+    std::chrono::steady_clock::time_point m_lastSampleTime{std::chrono::steady_clock::now()};
     concurrent::detail::PeriodicTask<function<void()>> m_publishingTask{
         concurrent::detail::PeriodicTaskManualStart, "MemPoolIntr", *this, &MemPoolIntrospection::send};
 };
@@ -87,6 +87,10 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
     if (m_publisherPort.hasSubscribers())
     {
         uint32_t id = 0U;
+        const auto now = std::chrono::steady_clock::now();
+        const auto secondsSinceLastSample = std::chrono::duration<double>(now - m_lastSampleTime).count();
+        m_lastSampleTime = now;
+
         auto maybeChunkHeader = m_publisherPort.tryAllocateChunk(sizeof(MemPoolIntrospectionInfoContainer),
                                                                  alignof(MemPoolIntrospectionInfoContainer),
                                                                  CHUNK_NO_USER_HEADER_SIZE,
@@ -109,7 +113,10 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
                                        PosixGroup::getGroupOfCurrentProcess(),
                                        PosixGroup::getGroupOfCurrentProcess(),
                                        id);
-            copyMemPoolInfo(*m_rouDiInternalMemoryManager, memPoolIntrospectionInfo.m_mempoolInfo);
+            copyMemPoolInfo(*m_rouDiInternalMemoryManager,
+                            m_lastCounters[id],
+                            secondsSinceLastSample,
+                            memPoolIntrospectionInfo.m_mempoolInfo);
             ++id;
 
             // User shm segments
@@ -120,7 +127,10 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
                     auto& memPoolIntrospectionInfo = sample->back();
                     prepareIntrospectionSample(
                         memPoolIntrospectionInfo, segment.getReaderGroup(), segment.getWriterGroup(), id);
-                    copyMemPoolInfo(segment.getMemoryManager(), memPoolIntrospectionInfo.m_mempoolInfo);
+                    copyMemPoolInfo(segment.getMemoryManager(),
+                                    m_lastCounters[id],
+                                    secondsSinceLastSample,
+                                    memPoolIntrospectionInfo.m_mempoolInfo);
                 }
                 else
                 {
@@ -150,11 +160,16 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
 // copy data fro internal struct into interface struct
 template <typename MemoryManager, typename SegmentManager, typename PublisherPort>
 inline void
-MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::copyMemPoolInfo(const MemoryManager& memoryManager,
-                                                                                    MemPoolInfoContainer& dest) noexcept
+MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::copyMemPoolInfo(
+    const MemoryManager& memoryManager,
+    MemPoolCountersContainer& lastCounters,
+    const double secondsSinceLastSample,
+    MemPoolInfoContainer& dest) noexcept
 {
     auto numOfMemPools = memoryManager.getNumberOfMemPools();
     dest = MemPoolInfoContainer(numOfMemPools, MemPoolInfo());
+    // the number of mempools of a segment never changes, only the first sample has to create the counters
+    lastCounters.resize(numOfMemPools);
     for (uint32_t i = 0U; i < numOfMemPools; ++i)
     {
         auto src = memoryManager.getMemPoolInfo(i);
@@ -164,6 +179,26 @@ MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::copyMemPoolI
         dst.m_numChunks = src.m_numChunks;
         dst.m_chunkSize = src.m_chunkSize;
         dst.m_chunkPayloadSize = src.m_chunkSize - static_cast<uint32_t>(sizeof(mepoo::ChunkHeader));
+        dst.m_numberOfAllocations = src.m_numberOfAllocations;
+        dst.m_numberOfFrees = src.m_numberOfFrees;
+        dst.m_numberOfFailedAllocations = src.m_numberOfFailedAllocations;
+        for (uint32_t bucket = 0U; bucket < mepoo::NUMBER_OF_CHUNK_UTILIZATION_BUCKETS; ++bucket)
+        {
+            dst.m_chunkUtilization[bucket] = src.m_chunkUtilization[bucket];
+        }
+        dst.m_loanDurationP50InNanoseconds = src.m_loanDurationP50InNanoseconds;
+        dst.m_loanDurationP99InNanoseconds = src.m_loanDurationP99InNanoseconds;
+
+        auto& last = lastCounters[i];
+        if (secondsSinceLastSample > 0.0)
+        {
+            dst.m_allocationsPerSecond =
+                static_cast<double>(src.m_numberOfAllocations - last.numberOfAllocations) / secondsSinceLastSample;
+            dst.m_freesPerSecond =
+                static_cast<double>(src.m_numberOfFrees - last.numberOfFrees) / secondsSinceLastSample;
+        }
+        last.numberOfAllocations = src.m_numberOfAllocations;
+        last.numberOfFrees = src.m_numberOfFrees;
     }
 }
 
@@ -26,6 +26,7 @@
 #include "iox/function.hpp"
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 
 #include <map>
@@ -86,6 +87,10 @@ class PortIntrospection
             /// map from indices to ConnectionContainer indices
             std::map<int, ConnectionContainerIndexType> connectionMap;
             int index{-1};
+
+            /// counters and time of the previous throughput sample, the rates are computed from the difference
+            uint64_t lastChunksSent{0U};
+            std::chrono::steady_clock::time_point lastSampleTime{std::chrono::steady_clock::now()};
         };
 
         struct SubscriberInfo
@@ -175,8 +180,13 @@ class PortIntrospection
         /// @param[out] topic data structure to be prepared for sending
         void prepareTopic(PortIntrospectionTopic& topic) noexcept;
 
+        /// @brief sample the statistics of all tracked publisher ports; the rates are computed over the time since
+        /// the previous call
+        /// @param[out] topic data structure to be prepared for sending
         void prepareTopic(PortThroughputIntrospectionTopic& topic) noexcept;
 
+        /// @brief sample the changing data of all tracked subscriber ports
+        /// @param[out] topic data structure to be prepared for sending
         void prepareTopic(SubscriberPortChangingIntrospectionFieldTopic& topic) noexcept;
 
         /// @brief compute the next connection state based on the current connection state and a capro message type when
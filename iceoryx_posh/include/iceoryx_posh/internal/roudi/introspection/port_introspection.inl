@@ -591,10 +591,63 @@ PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(PortInt
 
 template <typename PublisherPort, typename SubscriberPort>
 inline void
-PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(PortThroughputIntrospectionTopic& topic
-                                                                         [[maybe_unused]]) noexcept
+PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(
+    PortThroughputIntrospectionTopic& topic) noexcept
 {
-    /// @todo iox-#402 re-add port throughput
+    constexpr double NANOSECONDS_PER_MINUTE{60.0 * 1000.0 * 1000.0 * 1000.0};
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto now = std::chrono::steady_clock::now();
+
+    // same order as in the PortIntrospectionTopic to allow a lookup by index
+    for (auto& pub : m_publisherMap)
+    {
+        for (auto& pair : pub.second)
+        {
+            auto publisherIndex = pair.second;
+            if (publisherIndex >= 0)
+            {
+                auto publisherInfo = m_publisherContainer.iter_from_index(publisherIndex);
+                auto& portData = *publisherInfo->portData;
+                auto& statistics = portData.m_statistics;
+
+                PortThroughputData throughputData;
+                throughputData.m_publisherPortID = static_cast<uint64_t>(portData.m_uniqueId);
+                throughputData.m_chunksSent = statistics.m_chunksSent.load(std::memory_order_relaxed);
+                throughputData.m_bytesSent = statistics.m_bytesSent.load(std::memory_order_relaxed);
+                throughputData.m_chunkSize = statistics.m_lastChunkSize.load(std::memory_order_relaxed);
+                throughputData.m_queueOverflows =
+                    portData.m_chunkSenderData.m_numberOfQueueOverflows.load(std::memory_order_relaxed);
+                throughputData.m_isField = portData.m_chunkSenderData.m_historyCapacity > 0U;
+
+                if (throughputData.m_chunksSent > 0U)
+                {
+                    throughputData.m_sampleSize = throughputData.m_bytesSent / throughputData.m_chunksSent;
+                }
+
+                const auto chunksSentSinceLastSample = throughputData.m_chunksSent - publisherInfo->lastChunksSent;
+                const auto nanosecondsSinceLastSample = static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(now - publisherInfo->lastSampleTime).count());
+                if (nanosecondsSinceLastSample > 0U)
+                {
+                    throughputData.m_chunksPerMinute = static_cast<double>(chunksSentSinceLastSample)
+                                                       * NANOSECONDS_PER_MINUTE
+                                                       / static_cast<double>(nanosecondsSinceLastSample);
+                }
+                if (chunksSentSinceLastSample > 0U)
+                {
+                    throughputData.m_lastSendIntervalInNanoseconds =
+                        nanosecondsSinceLastSample / chunksSentSinceLastSample;
+                }
+
+                publisherInfo->lastChunksSent = throughputData.m_chunksSent;
+                publisherInfo->lastSampleTime = now;
+
+                topic.m_throughputList.emplace_back(throughputData);
+            }
+        }
+    }
 }
 
 template <typename PublisherPort, typename SubscriberPort>
@@ -616,10 +669,20 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareT
                 {
                     SubscriberPort port(subscriberInfo.portData);
                     subscriberData.subscriptionState = port.getSubscriptionState();
-
-                    // subscriberData.fifoCapacity = port .getDeliveryFiFoCapacity();
-                    // subscriberData.fifoSize = port.getDeliveryFiFoSize();
                     subscriberData.propagationScope = port.getCaProServiceDescription().getScope();
+
+                    // the queue is accessed concurrently by the publishers and the subscriber; all values are
+                    // snapshots which are not consistent with each other
+                    auto& queueData = subscriberInfo.portData->m_chunkReceiverData;
+                    subscriberData.fifoSize = queueData.m_queue.size();
+                    subscriberData.fifoCapacity = queueData.m_queue.capacity();
+                    subscriberData.fifoHighWaterMark = queueData.m_queueHighWaterMark.load(std::memory_order_relaxed);
+                    subscriberData.lostChunks = queueData.m_numberOfLostChunks.load(std::memory_order_relaxed);
+                    auto& statistics = subscriberInfo.portData->m_statistics;
+                    subscriberData.chunksReceived = statistics.m_chunksReceived.load(std::memory_order_relaxed);
+                    subscriberData.latencyP50InNanoseconds = statistics.m_latency.percentile(0.5);
+                    subscriberData.latencyP99InNanoseconds = statistics.m_latency.percentile(0.99);
+                    subscriberData.latencyP999InNanoseconds = statistics.m_latency.percentile(0.999);
                 }
                 else
                 {
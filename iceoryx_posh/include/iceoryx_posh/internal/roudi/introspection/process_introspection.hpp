@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_user.hpp"
+#include "iceoryx_posh/internal/runtime/heartbeat.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iox/assertions.hpp"
 #include "iox/detail/periodic_task.hpp"
@@ -35,7 +36,8 @@ namespace roudi
 ///        It is recommended to use the ProcessIntrospectionType alias which sets
 ///        the intended template parameter.
 ///        The class tracks the adding and removal of processes and sends it to
-///        the introspection client if subscribed.
+///        the introspection client if subscribed. As long as a monitored process
+///        is registered, the list is sent periodically with the current heartbeat ages.
 template <typename PublisherPort>
 class ProcessIntrospection
 {
@@ -54,7 +56,9 @@ class ProcessIntrospection
     /// @brief This function is used to add a process to the process introspection
     /// @param[in] pid is the PID of the process to add
     /// @param[in] name is the name of the process
-    void addProcess(const int pid, const RuntimeName_t& name) noexcept;
+    /// @param[in] heartbeat of the process or nullptr if the process is not monitored; it must stay valid until
+    ///            the process is removed
+    void addProcess(const int pid, const RuntimeName_t& name, const runtime::Heartbeat* heartbeat = nullptr) noexcept;
 
     /// @brief This function is used to remove the process from the process introspection
     /// @param[in] pid is the PID of the process to remove
@@ -85,7 +89,13 @@ class ProcessIntrospection
     void send() noexcept;
 
   private:
-    using ProcessList_t = iox::list<ProcessIntrospectionData, MAX_PROCESS_NUMBER>;
+    struct ProcessEntry
+    {
+        ProcessIntrospectionData m_data;
+        const runtime::Heartbeat* m_heartbeat{nullptr};
+    };
+
+    using ProcessList_t = iox::list<ProcessEntry, MAX_PROCESS_NUMBER>;
     ProcessList_t m_processList;
     bool m_processListNewData{true}; // true because we want to have a valid field, even with an empty list
 
@@ -44,15 +44,19 @@ inline ProcessIntrospection<PublisherPort>::~ProcessIntrospection() noexcept
 }
 
 template <typename PublisherPort>
-inline void ProcessIntrospection<PublisherPort>::addProcess(const int pid, const RuntimeName_t& name) noexcept
+inline void ProcessIntrospection<PublisherPort>::addProcess(const int pid,
+                                                            const RuntimeName_t& name,
+                                                            const runtime::Heartbeat* heartbeat) noexcept
 {
-    ProcessIntrospectionData procIntrData;
-    procIntrData.m_pid = pid;
-    procIntrData.m_name = name;
+    ProcessEntry entry;
+    entry.m_data.m_pid = pid;
+    entry.m_data.m_name = name;
+    entry.m_data.m_isMonitored = (heartbeat != nullptr);
+    entry.m_heartbeat = heartbeat;
 
     {
         std::lock_guard<std::mutex> guard(m_mutex);
-        m_processList.push_back(procIntrData);
+        m_processList.push_back(entry);
         m_processListNewData = true;
     }
 }
@@ -64,7 +68,7 @@ inline void ProcessIntrospection<PublisherPort>::removeProcess(const int pid) no
 
     for (auto it = m_processList.begin(); it != m_processList.end(); ++it)
     {
-        if (it->m_pid == pid)
+        if (it->m_data.m_pid == pid)
         {
             m_processList.erase(it);
             break;
@@ -100,7 +104,15 @@ template <typename PublisherPort>
 inline void ProcessIntrospection<PublisherPort>::send() noexcept
 {
     std::lock_guard<std::mutex> guard(m_mutex);
-    if (m_processListNewData)
+
+    // the heartbeat ages change continuously, therefore the list is also sent when only they have changed
+    bool hasMonitoredProcess{false};
+    for (const auto& entry : m_processList)
+    {
+        hasMonitoredProcess = hasMonitoredProcess || (entry.m_heartbeat != nullptr);
+    }
+
+    if (m_processListNewData || hasMonitoredProcess)
     {
         auto maybeChunkHeader = m_publisherPort->tryAllocateChunk(sizeof(ProcessIntrospectionFieldTopic),
                                                                   alignof(ProcessIntrospectionFieldTopic),
@@ -111,9 +123,15 @@ inline void ProcessIntrospection<PublisherPort>::send() noexcept
             auto sample = static_cast<ProcessIntrospectionFieldTopic*>(maybeChunkHeader.value()->userPayload());
             new (sample) ProcessIntrospectionFieldTopic;
 
-            for (auto& intrData : m_processList)
+            const auto nowMilliseconds = runtime::Heartbeat::milliseconds_since_epoch();
+            for (auto& entry : m_processList)
             {
-                sample->m_processList.emplace_back(intrData);
+                if (entry.m_heartbeat != nullptr)
+                {
+                    entry.m_data.m_heartbeatAgeInMilliseconds =
+                        entry.m_heartbeat->elapsed_milliseconds_since_last_beat(nowMilliseconds);
+                }
+                sample->m_processList.emplace_back(entry.m_data);
             }
             m_processListNewData = false;
 
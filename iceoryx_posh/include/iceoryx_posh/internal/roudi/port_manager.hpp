@@ -21,6 +21,7 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/capro/capro_message.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_roudi.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_user.hpp"
 #include "iceoryx_posh/internal/popo/ports/interface_port.hpp"
@@ -31,13 +32,19 @@
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_multi_producer.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_single_producer.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
+#include "iceoryx_posh/internal/roudi/discovery_workers.hpp"
 #include "iceoryx_posh/internal/roudi/introspection/port_introspection.hpp"
+#include "iceoryx_posh/internal/roudi/runtime_resource_index.hpp"
+#include "iceoryx_posh/internal/roudi/service_port_index.hpp"
 #include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry_delta.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_message.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_interface.hpp"
 #include "iceoryx_posh/roudi/port_pool.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iox/deadline_timer.hpp"
 #include "iox/optional.hpp"
 #include "iox/posix_shared_memory_object.hpp"
 #include "iox/type_traits.hpp"
@@ -54,7 +61,11 @@ class PortManager
 {
   public:
     using PortConfigInfo = iox::runtime::PortConfigInfo;
-    PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept;
+    /// @param[in] roudiMemoryInterface provides the port pool and the discovery memory
+    /// @param[in] numberOfDiscoveryShards the number of threads which handle the ports in the cyclic discovery; ports
+    ///            are assigned to the shards by the hash of their service description since only ports with the same
+    ///            service description are matched with each other
+    PortManager(RouDiMemoryInterface* roudiMemoryInterface, const uint32_t numberOfDiscoveryShards = 1U) noexcept;
 
     virtual ~PortManager() noexcept = default;
 
@@ -63,6 +74,14 @@ class PortManager
 
     void doDiscovery() noexcept;
 
+    /// @brief Handles only the ports which notified the discovery loop with their DiscoveryNotifier
+    /// @param[in] notifications the notification indices of the discovery ConditionVariableData, which correspond to
+    ///            the values of DiscoveryNotificationOrigin
+    void doDiscoveryForNotifiedPorts(const popo::ConditionListener::NotificationVector_t& notifications) noexcept;
+
+    /// @brief Returns the ConditionVariableData which is notified by the ports when they have pending CaPro messages
+    popo::ConditionVariableData& discoveryConditionVariableData() noexcept;
+
     expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     acquirePublisherPortData(const capro::ServiceDescription& service,
                              const popo::PublisherOptions& publisherOptions,
@@ -133,16 +152,28 @@ class PortManager
 
     void handlePublisherPorts() noexcept;
 
+    void handleDirtyPublisherPorts() noexcept;
+
+    void handlePublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData) noexcept;
+
     void doDiscoveryForPublisherPort(PublisherPortRouDiType& publisherPort) noexcept;
 
     void handleSubscriberPorts() noexcept;
 
+    void handleDirtySubscriberPorts() noexcept;
+
+    void handleSubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept;
+
     void doDiscoveryForSubscriberPort(SubscriberPortType& subscriberPort) noexcept;
 
     void destroyClientPort(popo::ClientPortData* const clientPortData) noexcept;
 
     void handleClientPorts() noexcept;
 
+    void handleDirtyClientPorts() noexcept;
+
+    void handleClientPort(popo::ClientPortData* const clientPortData) noexcept;
+
     void doDiscoveryForClientPort(popo::ClientPortRouDi& clientPort) noexcept;
 
     void makeAllServerPortsToStopOffer() noexcept;
@@ -151,12 +182,26 @@ class PortManager
 
     void handleServerPorts() noexcept;
 
+    void handleDirtyServerPorts() noexcept;
+
+    void handleServerPort(popo::ServerPortData* const serverPortData) noexcept;
+
     void doDiscoveryForServerPort(popo::ServerPortRouDi& serverPort) noexcept;
 
+    bool isInDiscoveryShard(const capro::ServiceDescription& service, const uint32_t shard) const noexcept;
+
+    void doDiscoveryForShard(const uint32_t shard) noexcept;
+
+    void destroyPortsToBeDestroyed() noexcept;
+
     void handleInterfaces() noexcept;
 
+    void destroyInterfacePort(popo::InterfacePortData* const interfacePortData) noexcept;
+
     void handleConditionVariables() noexcept;
 
+    void destroyConditionVariableData(popo::ConditionVariableData* const conditionVariableData) noexcept;
+
     bool isCompatiblePubSub(const PublisherPortRouDiType& publisher,
                             const SubscriberPortType& subscriber) const noexcept;
 
@@ -191,16 +236,45 @@ class PortManager
     bool isInternal(const capro::ServiceDescription& service) const noexcept;
 
     void publishServiceRegistry() noexcept;
+    bool publishServiceRegistrySnapshot() noexcept;
+    bool publishServiceRegistryDelta() noexcept;
+    void recordServiceRegistryChange(const ServiceRegistryDelta::Operation operation,
+                                     const capro::ServiceDescription& service) noexcept;
+
+    /// @brief Publishes which ports hold the chunks of the mempools; the ports are only scanned when there is a
+    /// subscriber and at most once per CHUNK_OWNERSHIP_INTROSPECTION_INTERVAL
+    void publishChunkOwnership() noexcept;
+    void collectChunkOwnership(ChunkOwnershipIntrospectionTopic& topic) noexcept;
 
-    const ServiceRegistry& serviceRegistry() const noexcept;
+    const IndexedServiceRegistry& serviceRegistry() const noexcept;
 
   private:
     RouDiMemoryInterface* m_roudiMemoryInterface{nullptr};
     PortPool* m_portPool{nullptr};
-    ServiceRegistry m_serviceRegistry;
+    IndexedServiceRegistry m_serviceRegistry;
     PortIntrospectionType m_portIntrospection;
     vector<capro::ServiceDescription, NUMBER_OF_INTERNAL_PUBLISHERS> m_internalServices;
     optional<PublisherPortRouDiType::MemberType_t*> m_serviceRegistryPublisherPortData;
+    optional<PublisherPortRouDiType::MemberType_t*> m_serviceRegistryDeltaPublisherPortData;
+    ServiceRegistryDelta m_serviceRegistryDelta{0U};
+    uint64_t m_numberOfServiceRegistryPublications{0U};
+    bool m_isServiceRegistrySnapshotPending{false};
+    optional<PublisherPortRouDiType::MemberType_t*> m_chunkOwnershipPublisherPortData;
+    deadline_timer m_chunkOwnershipIntrospectionTimer{units::Duration::zero()};
+    ServicePortIndex<PublisherPortRouDiType::MemberType_t> m_publisherPortIndex;
+    ServicePortIndex<SubscriberPortType::MemberType_t> m_subscriberPortIndex;
+    ServicePortIndex<popo::ServerPortData> m_serverPortIndex;
+    ServicePortIndex<popo::ClientPortData> m_clientPortIndex;
+    RuntimeResourceIndex<PublisherPortRouDiType::MemberType_t> m_publisherPortRuntimeIndex;
+    RuntimeResourceIndex<SubscriberPortType::MemberType_t> m_subscriberPortRuntimeIndex;
+    RuntimeResourceIndex<popo::ServerPortData> m_serverPortRuntimeIndex;
+    RuntimeResourceIndex<popo::ClientPortData> m_clientPortRuntimeIndex;
+    RuntimeResourceIndex<popo::InterfacePortData> m_interfacePortRuntimeIndex;
+    RuntimeResourceIndex<popo::ConditionVariableData> m_conditionVariableRuntimeIndex;
+    DiscoveryWorkers m_discoveryWorkers;
+    // the discovery shards share the service registry and the interface ports
+    std::mutex m_serviceRegistryMutex;
+    std::mutex m_interfacePortsMutex;
 
     // some ports for the service registry requires special handling
     // as we cannot send registry information if it was not created yet
@@ -27,27 +27,18 @@ template <typename T, std::enable_if_t<std::is_same<T, iox::build::OneToManyPoli
 inline optional<RuntimeName_t>
 PortManager::doesViolateCommunicationPolicy(const capro::ServiceDescription& service) noexcept
 {
-    // check if the publisher is already in the list
-    auto& publisherPorts = m_portPool->getPublisherPortDataList();
-    auto port = publisherPorts.begin();
-    while (port != publisherPorts.end())
+    // check if there is already a publisher with this service; the lookup is repeated after a port was destroyed
+    // since this also removes the port from the index
+    while (!m_publisherPortIndex.find(service).empty())
     {
-        popo::PublisherPortRouDi publisherPort(port.to_ptr());
+        auto* publisherPortData = m_publisherPortIndex.find(service).front();
+        popo::PublisherPortRouDi publisherPort(publisherPortData);
 
-        if (service == publisherPort.getCaProServiceDescription())
+        if (!publisherPort.toBeDestroyed())
         {
-            if (publisherPort.toBeDestroyed())
-            {
-                destroyPublisherPort(port.to_ptr());
-                port = publisherPorts.begin();
-                continue;
-            }
-            return make_optional<RuntimeName_t>(port->m_runtimeName);
-        }
-        else
-        {
-            ++port;
+            return make_optional<RuntimeName_t>(publisherPortData->m_runtimeName);
         }
+        destroyPublisherPort(publisherPortData);
     }
     return nullopt;
 }
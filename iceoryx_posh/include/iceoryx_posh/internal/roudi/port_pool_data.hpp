@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/interface_port.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
@@ -57,6 +58,22 @@ struct PortPoolData
     using ClientContainer = FixedPositionContainer<iox::popo::ClientPortData, MAX_CLIENTS>;
     ClientContainer m_clientPortMembers;
 
+    /// @brief the discovery loop of RouDi waits on this condition variable; the ports notify it with their
+    ///        DiscoveryNotifier and mark themselves in the dirty port bitmap of their kind
+    popo::ConditionVariableData m_discoveryConditionVariableData{"RouDi"};
+
+    using DirtyPublisherPorts = popo::DirtyPortBitmap<MAX_PUBLISHERS>;
+    DirtyPublisherPorts m_dirtyPublisherPorts;
+
+    using DirtySubscriberPorts = popo::DirtyPortBitmap<MAX_SUBSCRIBERS>;
+    DirtySubscriberPorts m_dirtySubscriberPorts;
+
+    using DirtyServerPorts = popo::DirtyPortBitmap<MAX_SERVERS>;
+    DirtyServerPorts m_dirtyServerPorts;
+
+    using DirtyClientPorts = popo::DirtyPortBitmap<MAX_CLIENTS>;
+    DirtyClientPorts m_dirtyClientPorts;
+
     const roudi::UniqueRouDiId m_uniqueRouDiId;
 };
 
@@ -20,6 +20,7 @@
 #include "iceoryx_posh/internal/mepoo/segment_manager.hpp"
 #include "iceoryx_posh/internal/roudi/port_manager.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
+#include "iceoryx_posh/internal/runtime/request_channel.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/roudi/heartbeat_pool.hpp"
 #include "iceoryx_posh/version/version_info.hpp"
@@ -44,12 +45,15 @@ class Process
     /// monitoring takes place
     /// @param [in] dataSegmentId is an identifier for the shm data segment
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated IPC channel transmission
+    /// @param [in] requestChannel is the shared memory channel over which the process sends its requests; if it is a
+    /// nullptr, all messages are sent via the IPC channel
     Process(const RuntimeName_t& name,
             const DomainId domainId,
             const uint32_t pid,
             const PosixUser& user,
             const HeartbeatPoolIndexType heartbeatPoolIndex,
-            const uint64_t sessionId) noexcept;
+            const uint64_t sessionId,
+            runtime::RequestChannel* const requestChannel = nullptr) noexcept;
 
     Process(const Process& other) = delete;
     Process& operator=(const Process& other) = delete;
@@ -62,6 +66,9 @@ class Process
 
     const RuntimeName_t getName() const noexcept;
 
+    /// @brief Sends a message to the process; the response to a request which was received via the request channel is
+    /// sent via the request channel, all other messages via the IPC channel
+    /// @param [in] data is the message to send
     void sendViaIpcChannel(const runtime::IpcMessage& data) noexcept;
 
     /// @brief The session ID which is used to check outdated IPC channel transmissions for this process
@@ -74,10 +81,13 @@ class Process
 
     bool isMonitored() const noexcept;
 
+    runtime::RequestChannel* getRequestChannel() const noexcept;
+
   private:
     const uint32_t m_pid{0U};
     runtime::IpcInterfaceUser m_ipcChannel;
     HeartbeatPoolIndexType m_heartbeatPoolIndex;
+    runtime::RequestChannel* m_requestChannel{nullptr};
     PosixUser m_user;
     std::atomic<uint64_t> m_sessionId{0U};
 };
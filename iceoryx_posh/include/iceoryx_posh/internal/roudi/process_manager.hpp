@@ -21,16 +21,20 @@
 #include "iceoryx_posh/internal/roudi/introspection/process_introspection.hpp"
 #include "iceoryx_posh/internal/roudi/port_manager.hpp"
 #include "iceoryx_posh/internal/roudi/process.hpp"
+#include "iceoryx_posh/internal/roudi/runtime_resource_index.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/roudi/heartbeat_pool.hpp"
+#include "iceoryx_posh/runtime/port_requests.hpp"
 #include "iceoryx_posh/version/compatibility_check_level.hpp"
 #include "iceoryx_posh/version/version_info.hpp"
 #include "iox/list.hpp"
 #include "iox/posix_user.hpp"
+#include "iox/vector.hpp"
 
 #include <cstdint>
 #include <ctime>
+#include <unordered_map>
 
 namespace iox
 {
@@ -49,6 +53,7 @@ class ProcessManager : public ProcessManagerInterface
   public:
     using ProcessList_t = iox::list<Process, MAX_PROCESS_NUMBER>;
     using PortConfigInfo = iox::runtime::PortConfigInfo;
+    using PortRequestList_t = vector<runtime::PortRequest, MAX_PORT_REQUESTS_PER_BATCH>;
 
     enum class TerminationFeedback
     {
@@ -146,10 +151,21 @@ class ProcessManager : public ProcessManagerInterface
 
     void addConditionVariableForProcess(const RuntimeName_t& runtimeName) noexcept;
 
+    /// @brief Adds the publishers, subscribers and condition variables of a batched port request to the process and
+    /// sends all of them to the OS process with a single CREATE_PORTS_ACK response
+    /// @param[in] name is the name of the runtime requesting the ports
+    /// @param[in] portRequests are the requested ports; the response contains the port or the error of each request
+    /// in the same order
+    void addPortsForProcess(const RuntimeName_t& name, const PortRequestList_t& portRequests) noexcept;
+
     void initIntrospection(ProcessIntrospectionType* processIntrospection) noexcept;
 
     void run() noexcept;
 
+    /// @brief Handles only the ports which notified the discovery loop, see PortManager::doDiscoveryForNotifiedPorts
+    /// @param[in] notifications the notification indices of the discovery ConditionVariableData
+    void discoveryUpdateForNotifiedPorts(const popo::ConditionListener::NotificationVector_t& notifications) noexcept;
+
     popo::PublisherPortData* addIntrospectionPublisherPort(const capro::ServiceDescription& service) noexcept;
 
     /// @brief Notify the application that it sent an unsupported message
@@ -159,6 +175,20 @@ class ProcessManager : public ProcessManagerInterface
   private:
     optional<Process*> findProcess(const RuntimeName_t& name) noexcept;
 
+    /// @brief Creates the port or condition variable for the process
+    /// @return the response for the OS process with the port or the error
+    runtime::IpcMessage createSubscriberForProcess(Process& process,
+                                                   const capro::ServiceDescription& service,
+                                                   const popo::SubscriberOptions& subscriberOptions,
+                                                   const PortConfigInfo& portConfigInfo) noexcept;
+
+    runtime::IpcMessage createPublisherForProcess(Process& process,
+                                                  const capro::ServiceDescription& service,
+                                                  const popo::PublisherOptions& publisherOptions,
+                                                  const PortConfigInfo& portConfigInfo) noexcept;
+
+    runtime::IpcMessage createConditionVariableForProcess(Process& process) noexcept;
+
     void monitorProcesses() noexcept;
     void discoveryUpdate() noexcept override;
 
@@ -228,9 +258,14 @@ class ProcessManager : public ProcessManagerInterface
     mepoo::MemoryManager* m_introspectionMemoryManager{nullptr};
     segment_id_underlying_t m_mgmtSegmentId{UntypedRelativePointer::NULL_POINTER_ID};
     ProcessList_t m_processList;
+    // the index is updated together with the list; the threads of RouDi access the ProcessManager only via the
+    // smart_lock in RouDi, therefore the list and the index need no additional lock. The iterators of the list stay
+    // valid until the element is erased
+    std::unordered_map<RuntimeName_t, ProcessList_t::iterator, RuntimeNameHash> m_processIndex;
     ProcessIntrospectionType* m_processIntrospection{nullptr};
     version::CompatibilityCheckLevel m_compatibilityCheckLevel;
     HeartbeatPool* m_heartbeatPool;
+    runtime::RequestChannelPool* m_requestChannelPool{nullptr};
 };
 
 } // namespace roudi
@@ -22,7 +22,6 @@
 #include "iceoryx_posh/internal/roudi/introspection/mempool_introspection.hpp"
 #include "iceoryx_posh/internal/roudi/process_manager.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_creator.hpp"
-#include "iceoryx_posh/popo/user_trigger.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_interface.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_manager.hpp"
 #include "iceoryx_posh/roudi/roudi_app.hpp"
@@ -59,7 +58,7 @@ class RouDi
     void triggerDiscoveryLoopAndWaitToFinish(units::Duration timeout) noexcept;
 
   protected:
-    /// @brief Starts the thread processing messages from the runtimes
+    /// @brief Starts the threads processing messages from the runtimes via the IPC channel and the request channels
     /// Once this is done, applications can register and Roudi is fully operational.
     void startProcessRuntimeMessagesThread() noexcept;
 
@@ -79,6 +78,13 @@ class RouDi
                                               uid_t& userId,
                                               int64_t& transmissionTimestamp) noexcept;
 
+    /// @brief Parses the ports of a batched port request
+    /// @param[in] message is the CREATE_PORTS request whose ports start at the third entry
+    /// @param[out] portRequests are the parsed ports in the order of the request
+    /// @return true if all ports could be parsed, false if the request is malformed
+    bool parsePortRequests(const runtime::IpcMessage& message,
+                           ProcessManager::PortRequestList_t& portRequests) noexcept;
+
     /// @brief Handles the registration request from process
     /// @param [in] name of the process which wants to register at roudi; this is equal to the IPC channel name
     /// @param [in] pid is the host system process id
@@ -100,14 +106,18 @@ class RouDi
   private:
     void processRuntimeMessages(runtime::IpcInterfaceCreator&& roudiIpcInterface) noexcept;
 
+    void processRequestChannelMessages() noexcept;
+
     void monitorAndDiscoveryUpdate() noexcept;
 
+    void triggerDiscoveryLoop() noexcept;
+
     ScopeGuard m_unregisterRelativePtr{[] { UntypedRelativePointer::unregisterAll(); }};
     const config::RouDiConfig m_roudiConfig;
     std::atomic_bool m_runMonitoringAndDiscoveryThread;
     std::atomic_bool m_runHandleRuntimeMessageThread;
 
-    popo::UserTrigger m_discoveryLoopTrigger;
+    popo::ConditionVariableData* m_discoveryConditionVariableData{nullptr};
     optional<UnnamedSemaphore> m_discoveryFinishedSemaphore;
 
     const units::Duration m_runtimeMessagesThreadTimeout{100_ms};
@@ -129,6 +139,7 @@ class RouDi
   private:
     std::thread m_monitoringAndDiscoveryThread;
     std::thread m_handleRuntimeMessageThread;
+    std::thread m_handleRequestChannelMessageThread;
 
   protected:
     ProcessIntrospectionType m_processIntrospection;
@@ -0,0 +1,71 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_RUNTIME_RESOURCE_INDEX_HPP
+#define IOX_POSH_ROUDI_RUNTIME_RESOURCE_INDEX_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Provides the hash of a RuntimeName_t with the algorithm of the ServiceDescription hash
+struct RuntimeNameHash
+{
+    uint64_t operator()(const RuntimeName_t& runtimeName) const noexcept;
+};
+
+/// @brief Index from a RuntimeName_t to all resources of one kind which belong to this runtime. The PortManager uses
+///        it to release the resources of a runtime without scanning and comparing the whole port pool.
+/// @tparam Resource the type of the resource with a m_runtimeName member, e.g. PublisherPortData
+template <typename Resource>
+class RuntimeResourceIndex
+{
+  public:
+    using ResourceList_t = std::vector<Resource*>;
+
+    /// @brief Adds a resource to the index under the RuntimeName_t of the resource
+    /// @param[in] resource the resource to add
+    void add(Resource* const resource) noexcept;
+
+    /// @brief Removes a resource from the index
+    /// @param[in] resource the resource to remove
+    void remove(const Resource* const resource) noexcept;
+
+    /// @brief Returns all resources of the provided runtime in the order they were added
+    /// @param[in] runtimeName the name of the runtime to look up
+    /// @return the list of resources, which is empty if the runtime has no resources of this kind
+    const ResourceList_t& find(const RuntimeName_t& runtimeName) const noexcept;
+
+    /// @brief Returns the number of different runtimes in the index
+    uint64_t numberOfRuntimes() const noexcept;
+
+  private:
+    std::unordered_map<RuntimeName_t, ResourceList_t, RuntimeNameHash> m_resources;
+    ResourceList_t m_noResources;
+};
+
+} // namespace roudi
+} // namespace iox
+
+#include "iceoryx_posh/internal/roudi/runtime_resource_index.inl"
+
+#endif // IOX_POSH_ROUDI_RUNTIME_RESOURCE_INDEX_HPP
@@ -0,0 +1,74 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_RUNTIME_RESOURCE_INDEX_INL
+#define IOX_POSH_ROUDI_RUNTIME_RESOURCE_INDEX_INL
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/internal/roudi/runtime_resource_index.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace roudi
+{
+inline uint64_t RuntimeNameHash::operator()(const RuntimeName_t& runtimeName) const noexcept
+{
+    return capro::hashString(runtimeName.c_str(), runtimeName.size());
+}
+
+template <typename Resource>
+inline void RuntimeResourceIndex<Resource>::add(Resource* const resource) noexcept
+{
+    m_resources[resource->m_runtimeName].push_back(resource);
+}
+
+template <typename Resource>
+inline void RuntimeResourceIndex<Resource>::remove(const Resource* const resource) noexcept
+{
+    auto entry = m_resources.find(resource->m_runtimeName);
+    if (entry == m_resources.end())
+    {
+        return;
+    }
+
+    auto& resources = entry->second;
+    resources.erase(std::remove(resources.begin(), resources.end(), resource), resources.end());
+    if (resources.empty())
+    {
+        m_resources.erase(entry);
+    }
+}
+
+template <typename Resource>
+inline const typename RuntimeResourceIndex<Resource>::ResourceList_t&
+RuntimeResourceIndex<Resource>::find(const RuntimeName_t& runtimeName) const noexcept
+{
+    auto entry = m_resources.find(runtimeName);
+    return (entry == m_resources.end()) ? m_noResources : entry->second;
+}
+
+template <typename Resource>
+inline uint64_t RuntimeResourceIndex<Resource>::numberOfRuntimes() const noexcept
+{
+    return m_resources.size();
+}
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_RUNTIME_RESOURCE_INDEX_INL
@@ -0,0 +1,74 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_SERVICE_PORT_INDEX_HPP
+#define IOX_POSH_ROUDI_SERVICE_PORT_INDEX_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Provides the hash which is precomputed when a ServiceDescription is constructed
+struct ServiceDescriptionHash
+{
+    uint64_t operator()(const capro::ServiceDescription& service) const noexcept
+    {
+        return service.getHash();
+    }
+};
+
+/// @brief Index from a ServiceDescription to all ports of one kind with this ServiceDescription. The PortManager uses
+///        it to find the ports which match a CaPro message without scanning and comparing the whole port pool.
+/// @tparam PortData the type of the port data, e.g. PublisherPortData
+template <typename PortData>
+class ServicePortIndex
+{
+  public:
+    using PortList_t = std::vector<PortData*>;
+
+    /// @brief Adds a port to the index under the ServiceDescription of the port
+    /// @param[in] portData the port to add
+    void add(PortData* const portData) noexcept;
+
+    /// @brief Removes a port from the index
+    /// @param[in] portData the port to remove
+    void remove(const PortData* const portData) noexcept;
+
+    /// @brief Returns all ports with the provided ServiceDescription in the order they were added
+    /// @param[in] service the ServiceDescription to look up
+    /// @return the list of ports, which is empty if there is no port with this ServiceDescription
+    const PortList_t& find(const capro::ServiceDescription& service) const noexcept;
+
+    /// @brief Returns the number of different ServiceDescriptions in the index
+    uint64_t numberOfServices() const noexcept;
+
+  private:
+    std::unordered_map<capro::ServiceDescription, PortList_t, ServiceDescriptionHash> m_ports;
+    PortList_t m_noPorts;
+};
+
+} // namespace roudi
+} // namespace iox
+
+#include "iceoryx_posh/internal/roudi/service_port_index.inl"
+
+#endif // IOX_POSH_ROUDI_SERVICE_PORT_INDEX_HPP
@@ -0,0 +1,68 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_SERVICE_PORT_INDEX_INL
+#define IOX_POSH_ROUDI_SERVICE_PORT_INDEX_INL
+
+#include "iceoryx_posh/internal/roudi/service_port_index.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace roudi
+{
+template <typename PortData>
+inline void ServicePortIndex<PortData>::add(PortData* const portData) noexcept
+{
+    m_ports[portData->m_serviceDescription].push_back(portData);
+}
+
+template <typename PortData>
+inline void ServicePortIndex<PortData>::remove(const PortData* const portData) noexcept
+{
+    auto entry = m_ports.find(portData->m_serviceDescription);
+    if (entry == m_ports.end())
+    {
+        return;
+    }
+
+    auto& ports = entry->second;
+    ports.erase(std::remove(ports.begin(), ports.end(), portData), ports.end());
+    if (ports.empty())
+    {
+        m_ports.erase(entry);
+    }
+}
+
+template <typename PortData>
+inline const typename ServicePortIndex<PortData>::PortList_t&
+ServicePortIndex<PortData>::find(const capro::ServiceDescription& service) const noexcept
+{
+    auto entry = m_ports.find(service);
+    return (entry == m_ports.end()) ? m_noPorts : entry->second;
+}
+
+template <typename PortData>
+inline uint64_t ServicePortIndex<PortData>::numberOfServices() const noexcept
+{
+    return m_ports.size();
+}
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_SERVICE_PORT_INDEX_INL
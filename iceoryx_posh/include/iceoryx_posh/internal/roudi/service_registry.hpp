@@ -32,6 +32,51 @@ namespace iox
 {
 namespace roudi
 {
+/// @brief Hash indices over the entries of a ServiceRegistry. They are kept by RouDi only and are not part of the
+///        registry which is published to the ServiceDiscovery, see IndexedServiceRegistry.
+class ServiceRegistryIndex
+{
+  public:
+    ServiceRegistryIndex() noexcept = default;
+
+  private:
+    friend class ServiceRegistry;
+
+    static constexpr uint32_t NO_INDEX = SERVICE_REGISTRY_CAPACITY;
+    static constexpr uint32_t NUMBER_OF_BUCKETS = SERVICE_REGISTRY_CAPACITY;
+
+    /// @brief Chains the indices of all entries whose key hash falls into the same bucket. The chains are sorted by
+    ///        index, therefore a search returns the entries in the same order as a search over the whole container.
+    class HashIndex
+    {
+      public:
+        HashIndex() noexcept;
+
+        void insert(const uint64_t hash, const uint32_t index) noexcept;
+        void remove(const uint64_t hash, const uint32_t index) noexcept;
+
+        uint32_t first(const uint64_t hash) const noexcept;
+        uint32_t next(const uint32_t index) const noexcept;
+        uint32_t chainLength(const uint64_t hash) const noexcept;
+
+      private:
+        static uint32_t bucket(const uint64_t hash) noexcept;
+
+      private:
+        uint32_t m_head[NUMBER_OF_BUCKETS];
+        uint32_t m_chainLength[NUMBER_OF_BUCKETS];
+        uint32_t m_next[SERVICE_REGISTRY_CAPACITY];
+    };
+
+    void insert(const capro::ServiceDescription& serviceDescription, const uint32_t index) noexcept;
+    void remove(const capro::ServiceDescription& serviceDescription, const uint32_t index) noexcept;
+
+    HashIndex m_serviceDescriptionIndex;
+    HashIndex m_serviceIndex;
+    HashIndex m_instanceIndex;
+    HashIndex m_eventIndex;
+};
+
 class ServiceRegistry
 {
   public:
@@ -100,12 +145,16 @@ class ServiceRegistry
     /// @return true when the registry changed since the last call, false otherwise
     bool hasDataChangedSinceLastCall() noexcept;
 
+    /// @brief Returns the number of changes of the registry since its construction. Since the changes are
+    ///        deterministic, two registries with the same change counter which received the same sequence of
+    ///        operations have the same content.
+    uint64_t changeCounter() const noexcept;
+
   private:
     using Entry_t = optional<ServiceDescriptionEntry>;
     using ServiceDescriptionContainer_t = vector<Entry_t, CAPACITY>;
 
     static constexpr uint32_t NO_INDEX = CAPACITY;
-
     ServiceDescriptionContainer_t m_serviceDescriptions;
 
     // store the last known free Index (if any is known)
@@ -114,13 +163,87 @@ class ServiceRegistry
     uint32_t m_freeIndex{NO_INDEX};
 
     bool m_dataChanged{true}; // initially true in order to also get notified of the empty registry
+    uint64_t m_changeCounter{0U};
 
   private:
-    uint32_t findIndex(const capro::ServiceDescription& serviceDescription) const noexcept;
+    friend class IndexedServiceRegistry;
 
+    // the operations below maintain the given index when it is not a nullptr
+    uint32_t findIndex(const capro::ServiceDescription& serviceDescription,
+                       const ServiceRegistryIndex* const index) const noexcept;
+
+    void emplaceEntry(const uint32_t slot,
+                      const capro::ServiceDescription& serviceDescription,
+                      ReferenceCounter_t ServiceDescriptionEntry::*count,
+                      ServiceRegistryIndex* const index) noexcept;
+    void resetEntry(const uint32_t slot, ServiceRegistryIndex* const index) noexcept;
+    void markChanged() noexcept;
 
     expected<void, Error> add(const capro::ServiceDescription& serviceDescription,
-                              ReferenceCounter_t ServiceDescriptionEntry::*count);
+                              ReferenceCounter_t ServiceDescriptionEntry::*count,
+                              ServiceRegistryIndex* const index);
+    void remove(const capro::ServiceDescription& serviceDescription,
+                ReferenceCounter_t ServiceDescriptionEntry::*count,
+                ServiceRegistryIndex* const index) noexcept;
+    void purge(const capro::ServiceDescription& serviceDescription, ServiceRegistryIndex* const index) noexcept;
+    void find(const optional<capro::IdString_t>& service,
+              const optional<capro::IdString_t>& instance,
+              const optional<capro::IdString_t>& event,
+              function_ref<void(const ServiceDescriptionEntry&)> callable,
+              const ServiceRegistryIndex* const index) const noexcept;
+};
+
+/// @brief The ServiceRegistry of RouDi. It looks up the entries via hash indices which are kept next to the registry,
+///        therefore only the plain ServiceRegistry is copied into the chunks for the ServiceDiscovery.
+class IndexedServiceRegistry
+{
+  public:
+    using Error = ServiceRegistry::Error;
+    using ServiceDescriptionEntry = ServiceRegistry::ServiceDescriptionEntry;
+
+    static constexpr uint32_t CAPACITY = ServiceRegistry::CAPACITY;
+
+    /// @copydoc ServiceRegistry::addPublisher
+    expected<void, Error> addPublisher(const capro::ServiceDescription& serviceDescription) noexcept;
+
+    /// @copydoc ServiceRegistry::removePublisher
+    void removePublisher(const capro::ServiceDescription& serviceDescription) noexcept;
+
+    /// @copydoc ServiceRegistry::addServer
+    expected<void, Error> addServer(const capro::ServiceDescription& serviceDescription) noexcept;
+
+    /// @copydoc ServiceRegistry::removeServer
+    void removeServer(const capro::ServiceDescription& serviceDescription) noexcept;
+
+    /// @copydoc ServiceRegistry::purge
+    void purge(const capro::ServiceDescription& serviceDescription) noexcept;
+
+    /// @brief Searches for given service description in registry. Only the entries which share the hash bucket of the
+    ///        most selective provided string are visited, a search with wildcards only visits all entries
+    /// @param[in] service, string or wildcard (= iox::nullopt) to search for
+    /// @param[in] instance, string or wildcard (= iox::nullopt) to search for
+    /// @param[in] event, string or wildcard (= iox::nullopt) to search for
+    /// @param[in] callable, callable to apply to each matching entry
+    void find(const optional<capro::IdString_t>& service,
+              const optional<capro::IdString_t>& instance,
+              const optional<capro::IdString_t>& event,
+              function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept;
+
+    /// @copydoc ServiceRegistry::forEach
+    void forEach(function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept;
+
+    /// @copydoc ServiceRegistry::hasDataChangedSinceLastCall
+    bool hasDataChangedSinceLastCall() noexcept;
+
+    /// @copydoc ServiceRegistry::changeCounter
+    uint64_t changeCounter() const noexcept;
+
+    /// @brief Returns the registry without the indices, e.g. to publish it
+    const ServiceRegistry& registry() const noexcept;
+
+  private:
+    ServiceRegistry m_registry;
+    ServiceRegistryIndex m_index;
 };
 
 } // namespace roudi
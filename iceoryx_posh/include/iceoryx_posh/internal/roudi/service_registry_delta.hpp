@@ -0,0 +1,109 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_SERVICE_REGISTRY_DELTA_HPP
+#define IOX_POSH_ROUDI_SERVICE_REGISTRY_DELTA_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iox/vector.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief The operations on the ServiceRegistry between two publications of the PortManager. Since the
+///        ServiceRegistry is deterministic, replaying the operations on a copy which is at the previous change
+///        counter results in the same content as the registry of RouDi. The ServiceDiscovery therefore only needs the
+///        full registry snapshot when it joins late or when it missed a delta.
+class ServiceRegistryDelta
+{
+  public:
+    /// @brief Maximum number of operations in one delta; if more operations accumulate between two publications the
+    ///        delta becomes incomplete and a snapshot is published instead
+    static constexpr uint32_t CAPACITY{16U};
+
+    /// @brief A snapshot is published at least with every SNAPSHOT_INTERVAL-th publication. It is also the history
+    ///        capacity of the delta publisher, which enables late joiners to catch up from the last snapshot.
+    static constexpr uint32_t SNAPSHOT_INTERVAL{8U};
+
+    /// @brief Queue capacity of the subscribers of the deltas
+    static constexpr uint32_t QUEUE_CAPACITY{2U * SNAPSHOT_INTERVAL};
+
+    enum class Operation : uint8_t
+    {
+        ADD_PUBLISHER,
+        REMOVE_PUBLISHER,
+        ADD_SERVER,
+        REMOVE_SERVER,
+    };
+
+    struct Change
+    {
+        Change(const Operation operation, const capro::ServiceDescription& serviceDescription) noexcept;
+
+        Operation operation;
+        capro::ServiceDescription serviceDescription;
+    };
+
+    /// @brief Creates an empty delta for a registry with the provided change counter
+    /// @param[in] previousChangeCounter the change counter of the registry before the first operation of this delta
+    explicit ServiceRegistryDelta(const uint64_t previousChangeCounter) noexcept;
+
+    /// @brief Discards all operations and starts a new delta
+    /// @param[in] previousChangeCounter the change counter of the registry before the first operation of this delta
+    void reset(const uint64_t previousChangeCounter) noexcept;
+
+    /// @brief Records an operation which was performed on the registry
+    /// @param[in] operation the operation
+    /// @param[in] serviceDescription the argument of the operation
+    /// @return false if the delta is full; the delta is incomplete afterwards
+    bool record(const Operation operation, const capro::ServiceDescription& serviceDescription) noexcept;
+
+    /// @brief Sets the change counter of the registry after the last operation of this delta
+    void setChangeCounter(const uint64_t changeCounter) noexcept;
+
+    /// @brief Returns the change counter of the registry before the first operation of this delta
+    uint64_t previousChangeCounter() const noexcept;
+
+    /// @brief Returns the change counter of the registry after the last operation of this delta
+    uint64_t changeCounter() const noexcept;
+
+    /// @brief Returns true if all operations are recorded, false if the delta overflowed and a snapshot is needed
+    bool isComplete() const noexcept;
+
+    /// @brief Returns the recorded operations in the order in which they were performed
+    const vector<Change, CAPACITY>& changes() const noexcept;
+
+    /// @brief Applies the operations to a copy of the registry
+    /// @param[in] registry the registry to update
+    /// @return true if the delta was applied, false if the delta is incomplete or the registry is not at the
+    ///         previous change counter of the delta; the registry is not modified in this case
+    bool applyTo(ServiceRegistry& registry) const noexcept;
+
+  private:
+    uint64_t m_previousChangeCounter{0U};
+    uint64_t m_changeCounter{0U};
+    bool m_isComplete{true};
+    vector<Change, CAPACITY> m_changes;
+};
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_SERVICE_REGISTRY_DELTA_HPP
@@ -38,10 +38,15 @@ class Heartbeat
     /// @brief Get the elapsed milliseconds since the last heartbeat
     uint64_t elapsed_milliseconds_since_last_beat() const noexcept;
 
+    /// @brief Get the elapsed milliseconds since the last heartbeat relative to a timestamp which was acquired with
+    /// 'milliseconds_since_epoch'; this allows to check many heartbeats with a single clock read
+    /// @param[in] now_milliseconds the current timestamp
+    uint64_t elapsed_milliseconds_since_last_beat(const uint64_t now_milliseconds) const noexcept;
+
     /// @brief Update the heartbeat timestamp
     void beat() noexcept;
 
-  private:
+    /// @brief Get the timestamp of the monotonic clock which is used for the heartbeats
     static uint64_t milliseconds_since_epoch() noexcept;
 
   private:
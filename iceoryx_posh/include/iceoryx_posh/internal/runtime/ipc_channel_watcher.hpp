@@ -0,0 +1,58 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_RUNTIME_IPC_CHANNEL_WATCHER_HPP
+#define IOX_POSH_RUNTIME_IPC_CHANNEL_WATCHER_HPP
+
+#include "iox/duration.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace runtime
+{
+/// @brief Blocks until a file is created in the directory of the IPC channels, e.g. when RouDi creates its channel.
+///        This allows an application to register immediately when RouDi is started after the application. Where
+///        the file system cannot be watched, it falls back to sleeping for the timeout.
+class IpcChannelWatcher
+{
+  public:
+    /// @brief Starts to watch the directory of the IPC channels; files created afterwards wake up waitForChange
+    IpcChannelWatcher() noexcept;
+    ~IpcChannelWatcher() noexcept;
+
+    IpcChannelWatcher(const IpcChannelWatcher&) = delete;
+    IpcChannelWatcher(IpcChannelWatcher&&) = delete;
+    IpcChannelWatcher& operator=(const IpcChannelWatcher&) = delete;
+    IpcChannelWatcher& operator=(IpcChannelWatcher&&) = delete;
+
+    /// @brief Returns when a file was created in the directory of the IPC channels or when the timeout has passed
+    /// @param[in] timeout the maximum time to wait
+    void waitForChange(const units::Duration timeout) noexcept;
+
+    /// @brief Returns true when the directory is watched and false when waitForChange sleeps for the timeout
+    bool isWatching() const noexcept;
+
+  private:
+    static constexpr int32_t INVALID_FILE_DESCRIPTOR{-1};
+    int32_t m_fileDescriptor{INVALID_FILE_DESCRIPTOR};
+};
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_IPC_CHANNEL_WATCHER_HPP
@@ -86,6 +86,8 @@ enum class IpcMessageType : int32_t
     WAKEUP_TRIGGER,
     REPLAY,
     MESSAGE_NOT_SUPPORTED,
+    CREATE_PORTS, // batched request for publishers, subscribers and condition variables
+    CREATE_PORTS_ACK,
     // etc..
     END,
 };
@@ -17,11 +17,12 @@
 #ifndef IOX_POSH_RUNTIME_IPC_MESSAGE_HPP
 #define IOX_POSH_RUNTIME_IPC_MESSAGE_HPP
 
+#include "iox/detail/convert.hpp"
 #include "iox/logging.hpp"
 
 #include <cstdint>
-#include <sstream>
 #include <string>
+#include <vector>
 
 namespace iox
 {
@@ -109,7 +110,7 @@ class IpcMessage
     /// @brief Adds a new entry to the IpcMessage, if the entry is invalid
     ///         no entry is added and the IpcMessage becomes invalid.
     /// @tparam Datatype which is convertable to string via
-    /// std::stringstream
+    /// convert::toString
     /// @param[in] entry to add to the message
     template <typename T>
     void addEntry(const T& entry) noexcept;
@@ -118,11 +119,15 @@ class IpcMessage
     /// @param rhs IpcMessage to compare with
     bool operator==(const IpcMessage& rhs) const noexcept;
 
+  private:
+    void appendEntry(const std::string& entry) noexcept;
+
   private:
     static const char m_separator; // default value is ,
     std::string m_msg;
     bool m_isValid{true};
-    uint32_t m_numberOfElements{0};
+    // the start positions of the entries in m_msg; an entry ends right before the start of the next one
+    std::vector<std::string::size_type> m_entryPositions;
 };
 
 } // namespace runtime
@@ -26,19 +26,7 @@ namespace runtime
 template <typename T>
 void IpcMessage::addEntry(const T& entry) noexcept
 {
-    std::stringstream newEntry;
-    newEntry << entry;
-
-    if (!isValidEntry(newEntry.str()))
-    {
-        IOX_LOG(ERROR, "\'" << newEntry.str().c_str() << "\' is an invalid IPC channel entry");
-        m_isValid = false;
-    }
-    else
-    {
-        m_msg.append(newEntry.str() + m_separator);
-        ++m_numberOfElements;
-    }
+    appendEntry(convert::toString(entry));
 }
 
 template <typename T>
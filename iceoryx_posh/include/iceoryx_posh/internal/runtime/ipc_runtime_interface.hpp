@@ -20,6 +20,7 @@
 
 #include "iceoryx_posh/internal/runtime/ipc_interface_creator.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
+#include "iceoryx_posh/internal/runtime/request_channel.hpp"
 #include "iox/expected.hpp"
 #include "iox/optional.hpp"
 
@@ -55,12 +56,17 @@ class IpcRuntimeInterface
     IpcRuntimeInterface(const IpcRuntimeInterface&) = delete;
     IpcRuntimeInterface& operator=(const IpcRuntimeInterface&) = delete;
 
-    /// @brief send a request to the RouDi daemon
+    /// @brief send a request to the RouDi daemon; the request is sent via the request channel in the management segment
+    /// if one is used, except for the termination request which is always sent via the IPC channel
     /// @param[in] msg request to RouDi
     /// @param[out] answer response from RouDi
     /// @return true if communication was successful, false if not
     bool sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answer) noexcept;
 
+    /// @brief get the maximum size of a request to RouDi and of its response, including the terminating null character
+    /// @return the message size of the request channel if one is used, otherwise the one of the IPC channels
+    uint64_t getMaxMessageSize() const noexcept;
+
     /// @brief get the adress offset of the segment manager
     /// @return address offset as iox::RelativePointer::offset_t
     UntypedRelativePointer::offset_t getSegmentManagerAddressOffset() const noexcept;
@@ -77,6 +83,14 @@ class IpcRuntimeInterface
     /// @return relative pointer offset for the heartbeat or 'nullopt' if monitoring is disabled
     optional<UntypedRelativePointer::offset_t> getHeartbeatAddressOffset() const noexcept;
 
+    /// @brief Access the relative pointer offset for the request channel
+    /// @return relative pointer offset for the request channel or 'nullopt' if RouDi did not provide one
+    optional<UntypedRelativePointer::offset_t> getRequestChannelAddressOffset() const noexcept;
+
+    /// @brief Sends all further requests except the termination request via the request channel
+    /// @param[in] requestChannel is the request channel of this runtime in the management segment
+    void useRequestChannel(RequestChannel& requestChannel) noexcept;
+
   private:
     struct MgmtShmCharacteristics
     {
@@ -84,6 +98,7 @@ class IpcRuntimeInterface
         uint64_t segmentId{0U};
         UntypedRelativePointer::offset_t segmentManagerAddressOffset{UntypedRelativePointer::NULL_POINTER_OFFSET};
         optional<UntypedRelativePointer::offset_t> heartbeatAddressOffset;
+        optional<UntypedRelativePointer::offset_t> requestChannelAddressOffset;
     };
 
     enum class RegAckResult
@@ -107,6 +122,7 @@ class IpcRuntimeInterface
     IpcInterfaceCreator m_AppIpcInterface;
     IpcInterfaceUser m_RoudiIpcInterface;
     MgmtShmCharacteristics m_mgmtShmCharacteristics;
+    RequestChannel* m_requestChannel{nullptr};
 };
 
 } // namespace runtime
@@ -25,6 +25,10 @@
 #include "iox/optional.hpp"
 #include "iox/smart_lock.hpp"
 
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 namespace iox::posh::experimental
 {
 class Node;
@@ -82,6 +86,9 @@ class PoshRuntimeImpl : public PoshRuntime
     /// @copydoc PoshRuntime::getMiddlewareConditionVariable
     popo::ConditionVariableData* getMiddlewareConditionVariable() noexcept override;
 
+    /// @copydoc PoshRuntime::requestPorts
+    void requestPorts(const PortRequests& portRequests) noexcept override;
+
     /// @copydoc PoshRuntime::sendRequestToRouDi
     bool sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answer) noexcept override;
 
@@ -99,6 +106,23 @@ class PoshRuntimeImpl : public PoshRuntime
                     std::pair<IpcRuntimeInterface, optional<SharedMemoryUser>>&& interfaces) noexcept;
 
   private:
+    IpcMessage createPublisherRequest(const capro::ServiceDescription& service,
+                                      const popo::PublisherOptions& publisherOptions,
+                                      const PortConfigInfo& portConfigInfo) const noexcept;
+
+    IpcMessage createSubscriberRequest(const capro::ServiceDescription& service,
+                                       const popo::SubscriberOptions& subscriberOptions,
+                                       const PortConfigInfo& portConfigInfo) const noexcept;
+
+    IpcMessage createConditionVariableRequest() const noexcept;
+
+    /// @brief Sends the single port requests as one CREATE_PORTS request and keeps the created ports until they are
+    /// taken with takeRequestedPort
+    void requestPortsFromRoudi(const std::vector<IpcMessage>& requests) noexcept;
+
+    /// @brief Takes a port which was created by requestPorts for the same single port request
+    optional<void*> takeRequestedPort(const IpcMessage& request) noexcept;
+
     expected<PublisherPortUserType::MemberType_t*, IpcMessageErrorType>
     requestPublisherFromRoudi(const IpcMessage& sendBuffer) noexcept;
 
@@ -121,6 +145,9 @@ class PoshRuntimeImpl : public PoshRuntime
     concurrent::smart_lock<IpcRuntimeInterface> m_ipcChannelInterface;
     optional<SharedMemoryUser> m_ShmInterface;
 
+    // the ports created by requestPorts which are not yet handed out; the key is the single port request
+    concurrent::smart_lock<std::unordered_multimap<std::string, void*>> m_requestedPorts;
+
     optional<Heartbeat*> m_heartbeat;
     void sendKeepAliveAndHandleShutdownPreparation() noexcept;
 
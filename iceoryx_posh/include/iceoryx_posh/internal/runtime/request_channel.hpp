@@ -0,0 +1,154 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_RUNTIME_REQUEST_CHANNEL_HPP
+#define IOX_POSH_RUNTIME_REQUEST_CHANNEL_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_message.hpp"
+#include "iox/detail/mpmc_lockfree_queue.hpp"
+#include "iox/duration.hpp"
+#include "iox/optional.hpp"
+#include "iox/relative_pointer.hpp"
+#include "iox/unnamed_semaphore.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace runtime
+{
+class RequestChannelPool;
+
+/// @brief The request channel of an application in the management segment. It transfers a request to RouDi and the
+/// response back to the application without a round trip over the IPC channel. There is at most one request in flight
+/// per channel, i.e. the application must wait for the response before it sends the next request.
+class RequestChannel
+{
+  public:
+    RequestChannel() noexcept;
+
+    RequestChannel(const RequestChannel&) = delete;
+    RequestChannel(RequestChannel&&) = delete;
+
+    RequestChannel& operator=(const RequestChannel&) = delete;
+    RequestChannel& operator=(RequestChannel&&) = delete;
+
+    /// @brief Used by the application to send a request to RouDi and to wait for the response
+    /// @param[in] request which is sent to RouDi
+    /// @param[out] answer is the response of RouDi; it is empty if RouDi did not respond to the request
+    /// @param[in] timeout is the maximum time to wait for the response; the request is withdrawn when it expires
+    /// @return true if the request was transferred and the response was received, false otherwise, e.g. when another
+    /// request is in flight or RouDi did not respond in time
+    bool sendRequest(const IpcMessage& request,
+                     IpcMessage& answer,
+                     const units::Duration timeout = PROCESS_REQUEST_RESPONSE_TIMEOUT) noexcept;
+
+    /// @brief Used by RouDi to take the pending request of the application
+    /// @return the request or an empty optional if there is no pending request
+    optional<IpcMessage> takeRequest() noexcept;
+
+    /// @brief Used by RouDi to send the response to the request which was taken with 'takeRequest'
+    /// @param[in] response which is sent to the application
+    /// @return true if the response was sent, false if no request is processed or the response does not fit into the
+    /// channel
+    bool sendResponse(const IpcMessage& response) noexcept;
+
+    /// @brief Used by RouDi after a request was processed; an empty response is sent if there was no response to the
+    /// request, in order to not block the application forever
+    void finishRequest() noexcept;
+
+    /// @brief The name of the runtime which owns the channel
+    const RuntimeName_t& getRuntimeName() const noexcept;
+
+  private:
+    friend class RequestChannelPool;
+
+    enum class State : uint8_t
+    {
+        IDLE,
+        WRITING_REQUEST,
+        REQUEST_PENDING,
+        PROCESSING_REQUEST,
+        REQUEST_ABANDONED,
+        RESPONSE_PENDING
+    };
+
+    static bool copyMessage(const IpcMessage& message, char* const destination, const uint64_t capacity) noexcept;
+
+    /// @brief Withdraws the pending request or abandons it if it is already processed by RouDi
+    /// @return true if the request was withdrawn or abandoned, false if the response is already pending
+    bool withdrawRequest() noexcept;
+
+    /// @brief Resets the channel to idle if the application abandoned the request
+    /// @return true if the request was abandoned, false otherwise
+    bool resetAbandonedRequest() noexcept;
+
+    RelativePointer<RequestChannelPool> m_pool;
+    uint32_t m_index{0U};
+    RuntimeName_t m_runtimeName;
+    std::atomic<State> m_state{State::IDLE};
+    optional<UnnamedSemaphore> m_responseSemaphore;
+    char m_request[REQUEST_CHANNEL_MESSAGE_SIZE]{};
+    char m_response[REQUEST_CHANNEL_MESSAGE_SIZE]{};
+};
+
+/// @brief Contains the request channels of all applications and the queue with the indices of the channels with a
+/// pending request. RouDi acquires a channel when an application registers and releases it when the application is
+/// removed. The channels are never destroyed while RouDi is running, therefore an outdated index in the queue refers to
+/// a channel which is either released or does not have a pending request and is just skipped.
+class RequestChannelPool
+{
+  public:
+    RequestChannelPool() noexcept;
+
+    RequestChannelPool(const RequestChannelPool&) = delete;
+    RequestChannelPool(RequestChannelPool&&) = delete;
+
+    RequestChannelPool& operator=(const RequestChannelPool&) = delete;
+    RequestChannelPool& operator=(RequestChannelPool&&) = delete;
+
+    /// @brief Acquires a request channel for an application
+    /// @param[in] runtimeName of the application which owns the channel
+    /// @return the channel or an empty optional if all channels are in use
+    optional<RequestChannel*> acquire(const RuntimeName_t& runtimeName) noexcept;
+
+    /// @brief Releases a channel which was acquired with 'acquire'
+    /// @param[in] channel to release
+    void release(RequestChannel& channel) noexcept;
+
+    /// @brief Used by RouDi to wait until an application sent a request
+    /// @param[in] timeout is the maximum time to wait
+    /// @return the channel with the pending request or an empty optional if the timeout has passed
+    optional<RequestChannel*> waitForRequest(const units::Duration timeout) noexcept;
+
+  private:
+    friend class RequestChannel;
+
+    bool notifyRequest(const uint32_t index) noexcept;
+
+    RequestChannel m_channels[MAX_PROCESS_NUMBER];
+    // only accessed by RouDi with the lock of the ProcessManager
+    bool m_isInUse[MAX_PROCESS_NUMBER]{};
+    concurrent::MpmcLockFreeQueue<uint32_t, MAX_PROCESS_NUMBER> m_pendingRequests;
+    optional<UnnamedSemaphore> m_requestSemaphore;
+};
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_REQUEST_CHANNEL_HPP
@@ -0,0 +1,115 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_RUNTIME_SERVICE_REGISTRY_VIEW_HPP
+#define IOX_POSH_RUNTIME_SERVICE_REGISTRY_VIEW_HPP
+
+#include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry_delta.hpp"
+#include "iceoryx_posh/popo/sample.hpp"
+#include "iox/function_ref.hpp"
+#include "iox/optional.hpp"
+#include "iox/vector.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace runtime
+{
+/// @brief Read-only view of the ServiceRegistry of RouDi for the ServiceDiscovery. The view holds only the latest
+///        registry snapshot sample and searches it in place instead of copying it; the sample is replaced as soon as a
+///        newer snapshot is taken. The deltas which are published after the snapshot are kept in a small overlay with
+///        the resulting counts of the changed services.
+/// @note When the overlay cannot hold the changes, e.g. when RouDi could not publish a snapshot for a while, the delta
+///       is not applied and the view keeps its state until the next snapshot arrives.
+class ServiceRegistryView
+{
+  public:
+    using Snapshot_t = popo::Sample<const roudi::ServiceRegistry>;
+
+    /// @brief Number of services which can be changed by the deltas on top of one snapshot; RouDi publishes a snapshot
+    ///        at least with every SNAPSHOT_INTERVAL-th delta
+    static constexpr uint32_t OVERLAY_CAPACITY{roudi::ServiceRegistryDelta::SNAPSHOT_INTERVAL
+                                               * roudi::ServiceRegistryDelta::CAPACITY};
+
+    ServiceRegistryView() noexcept = default;
+
+    ServiceRegistryView(const ServiceRegistryView&) = delete;
+    ServiceRegistryView(ServiceRegistryView&&) = delete;
+    ServiceRegistryView& operator=(const ServiceRegistryView&) = delete;
+    ServiceRegistryView& operator=(ServiceRegistryView&&) = delete;
+    ~ServiceRegistryView() noexcept = default;
+
+    /// @brief Returns the change counter of the registry of RouDi which is represented by the view
+    uint64_t changeCounter() const noexcept;
+
+    /// @brief Replaces the content of the view with a registry snapshot; the previous snapshot is released
+    /// @param[in] snapshot the sample with the registry snapshot
+    void setSnapshot(Snapshot_t&& snapshot) noexcept;
+
+    /// @brief Applies a delta to the view
+    /// @param[in] delta the delta to apply
+    /// @return true if the delta was applied, false if the delta is incomplete, the view is not at the previous
+    ///         change counter of the delta or the overlay cannot hold the changes; the view is not modified in these
+    ///         cases
+    bool apply(const roudi::ServiceRegistryDelta& delta) noexcept;
+
+    /// @brief Searches for the service description in the view, see ServiceRegistry::find
+    /// @param[in] service, string or wildcard (= iox::nullopt) to search for
+    /// @param[in] instance, string or wildcard (= iox::nullopt) to search for
+    /// @param[in] event, string or wildcard (= iox::nullopt) to search for
+    /// @param[in] callable, callable to apply to each matching entry
+    void find(const optional<capro::IdString_t>& service,
+              const optional<capro::IdString_t>& instance,
+              const optional<capro::IdString_t>& event,
+              function_ref<void(const roudi::ServiceRegistry::ServiceDescriptionEntry&)> callable) const noexcept;
+
+  private:
+    using ReferenceCounter_t = roudi::ServiceRegistry::ReferenceCounter_t;
+
+    struct OverlayEntry
+    {
+        OverlayEntry(const roudi::ServiceRegistry::ServiceDescriptionEntry& snapshotEntry) noexcept;
+
+        bool isInSnapshot() const noexcept;
+        bool isInView() const noexcept;
+
+        roudi::ServiceRegistry::ServiceDescriptionEntry entry;
+        ReferenceCounter_t snapshotPublisherCount{0U};
+        ReferenceCounter_t snapshotServerCount{0U};
+    };
+
+    /// @return the index of the overlay entry or the size of the overlay if there is none
+    uint64_t indexInOverlay(const capro::ServiceDescription& serviceDescription) const noexcept;
+    OverlayEntry& acquireOverlayEntry(const capro::ServiceDescription& serviceDescription) noexcept;
+
+    void add(const capro::ServiceDescription& serviceDescription,
+             ReferenceCounter_t roudi::ServiceRegistry::ServiceDescriptionEntry::*count) noexcept;
+    void remove(const capro::ServiceDescription& serviceDescription,
+                ReferenceCounter_t roudi::ServiceRegistry::ServiceDescriptionEntry::*count) noexcept;
+
+  private:
+    optional<Snapshot_t> m_snapshot;
+    vector<OverlayEntry, OVERLAY_CAPACITY> m_overlay;
+    uint64_t m_numberOfEntries{0U};
+    uint64_t m_changeCounter{0U};
+};
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_SERVICE_REGISTRY_VIEW_HPP
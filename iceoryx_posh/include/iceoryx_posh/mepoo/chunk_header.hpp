@@ -61,7 +61,10 @@ struct ChunkHeader
     ///            - data width of members changes
     ///            - members are rearranged
     ///            - semantic meaning of a member changes
-    static constexpr uint8_t CHUNK_HEADER_VERSION{2U};
+    static constexpr uint8_t CHUNK_HEADER_VERSION{3U};
+
+    /// @brief Publish timestamp of a chunk which was not sent by a ChunkSender
+    static constexpr uint64_t NO_PUBLISH_TIMESTAMP{0U};
 
     /// @brief User-Header id for no user-header
     static constexpr uint16_t NO_USER_HEADER{0x0000};
@@ -140,6 +143,15 @@ struct ChunkHeader
     /// @brief the serquence number of the chunk
     uint64_t sequenceNumber() const noexcept;
 
+    /// @brief The time at which the chunk was sent, taken from currentPublishTime()
+    /// @return the publish timestamp in nanoseconds or NO_PUBLISH_TIMESTAMP if the chunk was not sent
+    uint64_t publishTimestamp() const noexcept;
+
+    /// @brief The clock of the publish timestamp; it is monotonic and shared by all processes on the host, therefore
+    /// the difference to the publish timestamp is the time since the chunk was sent
+    /// @return the current time in nanoseconds
+    static uint64_t currentPublishTime() noexcept;
+
   private:
     template <typename T>
     friend class popo::ChunkSender;
@@ -148,6 +160,8 @@ struct ChunkHeader
 
     void setSequenceNumber(const uint64_t sequenceNumber) noexcept;
 
+    void setPublishTimestamp(const uint64_t publishTimestamp) noexcept;
+
     uint64_t overflowSafeUsedSizeOfChunk() const noexcept;
 
   private:
@@ -167,6 +181,8 @@ struct ChunkHeader
     // size of the whole chunk, including the header
     uint64_t m_chunkSize{0U};
     uint64_t m_userPayloadSize{0U};
+    uint64_t m_publishTimestamp{NO_PUBLISH_TIMESTAMP};
+    // the user-payload offset must stay the last member, it doubles as back-offset for an adjacent user-payload
     uint32_t m_userPayloadAlignment{1U};
     UserPayloadOffset_t m_userPayloadOffset{sizeof(ChunkHeader)};
 };
@@ -98,16 +98,31 @@ enum class ListenerError
 ///
 ///            Best practice: Detach a specific event only from one specific thread and not
 ///                           from multiple contexts.
-class Listener
+/// @note  Every event can be attached with a priority. When multiple events are active at the same time, the
+///        callbacks of the events with the higher priority are executed first. Events which become active while
+///        a batch of callbacks is executed are inserted into the batch according to their priority, therefore
+///        a high priority event does not have to wait until all low priority callbacks are executed. Under
+///        permanent load of high priority events, low priority events can starve.
+/// @param[in] Capacity the amount of events which can be attached to the Listener. The memory footprint of the
+///            Listener grows linearly with its capacity.
+template <uint64_t Capacity = MAX_NUMBER_OF_EVENTS_PER_LISTENER>
+class ListenerImpl
 {
+    static_assert(Capacity > 0U, "The Listener must have a capacity of at least one event");
+    static_assert(Capacity <= MAX_NUMBER_OF_EVENTS_PER_LISTENER,
+                  "The capacity of the Listener is limited by the number of notifiers of a condition variable");
+
   public:
-    Listener() noexcept;
-    Listener(const Listener&) = delete;
-    Listener(Listener&&) = delete;
-    ~Listener() noexcept;
+    using EventPriority_t = uint8_t;
+    static constexpr EventPriority_t DEFAULT_EVENT_PRIORITY{0U};
+
+    ListenerImpl() noexcept;
+    ListenerImpl(const ListenerImpl&) = delete;
+    ListenerImpl(ListenerImpl&&) = delete;
+    ~ListenerImpl() noexcept;
 
-    Listener& operator=(const Listener&) = delete;
-    Listener& operator=(Listener&&) = delete;
+    ListenerImpl& operator=(const ListenerImpl&) = delete;
+    ListenerImpl& operator=(ListenerImpl&&) = delete;
 
     /// @brief Attaches an event. Hereby the event is defined as a class T, the eventOrigin, an enum which further
     ///        defines the event inside the class and the corresponding callback which will be called when the event
@@ -120,6 +135,7 @@ class Listener
     /// @param[in] eventType enum required to specify the type of event inside of eventOrigin
     /// @param[in] eventCallback callback which will be executed concurrently when the event occurs. has to be created
     /// with iox::popo::createNotificationCallback
+    /// @param[in] priority callbacks of events with a higher priority are executed first
     /// @return If an error occurs the enum packed inside an expected which describes the error.
     template <typename T,
               typename EventType,
@@ -127,7 +143,8 @@ class Listener
               typename = std::enable_if_t<std::is_enum<EventType>::value>>
     expected<void, ListenerError> attachEvent(T& eventOrigin,
                                               const EventType eventType,
-                                              const NotificationCallback<T, ContextDataType>& eventCallback) noexcept;
+                                              const NotificationCallback<T, ContextDataType>& eventCallback,
+                                              const EventPriority_t priority = DEFAULT_EVENT_PRIORITY) noexcept;
 
     /// @brief Attaches an event. Hereby the event is defined as a class T, the eventOrigin and
     ///        the corresponding callback which will be called when the event occurs.
@@ -138,10 +155,12 @@ class Listener
     /// @param[in] eventOrigin the object which will signal the event (the origin)
     /// @param[in] eventCallback callback which will be executed concurrently when the event occurs. Has to be created
     /// with iox::popo::createNotificationCallback
+    /// @param[in] priority callbacks of events with a higher priority are executed first
     /// @return If an error occurs the enum packed inside an expected which describes the error.
     template <typename T, typename ContextDataType>
     expected<void, ListenerError> attachEvent(T& eventOrigin,
-                                              const NotificationCallback<T, ContextDataType>& eventCallback) noexcept;
+                                              const NotificationCallback<T, ContextDataType>& eventCallback,
+                                              const EventPriority_t priority = DEFAULT_EVENT_PRIORITY) noexcept;
 
     /// @brief Detaches an event. Hereby, the event is defined as a class T, the eventOrigin and
     ///        the eventType with further specifies the event inside of eventOrigin
@@ -167,19 +186,22 @@ class Listener
     uint64_t size() const noexcept;
 
   protected:
-    Listener(ConditionVariableData& conditionVariableData) noexcept;
+    ListenerImpl(ConditionVariableData& conditionVariableData) noexcept;
 
   private:
     class Event_t;
 
     void threadLoop() noexcept;
+    void executeCallbacksByPriority(ConditionListener::NotificationVector_t& activeNotificationIds) noexcept;
+    void sortByPriority(ConditionListener::NotificationVector_t& notificationIds) const noexcept;
     expected<uint32_t, ListenerError> addEvent(void* const origin,
                                                void* const userType,
                                                const uint64_t eventType,
                                                const uint64_t eventTypeHash,
                                                internal::GenericCallbackRef_t callback,
                                                internal::TranslationCallbackRef_t translationCallback,
-                                               const function<void(uint64_t)> invalidationCallback) noexcept;
+                                               const function<void(uint64_t)> invalidationCallback,
+                                               const EventPriority_t priority) noexcept;
 
     void removeTrigger(const uint64_t index) noexcept;
 
@@ -189,7 +211,7 @@ class Listener
         PLACEHOLDER = 0
     };
 
-    static constexpr uint32_t MAX_NUMBER_OF_EVENTS = MAX_NUMBER_OF_EVENTS_PER_LISTENER;
+    static constexpr uint32_t MAX_NUMBER_OF_EVENTS = static_cast<uint32_t>(Capacity);
 
     class IndexManager_t
     {
@@ -209,6 +231,8 @@ class Listener
 
     std::thread m_thread;
     concurrent::smart_lock<internal::Event_t, std::recursive_mutex> m_events[MAX_NUMBER_OF_EVENTS];
+    std::atomic<EventPriority_t> m_eventPriorities[MAX_NUMBER_OF_EVENTS]{};
+    std::atomic<uint64_t> m_numberOfPrioritizedEvents{0U};
     std::mutex m_addEventMutex;
 
     std::atomic_bool m_wasDtorCalled{false};
@@ -216,6 +240,9 @@ class Listener
     ConditionListener m_conditionListener;
 };
 
+/// @brief The Listener with the maximum capacity of MAX_NUMBER_OF_EVENTS_PER_LISTENER events
+using Listener = ListenerImpl<>;
+
 } // namespace popo
 } // namespace iox
 
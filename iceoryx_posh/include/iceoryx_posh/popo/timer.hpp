@@ -0,0 +1,108 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_TIMER_HPP
+#define IOX_POSH_POPO_TIMER_HPP
+
+#include "iceoryx_posh/internal/popo/building_blocks/timer_slot.hpp"
+#include "iceoryx_posh/popo/trigger_handle.hpp"
+#include "iox/duration.hpp"
+
+#include <mutex>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief A timer which can be attached to a WaitSet or Listener like any other event origin. It supports absolute
+///        deadlines and periodic deadlines which do not drift since every deadline is a whole number of periods
+///        after the first one. The deadlines are evaluated by the thread which waits on the WaitSet or Listener,
+///        therefore no additional thread and no additional context switch is required.
+/// @code
+///   iox::popo::Timer timer;
+///   waitset.attachEvent(timer).or_else([](auto) { /* handle error */ });
+///   timer.startPeriodic(100_ms);
+/// @endcode
+/// @note The points in time are measured with the monotonic clock, see Timer::now().
+/// @note Only MAX_NUMBER_OF_TIMERS_PER_CONDITION_VARIABLE timers can be armed per WaitSet or Listener.
+/// @note The readiness file descriptor of a WaitSet is not signalled by a timer; the expired timers are collected
+///       with the next WaitSet::tryWait() call.
+class Timer
+{
+  public:
+    Timer() noexcept;
+    ~Timer() noexcept;
+
+    Timer(const Timer& rhs) = delete;
+    Timer(Timer&& rhs) = delete;
+    Timer& operator=(const Timer& rhs) = delete;
+    Timer& operator=(Timer&& rhs) = delete;
+
+    /// @brief Fires once when the monotonic clock reaches the deadline
+    /// @param[in] deadline absolute point in time of the monotonic clock
+    void startAt(const units::Duration deadline) noexcept;
+
+    /// @brief Fires periodically, the first time after one period
+    /// @param[in] period the duration between two deadlines
+    void startPeriodic(const units::Duration period) noexcept;
+
+    /// @brief Fires periodically, starting at an absolute deadline
+    /// @param[in] firstDeadline absolute point in time of the monotonic clock of the first deadline
+    /// @param[in] period the duration between two deadlines, zero results in a one-shot timer
+    void startPeriodicAt(const units::Duration firstDeadline, const units::Duration period) noexcept;
+
+    /// @brief Stops the timer. A deadline which was already reached can still be reported.
+    void stop() noexcept;
+
+    /// @brief Checks if the Timer has fired
+    /// @return true if the Timer has fired, otherwise false.
+    /// @note The hasFired state will be reset after it was handled by a WaitSet/Listener
+    bool hasFired() const noexcept;
+
+    /// @brief Returns the current point in time of the monotonic clock which is used for the deadlines
+    static units::Duration now() noexcept;
+
+    friend class NotificationAttorney;
+
+  private:
+    /// @brief Only usable by the WaitSet/Listener, not for public use. Invalidates the internal triggerHandle.
+    /// @param[in] uniqueTriggerId the id of the corresponding trigger
+    void invalidateTrigger(const uint64_t uniqueTriggerId) noexcept;
+
+    /// @brief Only usable by the WaitSet/Listener, not for public use. Attaches the triggerHandle to the internal
+    /// trigger and arms the timer slot of the WaitSet/Listener.
+    /// @param[in] triggerHandle rvalue reference to the triggerHandle. This class takes the ownership of that handle.
+    void enableEvent(iox::popo::TriggerHandle&& triggerHandle) noexcept;
+
+    /// @brief Only usable by the WaitSet/Listener, not for public use. Resets the internal triggerHandle
+    void disableEvent() noexcept;
+
+    void start(const uint64_t deadline, const uint64_t period) noexcept;
+    void releaseTimerSlot() noexcept;
+    void wakeUpWaiter() noexcept;
+
+  private:
+    mutable std::recursive_mutex m_mutex;
+    TriggerHandle m_trigger;
+    TimerSlot* m_timerSlot{nullptr};
+    uint64_t m_deadline{TimerSlot::DISARMED};
+    uint64_t m_period{0U};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_TIMER_HPP
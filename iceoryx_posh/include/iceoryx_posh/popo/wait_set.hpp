@@ -20,6 +20,7 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/readiness_fifo.hpp"
 #include "iceoryx_posh/popo/enum_trigger_type.hpp"
 #include "iceoryx_posh/popo/notification_attorney.hpp"
 #include "iceoryx_posh/popo/notification_callback.hpp"
@@ -49,6 +50,7 @@ enum class WaitSetError : uint8_t
 {
     WAIT_SET_FULL,
     ALREADY_ATTACHED,
+    READINESS_FD_UNAVAILABLE,
 };
 
 /// @brief Logical disjunction of a certain number of Triggers
@@ -206,6 +208,19 @@ class WaitSet
     /// @return NotificationInfoVector of NotificationInfos that have been triggered
     NotificationInfoVector wait() noexcept;
 
+    /// @brief Non-blocking wait which returns the triggers which are currently triggered. It also rearms the
+    ///        readiness file descriptor, see getReadinessFileDescriptor().
+    /// @return NotificationInfoVector of NotificationInfos that have been triggered
+    NotificationInfoVector tryWait() noexcept;
+
+    /// @brief Returns a file descriptor which becomes readable when the WaitSet is notified. It can be registered
+    ///        in an external event loop (e.g. epoll) instead of blocking a thread in wait(). When the file
+    ///        descriptor is readable, tryWait() acquires the notifications and rearms the file descriptor.
+    /// @note The file descriptor is created with the first call and is owned by the WaitSet; the user must not
+    ///       close it.
+    /// @return the file descriptor or WaitSetError::READINESS_FD_UNAVAILABLE if it could not be created
+    expected<int32_t, WaitSetError> getReadinessFileDescriptor() noexcept;
+
     /// @brief Returns the amount of stored Trigger inside of the WaitSet
     uint64_t size() const noexcept;
 
@@ -248,6 +263,7 @@ class WaitSet
     TriggerArray m_triggerArray;
     ConditionVariableData* m_conditionVariableDataPtr{nullptr};
     ConditionListener m_conditionListener;
+    ReadinessFifo m_readinessFifo;
 
     stack<uint64_t, Capacity> m_indexRepository;
     ConditionListener::NotificationVector_t m_activeNotifications;
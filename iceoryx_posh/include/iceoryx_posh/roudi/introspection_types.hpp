@@ -41,6 +41,16 @@ struct MemPoolInfo
     uint32_t m_numChunks{0};
     uint64_t m_chunkSize{0};
     uint64_t m_chunkPayloadSize{0};
+    uint64_t m_numberOfAllocations{0};
+    uint64_t m_numberOfFrees{0};
+    uint64_t m_numberOfFailedAllocations{0};
+    double m_allocationsPerSecond{0.0};
+    double m_freesPerSecond{0.0};
+    /// @brief bucket i counts the allocations which required more than i/N and at most (i+1)/N of the chunk size;
+    /// many allocations in the lower buckets indicate that the payloads would fit into a mempool with smaller chunks
+    uint64_t m_chunkUtilization[mepoo::NUMBER_OF_CHUNK_UTILIZATION_BUCKETS]{};
+    uint64_t m_loanDurationP50InNanoseconds{0};
+    uint64_t m_loanDurationP99InNanoseconds{0};
 };
 
 /// @brief container for MemPoolInfo structs of all available mempools.
@@ -99,6 +109,10 @@ struct PortThroughputData
     double m_chunksPerMinute{0};
     uint64_t m_lastSendIntervalInNanoseconds{0};
     bool m_isField{false};
+    // monotonic counters since the creation of the publisher port
+    uint64_t m_chunksSent{0};
+    uint64_t m_bytesSent{0};
+    uint64_t m_queueOverflows{0};
 };
 
 /// @brief the topic for the port throughput that a user can subscribe to
@@ -117,6 +131,15 @@ struct SubscriberPortChangingData
     uint64_t fifoCapacity{0};
     iox::SubscribeState subscriptionState{iox::SubscribeState::NOT_SUBSCRIBED};
     capro::Scope propagationScope{capro::Scope::INVALID};
+    // monotonic counters since the creation of the subscriber port
+    uint64_t chunksReceived{0};
+    uint64_t lostChunks{0};
+    // maximum fifoSize since the creation of the subscriber port
+    uint64_t fifoHighWaterMark{0};
+    // percentiles of the time between sending and taking of the chunks since the creation of the subscriber port
+    uint64_t latencyP50InNanoseconds{0};
+    uint64_t latencyP99InNanoseconds{0};
+    uint64_t latencyP999InNanoseconds{0};
 };
 
 struct SubscriberPortChangingIntrospectionFieldTopic
@@ -130,6 +153,9 @@ struct ProcessIntrospectionData
 {
     int m_pid{0};
     RuntimeName_t m_name;
+    /// @brief false if RouDi does not monitor the heartbeat of the process, then the heartbeat age is always 0
+    bool m_isMonitored{false};
+    uint64_t m_heartbeatAgeInMilliseconds{0};
 };
 
 /// @brief the topic for the process introspection that a user can subscribe to
@@ -138,6 +164,35 @@ struct ProcessIntrospectionFieldTopic
     vector<ProcessIntrospectionData, MAX_PROCESS_NUMBER> m_processList;
 };
 
+const capro::ServiceDescription
+    IntrospectionChunkOwnershipService(INTROSPECTION_SERVICE_ID, "RouDi_ID", "ChunkOwnership");
+
+/// @brief the number of chunks of one mempool which are held by a port
+struct ChunkOwnershipData
+{
+    RuntimeName_t m_runtimeName;
+    uint64_t m_portID{0};
+    // same as MemPoolIntrospectionInfo::m_id, i.e. 0 is the RouDi internal memory and 1.. are the segments
+    uint32_t m_segmentId{0};
+    // index of the mempool in MemPoolIntrospectionInfo::m_mempoolInfo
+    uint32_t m_memPoolIndex{0};
+    // chunks which are loaned or received and not yet released by the user of the port
+    uint32_t m_chunksInUse{0};
+    // chunks which are retained by a publisher for the history or the last sent chunk
+    uint32_t m_chunksRetained{0};
+};
+
+constexpr uint32_t MAX_CHUNK_OWNERSHIP_ENTRIES = MAX_PUBLISHERS + MAX_SUBSCRIBERS;
+
+/// @brief the topic for the chunk ownership introspection that a user can subscribe to; chunks in the queues of the
+/// subscribers are not attributed, they are reported by the fifoSize of the SubscriberPortChangingData
+struct ChunkOwnershipIntrospectionTopic
+{
+    vector<ChunkOwnershipData, MAX_CHUNK_OWNERSHIP_ENTRIES> m_chunkOwnershipList;
+    // true if there were more entries than the capacity of the list
+    bool m_isTruncated{false};
+};
+
 } // namespace roudi
 } // namespace iox
 
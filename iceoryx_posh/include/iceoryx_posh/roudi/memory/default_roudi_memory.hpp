@@ -18,6 +18,7 @@
 
 #include "iceoryx_posh/internal/roudi/memory/mempool_collection_memory_block.hpp"
 #include "iceoryx_posh/internal/roudi/memory/mempool_segment_manager_memory_block.hpp"
+#include "iceoryx_posh/internal/runtime/request_channel.hpp"
 #include "iceoryx_posh/roudi/heartbeat_pool.hpp"
 #include "iceoryx_posh/roudi/memory/generic_memory_block.hpp"
 #include "iceoryx_posh/roudi/memory/posix_shm_memory_provider.hpp"
@@ -41,6 +42,7 @@ struct DefaultRouDiMemory
     MemPoolCollectionMemoryBlock m_introspectionMemPoolBlock;
     MemPoolCollectionMemoryBlock m_discoveryMemPoolBlock;
     GenericMemoryBlock<HeartbeatPool> heartbeatPoolBlock;
+    GenericMemoryBlock<runtime::RequestChannelPool> requestChannelPoolBlock;
     MemPoolSegmentManagerMemoryBlock m_segmentManagerBlock;
     PosixShmMemoryProvider m_managementShm;
 
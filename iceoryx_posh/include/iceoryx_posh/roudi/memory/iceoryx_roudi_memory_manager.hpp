@@ -57,6 +57,7 @@ class IceOryxRouDiMemoryManager : public RouDiMemoryInterface
     optional<mepoo::MemoryManager*> introspectionMemoryManager() const noexcept override;
     optional<mepoo::MemoryManager*> discoveryMemoryManager() const noexcept override;
     optional<HeartbeatPool*> heartbeatPool() const noexcept override;
+    optional<runtime::RequestChannelPool*> requestChannelPool() const noexcept override;
     optional<mepoo::SegmentManager<>*> segmentManager() const noexcept override;
 
   private:
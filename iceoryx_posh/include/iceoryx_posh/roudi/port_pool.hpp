@@ -68,6 +68,14 @@ class PortPool
     PortPoolData::InterfaceContainer& getInterfacePortDataList() noexcept;
     PortPoolData::CondVarContainer& getConditionVariableDataList() noexcept;
 
+    /// @brief Returns the ConditionVariableData which is notified by the ports when they have pending CaPro messages
+    popo::ConditionVariableData& getDiscoveryConditionVariableData() noexcept;
+
+    PortPoolData::DirtyPublisherPorts& getDirtyPublisherPorts() noexcept;
+    PortPoolData::DirtySubscriberPorts& getDirtySubscriberPorts() noexcept;
+    PortPoolData::DirtyServerPorts& getDirtyServerPorts() noexcept;
+    PortPoolData::DirtyClientPorts& getDirtyClientPorts() noexcept;
+
     expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     addPublisherPort(const capro::ServiceDescription& serviceDescription,
                      mepoo::MemoryManager* const memoryManager,
@@ -42,6 +42,10 @@ inline iox::popo::SubscriberPortData* PortPool::constructSubscriber(const capro:
         return nullptr;
     }
 
+    port->m_discoveryNotifier.attach(getDiscoveryConditionVariableData(),
+                                     popo::DiscoveryNotificationOrigin::SUBSCRIBER_PORT,
+                                     getDirtySubscriberPorts(),
+                                     port.to_index());
     return port.to_ptr();
 }
 
@@ -66,6 +70,10 @@ inline iox::popo::SubscriberPortData* PortPool::constructSubscriber(const capro:
         return nullptr;
     }
 
+    port->m_discoveryNotifier.attach(getDiscoveryConditionVariableData(),
+                                     popo::DiscoveryNotificationOrigin::SUBSCRIBER_PORT,
+                                     getDirtySubscriberPorts(),
+                                     port.to_index());
     return port.to_ptr();
 }
 } // namespace roudi
@@ -53,9 +53,15 @@ struct RouDiConfig
     /// @brief The number of memory chunks used per introspection topic
     uint32_t introspectionChunkCount{10};
 
+    // every ServiceDiscovery holds its latest registry snapshot sample and can have a newer one in its queue; if the
+    // chunks run out, RouDi retries the snapshot with the next publication and the deltas are still delivered
     /// @brief the number of memory chunks used for discovery
     uint32_t discoveryChunkCount{10};
 
+    /// @brief The number of threads which handle the ports in the cyclic discovery; the ports are distributed to the
+    /// threads by the hash of their service description
+    uint32_t discoveryShardCount{1};
+
     RouDiConfig& setDefaults() noexcept;
     RouDiConfig& optimize() noexcept;
 };
@@ -0,0 +1,83 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_RUNTIME_PORT_REQUESTS_HPP
+#define IOX_POSH_RUNTIME_PORT_REQUESTS_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_interface_base.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace iox
+{
+namespace runtime
+{
+/// @brief A single port of a batched port request
+struct PortRequest
+{
+    /// @brief CREATE_PUBLISHER, CREATE_SUBSCRIBER or CREATE_CONDITION_VARIABLE
+    IpcMessageType type{IpcMessageType::NOTYPE};
+    capro::ServiceDescription service;
+    popo::PublisherOptions publisherOptions;
+    popo::SubscriberOptions subscriberOptions;
+    PortConfigInfo portConfigInfo;
+};
+
+/// @brief Collects the publishers, subscribers and condition variables of an application which shall be requested
+/// from RouDi with a few batched requests instead of one request per port, see PoshRuntime::requestPorts
+class PortRequests
+{
+  public:
+    /// @brief adds a publisher which is handed out by a later getMiddlewarePublisher call with the same arguments
+    /// @param[in] service service description of the publisher
+    /// @param[in] publisherOptions options of the publisher
+    /// @param[in] portConfigInfo configuration information for the port
+    /// @return reference to this object to chain further requests
+    PortRequests& addPublisher(const capro::ServiceDescription& service,
+                               const popo::PublisherOptions& publisherOptions = {},
+                               const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief adds a subscriber which is handed out by a later getMiddlewareSubscriber call with the same arguments
+    /// @param[in] service service description of the subscriber
+    /// @param[in] subscriberOptions options of the subscriber
+    /// @param[in] portConfigInfo configuration information for the port
+    /// @return reference to this object to chain further requests
+    PortRequests& addSubscriber(const capro::ServiceDescription& service,
+                                const popo::SubscriberOptions& subscriberOptions = {},
+                                const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief adds a condition variable which is handed out by a later getMiddlewareConditionVariable call
+    /// @return reference to this object to chain further requests
+    PortRequests& addConditionVariable() noexcept;
+
+    /// @brief returns the number of requested ports and condition variables
+    uint64_t size() const noexcept;
+
+  private:
+    friend class PoshRuntimeImpl;
+
+    std::vector<PortRequest> m_requests;
+};
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_PORT_REQUESTS_HPP
@@ -30,6 +30,7 @@
 #include "iceoryx_posh/popo/server_options.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iceoryx_posh/runtime/port_requests.hpp"
 #include "iox/optional.hpp"
 #include "iox/scope_guard.hpp"
 
@@ -143,6 +144,15 @@ class PoshRuntime
     /// @return pointer to a created condition variable data
     virtual popo::ConditionVariableData* getMiddlewareConditionVariable() noexcept = 0;
 
+    /// @brief request the publishers, subscribers and condition variables of the application from the RouDi daemon
+    /// with a few batched requests instead of one request per port; the subsequent getMiddlewarePublisher,
+    /// getMiddlewareSubscriber and getMiddlewareConditionVariable calls with the same arguments hand out these ports
+    /// @param[in] portRequests the ports to request
+    /// @note ports which are requested but never handed out stay with the application until it terminates, i.e. a
+    /// requested publisher is offered like every other publisher; ports which RouDi could not create are requested
+    /// again by the respective getMiddleware call, which reports the error
+    virtual void requestPorts(const PortRequests& portRequests) noexcept = 0;
+
     /// @brief send a request to the RouDi daemon and get the response
     ///        currently each request is followed by a response
     /// @param[in] msg request message to send
@@ -19,6 +19,8 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry_delta.hpp"
+#include "iceoryx_posh/internal/runtime/service_registry_view.hpp"
 #include "iceoryx_posh/popo/subscriber.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 
@@ -76,14 +78,23 @@ class ServiceDiscovery
 
     // use dynamic memory to reduce stack usage
     /// @todo iox-#1155 improve solution to avoid stack usage without using dynamic memory
-    std::unique_ptr<roudi::ServiceRegistry> m_serviceRegistry{new iox::roudi::ServiceRegistry};
+    std::unique_ptr<ServiceRegistryView> m_serviceRegistryView{new ServiceRegistryView};
     std::mutex m_serviceRegistryMutex;
 
     popo::Subscriber<roudi::ServiceRegistry> m_serviceRegistrySubscriber{
         {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_EVENT_NAME},
         {1U, 1U, iox::NodeName_t("Service Registry"), true}};
 
+    // the history contains at least the deltas since the last snapshot
+    popo::Subscriber<roudi::ServiceRegistryDelta> m_serviceRegistryDeltaSubscriber{
+        {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_DELTA_EVENT_NAME},
+        {roudi::ServiceRegistryDelta::QUEUE_CAPACITY,
+         roudi::ServiceRegistryDelta::SNAPSHOT_INTERVAL,
+         iox::NodeName_t("Service Registry"),
+         true}};
+
     void update();
+    void updateFromSnapshot();
 };
 
 } // namespace runtime
@@ -24,6 +24,28 @@ namespace iox
 {
 namespace capro
 {
+namespace
+{
+constexpr uint64_t FNV_OFFSET_BASIS{14695981039346656037ULL};
+constexpr uint64_t FNV_PRIME{1099511628211ULL};
+
+uint64_t appendToHash(uint64_t hash, const char* const characters, const uint64_t size) noexcept
+{
+    for (uint64_t i = 0U; i < size; ++i)
+    {
+        hash ^= static_cast<uint64_t>(static_cast<uint8_t>(characters[i]));
+        hash *= FNV_PRIME;
+    }
+    // the terminating zero separates the strings, otherwise "ab" + "c" would collide with "a" + "bc"
+    return hash * FNV_PRIME;
+}
+
+uint64_t appendToHash(const uint64_t hash, const IdString_t& idString) noexcept
+{
+    return appendToHash(hash, idString.c_str(), idString.size());
+}
+} // namespace
+
 ServiceDescription::ClassHash::ClassHash() noexcept
     : ClassHash{0U, 0U, 0U, 0U}
 {
@@ -84,13 +106,28 @@ ServiceDescription::ServiceDescription(const IdString_t& service,
     : m_serviceString{service}
     , m_instanceString{instance}
     , m_eventString{event}
+    , m_hash{computeHash(service, instance, event)}
     , m_classHash(classHash)
     , m_interfaceSource(interfaceSource)
 {
 }
 
+uint64_t ServiceDescription::computeHash(const IdString_t& service,
+                                         const IdString_t& instance,
+                                         const IdString_t& event) noexcept
+{
+    auto hash = appendToHash(FNV_OFFSET_BASIS, service);
+    hash = appendToHash(hash, instance);
+    return appendToHash(hash, event);
+}
+
 bool ServiceDescription::operator==(const ServiceDescription& rhs) const noexcept
 {
+    if (m_hash != rhs.m_hash)
+    {
+        return false;
+    }
+
     if (m_serviceString != rhs.m_serviceString)
     {
         return false;
@@ -178,6 +215,8 @@ ServiceDescription::deserialize(const Serialization& serialized) noexcept
         return err(Serialization::Error::DESERIALIZATION_FAILED);
     }
 
+    deserializedObject.m_hash = computeHash(
+        deserializedObject.m_serviceString, deserializedObject.m_instanceString, deserializedObject.m_eventString);
     deserializedObject.m_scope = static_cast<Scope>(scope);
     deserializedObject.m_interfaceSource = static_cast<Interfaces>(interfaceSource);
 
@@ -219,11 +258,26 @@ ServiceDescription::ClassHash ServiceDescription::getClassHash() const noexcept
     return m_classHash;
 }
 
+uint64_t ServiceDescription::getHash() const noexcept
+{
+    return m_hash;
+}
+
 Interfaces ServiceDescription::getSourceInterface() const noexcept
 {
     return m_interfaceSource;
 }
 
+uint64_t hashIdString(const IdString_t& idString) noexcept
+{
+    return appendToHash(FNV_OFFSET_BASIS, idString);
+}
+
+uint64_t hashString(const char* const characters, const uint64_t size) noexcept
+{
+    return appendToHash(FNV_OFFSET_BASIS, characters, size);
+}
+
 bool serviceMatch(const ServiceDescription& first, const ServiceDescription& second) noexcept
 {
     return (first.getServiceIDString() == second.getServiceIDString());
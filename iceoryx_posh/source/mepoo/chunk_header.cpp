@@ -19,11 +19,14 @@
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iox/assertions.hpp"
 
+#include <chrono>
+
 namespace iox
 {
 namespace mepoo
 {
 constexpr uint8_t ChunkHeader::CHUNK_HEADER_VERSION;
+constexpr uint64_t ChunkHeader::NO_PUBLISH_TIMESTAMP;
 
 ChunkHeader::ChunkHeader(const uint64_t chunkSize, const ChunkSettings& chunkSettings) noexcept
     : m_userHeaderSize(chunkSettings.userHeaderSize())
@@ -221,6 +224,24 @@ void ChunkHeader::setSequenceNumber(const uint64_t sequenceNumber) noexcept
     m_sequenceNumber = sequenceNumber;
 }
 
+uint64_t ChunkHeader::publishTimestamp() const noexcept
+{
+    return m_publishTimestamp;
+}
+
+void ChunkHeader::setPublishTimestamp(const uint64_t publishTimestamp) noexcept
+{
+    m_publishTimestamp = publishTimestamp;
+}
+
+uint64_t ChunkHeader::currentPublishTime() noexcept
+{
+    // the steady clock is based on CLOCK_MONOTONIC on Linux and QNX and it is read via the vDSO where available
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
 uint64_t ChunkHeader::overflowSafeUsedSizeOfChunk() const noexcept
 {
     return static_cast<uint64_t>(m_userPayloadOffset) + static_cast<uint64_t>(m_userPayloadSize);
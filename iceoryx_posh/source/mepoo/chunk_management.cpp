@@ -18,6 +18,8 @@
 #include "iceoryx_posh/internal/mepoo/chunk_management.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 
+#include <chrono>
+
 namespace iox
 {
 namespace mepoo
@@ -34,6 +36,12 @@ ChunkManagement::ChunkManagement(const not_null<base_t*> chunkHeader,
                   "'MemPool::CHUNK_MEMORY_ALIGNMENT'!");
 }
 
+uint64_t ChunkManagement::currentLoanTime() noexcept
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
 
 } // namespace mepoo
 } // namespace iox
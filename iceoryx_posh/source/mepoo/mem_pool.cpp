@@ -22,6 +22,7 @@
 #include "iox/assertions.hpp"
 
 #include <algorithm>
+#include <cmath>
 
 namespace iox
 {
@@ -91,6 +92,7 @@ void* MemPool::getChunk() noexcept
         IOX_LOG(WARN,
                 "Mempool [m_chunkSize = " << m_chunkSize << ", numberOfChunks = " << m_numberOfChunks
                                           << ", used_chunks = " << m_usedChunks.load() << " ] has no more space left");
+        m_numberOfFailedAllocations.fetch_add(1U, std::memory_order_relaxed);
         return nullptr;
     }
 
@@ -98,6 +100,7 @@ void* MemPool::getChunk() noexcept
     ///         without changing m_minFree
     m_usedChunks.fetch_add(1U, std::memory_order_relaxed);
     adjustMinFree();
+    m_numberOfAllocations.fetch_add(1U, std::memory_order_relaxed);
 
     return indexToPointer(index, m_chunkSize, m_rawMemory.get());
 }
@@ -155,6 +158,30 @@ void MemPool::freeChunk(const void* chunk) noexcept
     }
 
     m_usedChunks.fetch_sub(1U, std::memory_order_relaxed);
+    m_numberOfFrees.fetch_add(1U, std::memory_order_relaxed);
+}
+
+bool MemPool::containsChunk(const void* const chunk) const noexcept
+{
+    const auto memPoolStartAddress = reinterpret_cast<uint64_t>(m_rawMemory.get());
+    const auto chunkAddress = reinterpret_cast<uint64_t>(chunk);
+    return chunkAddress >= memPoolStartAddress
+           && chunkAddress - memPoolStartAddress < m_chunkSize * static_cast<uint64_t>(m_numberOfChunks)
+           && (chunkAddress - memPoolStartAddress) % m_chunkSize == 0U;
+}
+
+void MemPool::recordChunkUtilization(const uint64_t requiredChunkSize) noexcept
+{
+    const auto utilization = static_cast<double>(requiredChunkSize) / static_cast<double>(m_chunkSize);
+    // the required chunk size is larger than zero and at most the chunk size, the upper bound of a bucket is inclusive
+    const auto bucket = static_cast<uint64_t>(std::ceil(utilization * NUMBER_OF_CHUNK_UTILIZATION_BUCKETS));
+    const auto index = std::min(std::max(bucket, uint64_t{1U}), uint64_t{NUMBER_OF_CHUNK_UTILIZATION_BUCKETS}) - 1U;
+    m_chunkUtilization[index].fetch_add(1U, std::memory_order_relaxed);
+}
+
+void MemPool::recordLoanDuration(const uint64_t loanDurationInNanoseconds) noexcept
+{
+    m_loanDuration.record(loanDurationInNanoseconds);
 }
 
 uint64_t MemPool::getChunkSize() const noexcept
@@ -179,10 +206,20 @@ uint32_t MemPool::getMinFree() const noexcept
 
 MemPoolInfo MemPool::getInfo() const noexcept
 {
-    return {m_usedChunks.load(std::memory_order_relaxed),
-            m_minFree.load(std::memory_order_relaxed),
-            m_numberOfChunks,
-            m_chunkSize};
+    MemPoolInfo info{m_usedChunks.load(std::memory_order_relaxed),
+                     m_minFree.load(std::memory_order_relaxed),
+                     m_numberOfChunks,
+                     m_chunkSize};
+    info.m_numberOfAllocations = m_numberOfAllocations.load(std::memory_order_relaxed);
+    info.m_numberOfFrees = m_numberOfFrees.load(std::memory_order_relaxed);
+    info.m_numberOfFailedAllocations = m_numberOfFailedAllocations.load(std::memory_order_relaxed);
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNK_UTILIZATION_BUCKETS; ++i)
+    {
+        info.m_chunkUtilization[i] = m_chunkUtilization[i].load(std::memory_order_relaxed);
+    }
+    info.m_loanDurationP50InNanoseconds = m_loanDuration.percentile(0.5);
+    info.m_loanDurationP99InNanoseconds = m_loanDuration.percentile(0.99);
+    return info;
 }
 
 } // namespace mepoo
@@ -88,6 +88,23 @@ MemPoolInfo MemoryManager::getMemPoolInfo(const uint32_t index) const noexcept
     return m_memPoolVector[index].getInfo();
 }
 
+optional<uint32_t> MemoryManager::getMemPoolIndex(const void* const chunk) const noexcept
+{
+    for (uint32_t i = 0U; i < m_memPoolVector.size(); ++i)
+    {
+        if (m_memPoolVector[i].containsChunk(chunk))
+        {
+            return i;
+        }
+    }
+    return nullopt;
+}
+
+bool MemoryManager::containsChunkManagement(const ChunkManagement* const chunkManagement) const noexcept
+{
+    return !m_chunkManagementPool.empty() && m_chunkManagementPool.front().containsChunk(chunkManagement);
+}
+
 uint64_t MemoryManager::sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t size) noexcept
 {
     return size + sizeof(ChunkHeader);
@@ -199,6 +216,10 @@ expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkS
     }
     else
     {
+        if (build::IOX_LATENCY_STATISTICS_FLAG)
+        {
+            memPoolPointer->recordChunkUtilization(requiredChunkSize);
+        }
         auto chunkHeader = new (chunk) ChunkHeader(aquiredChunkSize, chunkSettings);
         auto chunkManagement = new (m_chunkManagementPool.front().getChunk())
             ChunkManagement(chunkHeader, memPoolPointer, &m_chunkManagementPool.front());
@@ -60,6 +60,11 @@ void SharedChunk::decrementReferenceCounter() noexcept
 
 void SharedChunk::freeChunk() noexcept
 {
+    if (build::IOX_LATENCY_STATISTICS_FLAG)
+    {
+        m_chunkManagement->m_mempool->recordLoanDuration(ChunkManagement::currentLoanTime()
+                                                         - m_chunkManagement->m_loanTimestamp);
+    }
     m_chunkManagement->m_mempool->freeChunk(static_cast<void*>(m_chunkManagement->m_chunkHeader.get()));
     m_chunkManagement->m_chunkManagementPool->freeChunk(m_chunkManagement);
     m_chunkManagement = nullptr;
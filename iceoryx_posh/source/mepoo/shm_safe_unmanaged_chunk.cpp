@@ -17,6 +17,8 @@
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iox/assertions.hpp"
 
+#include <atomic>
+
 namespace iox
 {
 namespace mepoo
@@ -104,6 +106,37 @@ const ChunkHeader* ShmSafeUnmanagedChunk::getChunkHeader() const noexcept
     return const_cast<ShmSafeUnmanagedChunk*>(this)->getChunkHeader();
 }
 
+optional<const ChunkHeader*> ShmSafeUnmanagedChunk::getChunkHeaderSnapshot(
+    const function_ref<bool(const ChunkManagement*)> isChunkManagement) const noexcept
+{
+    // the owner can change the chunk concurrently, therefore a copy is used; a 64 bit value is not torn
+    const RelativePointerData chunkManagementData = m_chunkManagement;
+    if (chunkManagementData.isLogicalNullptr())
+    {
+        return nullopt;
+    }
+
+    // the chunk can be released and its ChunkManagement reused at any time; the pointer is only dereferenced when it
+    // refers to the memory of a ChunkManagement, which stays mapped, and the result is discarded if the chunk was
+    // changed while the ChunkHeader was read
+    const auto chunkMgmt = RelativePointer<mepoo::ChunkManagement>(chunkManagementData.offset(),
+                                                                   segment_id_t{chunkManagementData.id()})
+                               .get();
+    if (!isChunkManagement(chunkMgmt))
+    {
+        return nullopt;
+    }
+    const ChunkHeader* const chunkHeader = chunkMgmt->m_chunkHeader.get();
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if ((m_chunkManagement.id() != chunkManagementData.id())
+        || (m_chunkManagement.offset() != chunkManagementData.offset()))
+    {
+        return nullopt;
+    }
+    return chunkHeader;
+}
+
 bool ShmSafeUnmanagedChunk::isNotLogicalNullptrAndHasNoOtherOwners() const noexcept
 {
     if (m_chunkManagement.isLogicalNullptr())
@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/tracepoint.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 
 namespace iox
@@ -52,12 +53,19 @@ void ConditionListener::destroy() volatile noexcept
 
 bool ConditionListener::wasNotified() const noexcept
 {
-    return getMembers()->m_wasNotified.load(std::memory_order_relaxed);
+    return getMembers()->hasActiveNotifications();
 }
 
 ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 {
     return waitImpl([this]() -> bool {
+        const auto nextTimerDeadline = this->findNextTimerDeadline();
+        if (nextTimerDeadline != TimerSlot::DISARMED)
+        {
+            this->waitUntil(nextTimerDeadline);
+            return true;
+        }
+
         if (this->getMembers()->m_semaphore->wait().has_error())
         {
             IOX_REPORT_FATAL(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT);
@@ -69,34 +77,37 @@ ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 
 ConditionListener::NotificationVector_t ConditionListener::timedWait(const units::Duration& timeToWait) noexcept
 {
-    return waitImpl([this, timeToWait]() -> bool {
-        if (this->getMembers()->m_semaphore->timedWait(timeToWait).has_error())
-        {
-            IOX_REPORT_FATAL(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT);
-        }
-        return false;
+    const auto now = TimerSlot::now();
+    const auto timeToWaitInNanoseconds = timeToWait.toNanoseconds();
+    const auto timeout = (timeToWaitInNanoseconds < TimerSlot::DISARMED - now) ? now + timeToWaitInNanoseconds
+                                                                                : TimerSlot::DISARMED;
+    return waitImpl([this, timeout]() -> bool {
+        const auto nextTimerDeadline = this->findNextTimerDeadline();
+        const auto wakeUpTime = (nextTimerDeadline < timeout) ? nextTimerDeadline : timeout;
+        this->waitUntil(wakeUpTime);
+        // when a timer expired before the timeout it is collected in the next iteration
+        return wakeUpTime < timeout;
     });
 }
 
+ConditionListener::NotificationVector_t ConditionListener::tryWait() noexcept
+{
+    return waitImpl([]() -> bool { return false; });
+}
+
 ConditionListener::NotificationVector_t ConditionListener::waitImpl(const function_ref<bool()> waitCall) noexcept
 {
-    using Type_t = iox::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
     NotificationVector_t activeNotifications;
 
     resetSemaphore();
     bool doReturnAfterNotificationCollection = false;
     while (!m_toBeDestroyed.load(std::memory_order_relaxed))
     {
-        for (Type_t i = 0U; i < MAX_NUMBER_OF_NOTIFIERS; i++)
-        {
-            if (getMembers()->m_activeNotifications[i].load(std::memory_order_relaxed))
-            {
-                resetUnchecked(i);
-                activeNotifications.emplace_back(i);
-            }
-        }
+        fireExpiredTimers();
+        collectActiveNotifications(activeNotifications);
         if (!activeNotifications.empty() || doReturnAfterNotificationCollection)
         {
+            IOX_TRACEPOINT(Tracepoint::WOKEN_UP, activeNotifications.size());
             return activeNotifications;
         }
 
@@ -106,10 +117,88 @@ ConditionListener::NotificationVector_t ConditionListener::waitImpl(const functi
     return activeNotifications;
 }
 
-void ConditionListener::resetUnchecked(const uint64_t index) noexcept
+void ConditionListener::fireExpiredTimers() noexcept
 {
-    getMembers()->m_activeNotifications[index].store(false, std::memory_order_relaxed);
-    getMembers()->m_wasNotified.store(false, std::memory_order_relaxed);
+    // the clock is only read when there is at least one armed timer
+    uint64_t now{TimerSlot::DISARMED};
+    for (auto& timerSlot : getMembers()->m_timerSlots)
+    {
+        if (timerSlot.deadline() == TimerSlot::DISARMED)
+        {
+            continue;
+        }
+
+        if (now == TimerSlot::DISARMED)
+        {
+            now = TimerSlot::now();
+        }
+
+        const auto notificationIndex = timerSlot.expire(now);
+        if (notificationIndex < MAX_NUMBER_OF_NOTIFIERS)
+        {
+            IOX_DISCARD_RESULT(getMembers()->activateNotification(notificationIndex));
+        }
+    }
+}
+
+uint64_t ConditionListener::findNextTimerDeadline() const noexcept
+{
+    uint64_t nextDeadline{TimerSlot::DISARMED};
+    for (const auto& timerSlot : getMembers()->m_timerSlots)
+    {
+        const auto deadline = timerSlot.deadline();
+        if (deadline < nextDeadline)
+        {
+            nextDeadline = deadline;
+        }
+    }
+    return nextDeadline;
+}
+
+void ConditionListener::waitUntil(const uint64_t deadline) noexcept
+{
+    const auto now = TimerSlot::now();
+    if (deadline <= now)
+    {
+        return;
+    }
+
+    if (getMembers()->m_semaphore->timedWait(units::Duration::fromNanoseconds(deadline - now)).has_error())
+    {
+        IOX_REPORT_FATAL(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT);
+    }
+}
+
+void ConditionListener::collectActiveNotifications(NotificationVector_t& activeNotifications) noexcept
+{
+    using Type_t = iox::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
+    constexpr uint64_t BITS_PER_BITMAP_WORD{ConditionVariableData::BITS_PER_BITMAP_WORD};
+
+    for (uint64_t word = 0U; word < ConditionVariableData::NUMBER_OF_BITMAP_WORDS; ++word)
+    {
+        auto& bitmapWord = getMembers()->m_activeNotificationBitmap[word];
+        // reading the word first avoids writing to the cache line when there is nothing to collect
+        if (bitmapWord.load(std::memory_order_relaxed) == 0U)
+        {
+            continue;
+        }
+
+        auto activeBits = bitmapWord.exchange(0U, std::memory_order_acq_rel);
+        for (uint64_t bit = 0U; activeBits != 0U; ++bit, activeBits >>= 1U)
+        {
+            if ((activeBits & 1U) == 0U)
+            {
+                continue;
+            }
+
+            const auto index = word * BITS_PER_BITMAP_WORD + bit;
+            // the slot is reset after the bitmap; a notifier which still finds the slot active is collected with
+            // this call and the exchange makes its data visible to the waiter
+            IOX_DISCARD_RESULT(
+                getMembers()->m_notifierSlots[index].m_isActive.exchange(false, std::memory_order_acq_rel));
+            activeNotifications.emplace_back(static_cast<Type_t>(index));
+        }
+    }
 }
 
 const ConditionVariableData* ConditionListener::getMembers() volatile const noexcept
@@ -34,10 +34,36 @@ ConditionVariableData::ConditionVariableData(const RuntimeName_t& runtimeName) n
         IOX_REPORT_FATAL(PoshError::POPO__CONDITION_VARIABLE_DATA_FAILED_TO_CREATE_SEMAPHORE);
     });
 
-    for (auto& id : m_activeNotifications)
+    for (auto& bitmapWord : m_activeNotificationBitmap)
     {
-        id.store(false, std::memory_order_relaxed);
+        bitmapWord.store(0U, std::memory_order_relaxed);
     }
 }
+
+bool ConditionVariableData::activateNotification(const uint64_t index) noexcept
+{
+    // acq_rel pairs with the exchange of the waiter when it collects the notification; a notifier which finds the
+    // slot already active therefore publishes its data to the waiter without touching the shared bitmap
+    if (m_notifierSlots[index].m_isActive.exchange(true, std::memory_order_acq_rel))
+    {
+        return false;
+    }
+
+    const uint64_t bit = 1ULL << (index % BITS_PER_BITMAP_WORD);
+    m_activeNotificationBitmap[index / BITS_PER_BITMAP_WORD].fetch_or(bit, std::memory_order_release);
+    return true;
+}
+
+bool ConditionVariableData::hasActiveNotifications() const noexcept
+{
+    for (const auto& bitmapWord : m_activeNotificationBitmap)
+    {
+        if (bitmapWord.load(std::memory_order_relaxed) != 0U)
+        {
+            return true;
+        }
+    }
+    return false;
+}
 } // namespace popo
 } // namespace iox
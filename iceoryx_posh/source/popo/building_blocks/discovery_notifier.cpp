@@ -0,0 +1,69 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
+
+namespace iox
+{
+namespace popo
+{
+void DiscoveryNotifier::attach(ConditionVariableData& condVarData, const DiscoveryNotificationOrigin origin) noexcept
+{
+    m_notificationIndex = static_cast<uint64_t>(origin);
+    m_condVarDataOffset = offsetTo(&condVarData);
+}
+
+bool DiscoveryNotifier::isAttached() const noexcept
+{
+    return m_condVarDataOffset != NULL_OFFSET;
+}
+
+void DiscoveryNotifier::notify() noexcept
+{
+    if (!isAttached())
+    {
+        return;
+    }
+
+    // the port is marked before the discovery loop is woken up; the discovery loop collects the notification
+    // before it consumes the marks, therefore a mark is either consumed with this or with the next wake up
+    if (m_dirtyWordOffset != NULL_OFFSET)
+    {
+        static_cast<std::atomic<uint64_t>*>(fromOffset(m_dirtyWordOffset))
+            ->fetch_or(m_dirtyMask, std::memory_order_acq_rel);
+    }
+
+    ConditionNotifier(*static_cast<ConditionVariableData*>(fromOffset(m_condVarDataOffset)), m_notificationIndex)
+        .notify();
+}
+
+int64_t DiscoveryNotifier::offsetTo(const void* const target) const noexcept
+{
+    // AXIVION Next Construct AutosarC++19_03-M5.2.9 : the offset is required to address the target in every process
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return static_cast<int64_t>(reinterpret_cast<uintptr_t>(target) - reinterpret_cast<uintptr_t>(this));
+}
+
+void* DiscoveryNotifier::fromOffset(const int64_t offset) noexcept
+{
+    // AXIVION Next Construct AutosarC++19_03-M5.2.9 : the offset is required to address the target in every process
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast,performance-no-int-to-ptr)
+    return reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(this) + static_cast<uintptr_t>(offset));
+}
+
+} // namespace popo
+} // namespace iox
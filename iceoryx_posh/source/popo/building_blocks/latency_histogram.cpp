@@ -0,0 +1,135 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint64_t LatencyHistogram::SUB_BUCKET_BITS;
+constexpr uint64_t LatencyHistogram::SUB_BUCKETS;
+constexpr uint64_t LatencyHistogram::NUMBER_OF_POWERS;
+constexpr uint64_t LatencyHistogram::NUMBER_OF_BUCKETS;
+
+namespace
+{
+/// @note a binary search instead of a loop over all bits since this is called on every take
+uint64_t indexOfMostSignificantBit(uint64_t value) noexcept
+{
+    uint64_t index{0U};
+    for (uint64_t shift = 32U; shift > 0U; shift >>= 1U)
+    {
+        if (value >= (uint64_t{1U} << shift))
+        {
+            value >>= shift;
+            index += shift;
+        }
+    }
+    return index;
+}
+} // namespace
+
+void LatencyHistogram::record(const uint64_t latencyInNanoseconds) noexcept
+{
+    m_buckets[bucketIndex(latencyInNanoseconds)].fetch_add(1U, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::count() const noexcept
+{
+    uint64_t numberOfLatencies{0U};
+    for (const auto& bucket : m_buckets)
+    {
+        numberOfLatencies += bucket.load(std::memory_order_relaxed);
+    }
+    return numberOfLatencies;
+}
+
+uint64_t LatencyHistogram::percentile(const double fraction) const noexcept
+{
+    uint64_t snapshot[NUMBER_OF_BUCKETS];
+    uint64_t numberOfLatencies{0U};
+    for (uint64_t i = 0U; i < NUMBER_OF_BUCKETS; ++i)
+    {
+        snapshot[i] = m_buckets[i].load(std::memory_order_relaxed);
+        numberOfLatencies += snapshot[i];
+    }
+
+    if (numberOfLatencies == 0U)
+    {
+        return 0U;
+    }
+
+    const auto clampedFraction = std::min(std::max(fraction, 0.0), 1.0);
+    const auto rank = std::max(
+        static_cast<uint64_t>(std::ceil(clampedFraction * static_cast<double>(numberOfLatencies))), uint64_t{1U});
+
+    uint64_t cumulativeCount{0U};
+    for (uint64_t i = 0U; i < NUMBER_OF_BUCKETS; ++i)
+    {
+        cumulativeCount += snapshot[i];
+        if (cumulativeCount >= rank)
+        {
+            return bucketUpperBound(i);
+        }
+    }
+
+    return bucketUpperBound(NUMBER_OF_BUCKETS - 1U);
+}
+
+uint64_t LatencyHistogram::bucketIndex(const uint64_t latencyInNanoseconds) noexcept
+{
+    if (latencyInNanoseconds < SUB_BUCKETS)
+    {
+        return latencyInNanoseconds;
+    }
+
+    const auto msb = indexOfMostSignificantBit(latencyInNanoseconds);
+    const auto power = msb - SUB_BUCKET_BITS + 1U;
+    if (power >= NUMBER_OF_POWERS)
+    {
+        return NUMBER_OF_BUCKETS - 1U;
+    }
+
+    const auto subBucket = (latencyInNanoseconds >> (msb - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1U);
+    return power * SUB_BUCKETS + subBucket;
+}
+
+uint64_t LatencyHistogram::bucketUpperBound(const uint64_t index) noexcept
+{
+    if (index + 1U >= NUMBER_OF_BUCKETS)
+    {
+        return std::numeric_limits<uint64_t>::max();
+    }
+
+    // the upper bound is one less than the lower bound of the next bucket
+    const auto nextIndex = index + 1U;
+    if (nextIndex < SUB_BUCKETS)
+    {
+        return index;
+    }
+
+    const auto power = nextIndex / SUB_BUCKETS;
+    const auto subBucket = nextIndex % SUB_BUCKETS;
+    return ((SUB_BUCKETS + subBucket) << (power - 1U)) - 1U;
+}
+
+} // namespace popo
+} // namespace iox
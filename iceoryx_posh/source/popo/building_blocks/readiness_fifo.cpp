@@ -0,0 +1,213 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/readiness_fifo.hpp"
+#include "iceoryx_platform/errno.hpp"
+#include "iceoryx_platform/fcntl.hpp"
+#include "iceoryx_platform/stat.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iox/filesystem.hpp"
+#include "iox/logging.hpp"
+#include "iox/posix_call.hpp"
+
+namespace iox
+{
+namespace popo
+{
+constexpr access_rights ReadinessFifo::FIFO_PERMISSIONS;
+
+namespace
+{
+uint64_t createUniqueFifoId() noexcept
+{
+    static std::atomic<uint32_t> fifoCounter{0U};
+    const auto pid = static_cast<uint64_t>(getpid());
+    // the id must never be INVALID_READINESS_FIFO_ID therefore the counter starts with 1
+    const auto counter = static_cast<uint64_t>(fifoCounter.fetch_add(1U, std::memory_order_relaxed) + 1U);
+    return (pid << 32U) | counter;
+}
+} // namespace
+
+ReadinessFifo::ReadinessFifo(ConditionVariableData& condVarData) noexcept
+    : m_condVarDataPtr(&condVarData)
+{
+}
+
+ReadinessFifo::~ReadinessFifo() noexcept
+{
+    detach();
+}
+
+ReadinessFifo::Path_t ReadinessFifo::path(const uint64_t fifoId) noexcept
+{
+    constexpr uint64_t NUMBER_OF_HEX_DIGITS{16U};
+    constexpr uint64_t BITS_PER_HEX_DIGIT{4U};
+    constexpr char HEX_DIGITS[] = "0123456789abcdef";
+
+    char fifoIdAsHex[NUMBER_OF_HEX_DIGITS + 1U]{};
+    for (uint64_t i = 0U; i < NUMBER_OF_HEX_DIGITS; ++i)
+    {
+        const auto shift = (NUMBER_OF_HEX_DIGITS - 1U - i) * BITS_PER_HEX_DIGIT;
+        fifoIdAsHex[i] = HEX_DIGITS[(fifoId >> shift) & 0xFU];
+    }
+
+    Path_t fifoPath{TruncateToCapacity, platform::IOX_TEMP_DIR};
+    fifoPath.append(TruncateToCapacity, IOX_DEFAULT_RESOURCE_PREFIX);
+    fifoPath.append(TruncateToCapacity, "_readiness_");
+    fifoPath.append(TruncateToCapacity, fifoIdAsHex);
+    fifoPath.append(TruncateToCapacity, ".fifo");
+    return fifoPath;
+}
+
+expected<int32_t, ReadinessFifoError> ReadinessFifo::getFileDescriptor() noexcept
+{
+    if (m_fileDescriptor != INVALID_FILE_DESCRIPTOR)
+    {
+        return ok(m_fileDescriptor);
+    }
+
+#if defined(_WIN32)
+    IOX_LOG(ERROR, "Readiness file descriptors are not supported on this platform");
+    return err(ReadinessFifoError::NOT_SUPPORTED);
+#else
+    const auto fifoId = createUniqueFifoId();
+    const auto fifoPath = path(fifoId);
+
+    // a named pipe of a crashed process with the same pid could still exist
+    IOX_DISCARD_RESULT(
+        IOX_POSIX_CALL(iox_unlink)(fifoPath.c_str()).failureReturnValue(-1).ignoreErrnos(ENOENT).evaluate());
+
+    if (IOX_POSIX_CALL(mkfifo)(fifoPath.c_str(), static_cast<iox_mode_t>(FIFO_PERMISSIONS.value()))
+            .failureReturnValue(-1)
+            .evaluate()
+            .has_error())
+    {
+        IOX_LOG(ERROR, "Unable to create the readiness fifo '" << fifoPath << "'");
+        return err(ReadinessFifoError::UNABLE_TO_CREATE_FIFO);
+    }
+
+    // the fifo is opened for reading and writing, otherwise it would be reported as hung up after the first notifier
+    // has closed its write end
+    auto openCall = IOX_POSIX_CALL(iox_open)(fifoPath.c_str(), O_RDWR | O_NONBLOCK | O_CLOEXEC, 0)
+                        .failureReturnValue(INVALID_FILE_DESCRIPTOR)
+                        .evaluate();
+    if (openCall.has_error())
+    {
+        IOX_LOG(ERROR, "Unable to open the readiness fifo '" << fifoPath << "'");
+        IOX_DISCARD_RESULT(IOX_POSIX_CALL(iox_unlink)(fifoPath.c_str()).failureReturnValue(-1).evaluate());
+        return err(ReadinessFifoError::UNABLE_TO_OPEN_FIFO);
+    }
+
+    // the umask must not restrict the notifiers of the group
+    IOX_DISCARD_RESULT(IOX_POSIX_CALL(iox_fchmod)(openCall->value, static_cast<iox_mode_t>(FIFO_PERMISSIONS.value()))
+                           .failureReturnValue(-1)
+                           .evaluate());
+
+    m_fifoId = fifoId;
+    m_fileDescriptor = openCall->value;
+    m_condVarDataPtr->m_isReadinessSignalPending.store(false, std::memory_order_relaxed);
+    m_condVarDataPtr->m_readinessFifoId.store(m_fifoId, std::memory_order_release);
+
+    // notifications which arrived before the fifo was attached would never be signalled
+    if (m_condVarDataPtr->hasActiveNotifications())
+    {
+        signal(*m_condVarDataPtr);
+    }
+
+    return ok(m_fileDescriptor);
+#endif
+}
+
+void ReadinessFifo::rearm() noexcept
+{
+    if (m_fileDescriptor == INVALID_FILE_DESCRIPTOR)
+    {
+        return;
+    }
+
+    constexpr uint64_t DRAIN_BUFFER_SIZE{64U};
+    uint8_t drainBuffer[DRAIN_BUFFER_SIZE];
+    while (true)
+    {
+        auto readCall = IOX_POSIX_CALL(iox_read)(m_fileDescriptor, &drainBuffer[0], DRAIN_BUFFER_SIZE)
+                            .failureReturnValue(-1)
+                            .ignoreErrnos(EAGAIN, EWOULDBLOCK)
+                            .evaluate();
+        if (readCall.has_error() || readCall->value <= 0)
+        {
+            break;
+        }
+    }
+
+    m_condVarDataPtr->m_isReadinessSignalPending.store(false, std::memory_order_relaxed);
+    // pairs with the fence in signal(); either the waiter sees the active notification when it collects them
+    // afterwards or the notifier sees that no signal is pending and writes to the fifo
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+void ReadinessFifo::signal(ConditionVariableData& condVarData) noexcept
+{
+    const auto fifoId = condVarData.m_readinessFifoId.load(std::memory_order_acquire);
+    if (fifoId == ConditionVariableData::INVALID_READINESS_FIFO_ID)
+    {
+        return;
+    }
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (condVarData.m_isReadinessSignalPending.exchange(true, std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    // the waiter could have removed the fifo concurrently, therefore a missing fifo is not an error
+    const auto fifoPath = path(fifoId);
+    auto openCall = IOX_POSIX_CALL(iox_open)(fifoPath.c_str(), O_WRONLY | O_NONBLOCK | O_CLOEXEC, 0)
+                        .failureReturnValue(INVALID_FILE_DESCRIPTOR)
+                        .suppressErrorMessagesForErrnos(ENOENT, ENXIO)
+                        .evaluate();
+    if (openCall.has_error())
+    {
+        condVarData.m_isReadinessSignalPending.store(false, std::memory_order_relaxed);
+        return;
+    }
+
+    const uint8_t readinessToken{1U};
+    IOX_DISCARD_RESULT(IOX_POSIX_CALL(iox_write)(openCall->value, &readinessToken, sizeof(readinessToken))
+                           .failureReturnValue(-1)
+                           .ignoreErrnos(EAGAIN, EWOULDBLOCK)
+                           .evaluate());
+    IOX_DISCARD_RESULT(IOX_POSIX_CALL(iox_close)(openCall->value).failureReturnValue(-1).evaluate());
+}
+
+void ReadinessFifo::detach() noexcept
+{
+    if (m_fileDescriptor == INVALID_FILE_DESCRIPTOR)
+    {
+        return;
+    }
+
+    m_condVarDataPtr->m_readinessFifoId.store(ConditionVariableData::INVALID_READINESS_FIFO_ID,
+                                              std::memory_order_relaxed);
+    IOX_DISCARD_RESULT(IOX_POSIX_CALL(iox_close)(m_fileDescriptor).failureReturnValue(-1).evaluate());
+    IOX_DISCARD_RESULT(
+        IOX_POSIX_CALL(iox_unlink)(path(m_fifoId).c_str()).failureReturnValue(-1).ignoreErrnos(ENOENT).evaluate());
+
+    m_fileDescriptor = INVALID_FILE_DESCRIPTOR;
+    m_fifoId = ConditionVariableData::INVALID_READINESS_FIFO_ID;
+}
+
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,97 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/timer_slot.hpp"
+#include "iceoryx_platform/time.hpp"
+#include "iox/assertions.hpp"
+#include "iox/duration.hpp"
+#include "iox/posix_call.hpp"
+
+namespace iox
+{
+namespace popo
+{
+bool TimerSlot::acquire(const uint64_t notificationIndex) noexcept
+{
+    uint64_t expected{INVALID_NOTIFICATION_INDEX};
+    return m_notificationIndex.compare_exchange_strong(
+        expected, notificationIndex, std::memory_order_acq_rel, std::memory_order_relaxed);
+}
+
+void TimerSlot::release() noexcept
+{
+    m_deadline.store(DISARMED, std::memory_order_relaxed);
+    m_period.store(0U, std::memory_order_relaxed);
+    m_notificationIndex.store(INVALID_NOTIFICATION_INDEX, std::memory_order_release);
+}
+
+void TimerSlot::arm(const uint64_t deadline, const uint64_t period) noexcept
+{
+    m_period.store(period, std::memory_order_relaxed);
+    m_deadline.store(deadline, std::memory_order_release);
+}
+
+uint64_t TimerSlot::disarm() noexcept
+{
+    return m_deadline.exchange(DISARMED, std::memory_order_acq_rel);
+}
+
+uint64_t TimerSlot::deadline() const noexcept
+{
+    return m_deadline.load(std::memory_order_acquire);
+}
+
+uint64_t TimerSlot::expire(const uint64_t now) noexcept
+{
+    auto currentDeadline = m_deadline.load(std::memory_order_acquire);
+    if (currentDeadline == DISARMED || currentDeadline > now)
+    {
+        return INVALID_NOTIFICATION_INDEX;
+    }
+
+    uint64_t nextDeadline{DISARMED};
+    const auto period = m_period.load(std::memory_order_relaxed);
+    if (period != 0U)
+    {
+        // the next deadline is always a whole number of periods after the current one, otherwise the timer would
+        // drift by the latency of the waiting thread
+        const auto numberOfMissedPeriods = (now - currentDeadline) / period;
+        nextDeadline = currentDeadline + (numberOfMissedPeriods + 1U) * period;
+    }
+
+    // the timer could have been re-armed or stopped concurrently, in this case the new deadline wins
+    if (!m_deadline.compare_exchange_strong(
+            currentDeadline, nextDeadline, std::memory_order_acq_rel, std::memory_order_relaxed))
+    {
+        return INVALID_NOTIFICATION_INDEX;
+    }
+
+    return m_notificationIndex.load(std::memory_order_acquire);
+}
+
+uint64_t TimerSlot::now() noexcept
+{
+    timespec timeSinceEpoch{0, 0};
+    IOX_ENFORCE(!IOX_POSIX_CALL(iox_clock_gettime)(CLOCK_MONOTONIC, &timeSinceEpoch)
+                     .failureReturnValue(-1)
+                     .evaluate()
+                     .has_error(),
+                "An error which should never happen occured during 'iox_clock_gettime'!");
+    return units::Duration{timeSinceEpoch}.toNanoseconds();
+}
+
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,236 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/tracepoint.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace iox
+{
+namespace popo
+{
+const char* asStringLiteral(const Tracepoint value) noexcept
+{
+    switch (value)
+    {
+    case Tracepoint::CHUNK_LOANED:
+        return "Tracepoint::CHUNK_LOANED";
+    case Tracepoint::CHUNK_PUBLISHED:
+        return "Tracepoint::CHUNK_PUBLISHED";
+    case Tracepoint::CHUNK_DELIVERED:
+        return "Tracepoint::CHUNK_DELIVERED";
+    case Tracepoint::CHUNK_PUSHED:
+        return "Tracepoint::CHUNK_PUSHED";
+    case Tracepoint::CHUNK_TAKEN:
+        return "Tracepoint::CHUNK_TAKEN";
+    case Tracepoint::NOTIFIED:
+        return "Tracepoint::NOTIFIED";
+    case Tracepoint::WOKEN_UP:
+        return "Tracepoint::WOKEN_UP";
+    }
+
+    return "[Undefined Tracepoint]";
+}
+
+/// @brief Owns the trace rings of all threads of the process; the rings of exited threads are kept for the export
+///        until a new thread reuses them
+class TraceRingRegistry
+{
+  public:
+    static TraceRingRegistry& instance() noexcept
+    {
+        static TraceRingRegistry registry;
+        return registry;
+    }
+
+    TraceRing* acquire() noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto threadId = ++m_threadCounter;
+        for (auto& entry : m_entries)
+        {
+            if (!entry.isInUse)
+            {
+                entry.isInUse = true;
+                entry.ring->reset(threadId);
+                return entry.ring.get();
+            }
+        }
+
+        m_entries.push_back({std::make_unique<TraceRing>(threadId), true});
+        return m_entries.back().ring.get();
+    }
+
+    void release(const TraceRing* const ring) noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& entry : m_entries)
+        {
+            if (entry.ring.get() == ring)
+            {
+                entry.isInUse = false;
+                return;
+            }
+        }
+    }
+
+    void forEachRing(const function_ref<void(const TraceRing&)> callable) noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& entry : m_entries)
+        {
+            callable(*entry.ring);
+        }
+    }
+
+  private:
+    struct Entry
+    {
+        std::unique_ptr<TraceRing> ring;
+        bool isInUse{false};
+    };
+
+    std::mutex m_mutex;
+    std::vector<Entry> m_entries;
+    uint64_t m_threadCounter{0U};
+};
+
+TraceRing::TraceRing(const uint64_t threadId) noexcept
+    : m_threadId(threadId)
+{
+}
+
+void TraceRing::record(const Tracepoint tracepoint, const uint64_t argument) noexcept
+{
+    // only the owning thread writes, therefore the write index does not need a read-modify-write operation
+    const auto position = m_writeIndex.load(std::memory_order_relaxed);
+    auto& slot = m_slots[position % CAPACITY];
+
+    // every slot is a seqlock with the position + 1 as sequence number, a sequence number of 0 marks a slot which is
+    // currently written
+    slot.sequenceNumber.store(0U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.timestamp.store(mepoo::ChunkHeader::currentPublishTime(), std::memory_order_relaxed);
+    slot.argument.store(argument, std::memory_order_relaxed);
+    slot.tracepoint.store(static_cast<uint8_t>(tracepoint), std::memory_order_relaxed);
+    slot.sequenceNumber.store(position + 1U, std::memory_order_release);
+
+    m_writeIndex.store(position + 1U, std::memory_order_release);
+}
+
+void TraceRing::forEachEvent(const function_ref<void(const TraceEvent&)> callable) const noexcept
+{
+    const auto endPosition = m_writeIndex.load(std::memory_order_acquire);
+    const auto startPosition = (endPosition > CAPACITY) ? endPosition - CAPACITY : 0U;
+
+    for (auto position = startPosition; position < endPosition; ++position)
+    {
+        const auto& slot = m_slots[position % CAPACITY];
+        const auto sequenceNumberBeforeRead = slot.sequenceNumber.load(std::memory_order_acquire);
+
+        TraceEvent event;
+        event.timestamp = slot.timestamp.load(std::memory_order_relaxed);
+        event.argument = slot.argument.load(std::memory_order_relaxed);
+        event.tracepoint = static_cast<Tracepoint>(slot.tracepoint.load(std::memory_order_relaxed));
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const auto sequenceNumberAfterRead = slot.sequenceNumber.load(std::memory_order_relaxed);
+
+        // the slot was overwritten by a newer event while it was read
+        if (sequenceNumberBeforeRead != position + 1U || sequenceNumberAfterRead != position + 1U)
+        {
+            continue;
+        }
+
+        callable(event);
+    }
+}
+
+uint64_t TraceRing::threadId() const noexcept
+{
+    return m_threadId.load(std::memory_order_relaxed);
+}
+
+void TraceRing::reset(const uint64_t threadId) noexcept
+{
+    m_threadId.store(threadId, std::memory_order_relaxed);
+    m_writeIndex.store(0U, std::memory_order_relaxed);
+    for (auto& slot : m_slots)
+    {
+        slot.sequenceNumber.store(0U, std::memory_order_relaxed);
+    }
+}
+
+TraceRing& TraceRing::threadLocalRing() noexcept
+{
+    struct RingHandle
+    {
+        RingHandle() noexcept
+            : ring(TraceRingRegistry::instance().acquire())
+        {
+        }
+
+        RingHandle(const RingHandle&) = delete;
+        RingHandle(RingHandle&&) = delete;
+        RingHandle& operator=(const RingHandle&) = delete;
+        RingHandle& operator=(RingHandle&&) = delete;
+
+        ~RingHandle() noexcept
+        {
+            TraceRingRegistry::instance().release(ring);
+        }
+
+        TraceRing* ring{nullptr};
+    };
+
+    thread_local static RingHandle handle;
+    return *handle.ring;
+}
+
+void TraceRing::forEachRing(const function_ref<void(const TraceRing&)> callable) noexcept
+{
+    TraceRingRegistry::instance().forEachRing(callable);
+}
+
+void writeTraceEventsAsChromeJson(std::ostream& stream) noexcept
+{
+    constexpr uint64_t NANOSECONDS_PER_MICROSECOND{1000U};
+    const auto processId = static_cast<uint64_t>(getpid());
+
+    stream << "{\"traceEvents\":[";
+    bool isFirstEvent{true};
+    TraceRing::forEachRing([&](const TraceRing& ring) {
+        ring.forEachEvent([&](const TraceEvent& event) {
+            // the timestamps of the format are in microseconds; the nanoseconds are kept as fraction
+            const auto fraction = event.timestamp % NANOSECONDS_PER_MICROSECOND;
+            const char* fractionPadding = (fraction < 10U) ? "00" : ((fraction < 100U) ? "0" : "");
+
+            stream << (isFirstEvent ? "\n" : ",\n") << "{\"name\":\"" << asStringLiteral(event.tracepoint)
+                   << "\",\"ph\":\"i\",\"s\":\"t\",\"ts\":" << event.timestamp / NANOSECONDS_PER_MICROSECOND << '.'
+                   << fractionPadding << fraction << ",\"pid\":" << processId << ",\"tid\":" << ring.threadId()
+                   << ",\"args\":{\"argument\":" << event.argument << "}}";
+            isFirstEvent = false;
+        });
+    });
+    stream << "\n]}\n";
+}
+
+} // namespace popo
+} // namespace iox
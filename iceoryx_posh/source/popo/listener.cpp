@@ -15,96 +15,11 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/popo/listener.hpp"
-#include "iox/assertions.hpp"
 
 namespace iox
 {
 namespace popo
 {
-Listener::Listener() noexcept
-    : Listener(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable())
-{
-}
-
-Listener::Listener(ConditionVariableData& conditionVariable) noexcept
-    : m_conditionVariableData(&conditionVariable)
-    , m_conditionListener(conditionVariable)
-{
-    m_thread = std::thread(&Listener::threadLoop, this);
-}
-
-Listener::~Listener() noexcept
-{
-    m_wasDtorCalled.store(true, std::memory_order_relaxed);
-    m_conditionListener.destroy();
-
-    m_thread.join();
-    m_conditionVariableData->m_toBeDestroyed.store(true, std::memory_order_relaxed);
-}
-
-uint64_t Listener::size() const noexcept
-{
-    return m_indexManager.indicesInUse();
-}
-
-void Listener::threadLoop() noexcept
-{
-    while (m_wasDtorCalled.load(std::memory_order_relaxed) == false)
-    {
-        auto activateNotificationIds = m_conditionListener.wait();
-
-        for (auto& id : activateNotificationIds)
-        {
-            m_events[id]->executeCallback();
-        }
-    }
-}
-
-void Listener::removeTrigger(const uint64_t index) noexcept
-{
-    if (index >= MAX_NUMBER_OF_EVENTS)
-    {
-        return;
-    }
-
-    if (m_events[index]->reset())
-    {
-        m_indexManager.push(static_cast<uint32_t>(index));
-    }
-}
-
-///////////////////////
-// BEGIN IndexManager_t
-///////////////////////
-Listener::IndexManager_t::IndexManager_t() noexcept
-{
-    m_loffli.init(m_loffliStorage, MAX_NUMBER_OF_EVENTS);
-}
-
-bool Listener::IndexManager_t::pop(uint32_t& value) noexcept
-{
-    if (m_loffli.pop(value))
-    {
-        ++m_indicesInUse;
-        return true;
-    }
-    return false;
-}
-
-void Listener::IndexManager_t::push(const uint32_t index) noexcept
-{
-    IOX_ENFORCE(m_loffli.push(index), "Releasing used index back to free list");
-    --m_indicesInUse;
-}
-
-uint64_t Listener::IndexManager_t::indicesInUse() const noexcept
-{
-    return m_indicesInUse.load(std::memory_order_relaxed);
-}
-/////////////////////
-// END IndexManager_t
-/////////////////////
-
 namespace internal
 {
 Event_t::~Event_t() noexcept
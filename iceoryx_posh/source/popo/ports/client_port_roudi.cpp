@@ -254,5 +254,14 @@ void ClientPortRouDi::releaseAllChunks() noexcept
     m_chunkReceiver.releaseAll();
 }
 
+void ClientPortRouDi::forEachHeldChunk(const function_ref<bool(const mepoo::ChunkManagement*)> isChunkManagement,
+                                       const function_ref<void(const mepoo::ChunkHeader*)> chunkInUse,
+                                       const function_ref<void(const mepoo::ChunkHeader*)> retainedChunk) noexcept
+{
+    m_chunkSender.forEachChunkInUse(isChunkManagement, chunkInUse);
+    m_chunkReceiver.forEachChunkInUse(isChunkManagement, chunkInUse);
+    m_chunkSender.forEachRetainedChunk(isChunkManagement, retainedChunk);
+}
+
 } // namespace popo
 } // namespace iox
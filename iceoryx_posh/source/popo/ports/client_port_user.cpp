@@ -100,6 +100,7 @@ void ClientPortUser::connect() noexcept
     if (!getMembers()->m_connectRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_connectRequested.store(true, std::memory_order_relaxed);
+        getMembers()->m_discoveryNotifier.notify();
     }
 }
 
@@ -108,6 +109,7 @@ void ClientPortUser::disconnect() noexcept
     if (getMembers()->m_connectRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_connectRequested.store(false, std::memory_order_relaxed);
+        getMembers()->m_discoveryNotifier.notify();
     }
 }
 
@@ -122,5 +122,13 @@ void PublisherPortRouDi::releaseAllChunks() noexcept
     m_chunkSender.releaseAll();
 }
 
+void PublisherPortRouDi::forEachHeldChunk(const function_ref<bool(const mepoo::ChunkManagement*)> isChunkManagement,
+                                          const function_ref<void(const mepoo::ChunkHeader*)> chunkInUse,
+                                          const function_ref<void(const mepoo::ChunkHeader*)> retainedChunk) noexcept
+{
+    m_chunkSender.forEachChunkInUse(isChunkManagement, chunkInUse);
+    m_chunkSender.forEachRetainedChunk(isChunkManagement, retainedChunk);
+}
+
 } // namespace popo
 } // namespace iox
@@ -59,6 +59,16 @@ void PublisherPortUser::sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcep
 
     if (offerRequested)
     {
+        // the statistics are only written by this thread, therefore relaxed loads and stores are sufficient and the
+        // locked read-modify-writes are avoided
+        auto& statistics = getMembers()->m_statistics;
+        statistics.m_chunksSent.store(statistics.m_chunksSent.load(std::memory_order_relaxed) + 1U,
+                                      std::memory_order_relaxed);
+        statistics.m_bytesSent.store(statistics.m_bytesSent.load(std::memory_order_relaxed)
+                                         + chunkHeader->userPayloadSize(),
+                                     std::memory_order_relaxed);
+        statistics.m_lastChunkSize.store(chunkHeader->chunkSize(), std::memory_order_relaxed);
+
         m_chunkSender.send(chunkHeader);
     }
     else
@@ -81,6 +91,7 @@ void PublisherPortUser::offer() noexcept
     if (!getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(true, std::memory_order_relaxed);
+        getMembers()->m_discoveryNotifier.notify();
     }
 }
 
@@ -89,6 +100,7 @@ void PublisherPortUser::stopOffer() noexcept
     if (getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(false, std::memory_order_relaxed);
+        getMembers()->m_discoveryNotifier.notify();
     }
 }
 
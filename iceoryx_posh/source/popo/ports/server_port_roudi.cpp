@@ -171,5 +171,14 @@ void ServerPortRouDi::releaseAllChunks() noexcept
     m_chunkReceiver.releaseAll();
 }
 
+void ServerPortRouDi::forEachHeldChunk(const function_ref<bool(const mepoo::ChunkManagement*)> isChunkManagement,
+                                       const function_ref<void(const mepoo::ChunkHeader*)> chunkInUse,
+                                       const function_ref<void(const mepoo::ChunkHeader*)> retainedChunk) noexcept
+{
+    m_chunkSender.forEachChunkInUse(isChunkManagement, chunkInUse);
+    m_chunkReceiver.forEachChunkInUse(isChunkManagement, chunkInUse);
+    m_chunkSender.forEachRetainedChunk(isChunkManagement, retainedChunk);
+}
+
 } // namespace popo
 } // namespace iox
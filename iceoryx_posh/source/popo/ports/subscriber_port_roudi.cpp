@@ -47,5 +47,12 @@ void SubscriberPortRouDi::releaseAllChunks() noexcept
     m_chunkReceiver.releaseAll();
 }
 
+void SubscriberPortRouDi::forEachChunkInUse(
+    const function_ref<bool(const mepoo::ChunkManagement*)> isChunkManagement,
+    const function_ref<void(const mepoo::ChunkHeader*)> chunkInUse) const noexcept
+{
+    m_chunkReceiver.forEachChunkInUse(isChunkManagement, chunkInUse);
+}
+
 } // namespace popo
 } // namespace iox
@@ -47,6 +47,7 @@ void SubscriberPortUser::subscribe() noexcept
         m_chunkReceiver.clear();
 
         getMembers()->m_subscribeRequested.store(true, std::memory_order_relaxed);
+        getMembers()->m_discoveryNotifier.notify();
     }
 }
 
@@ -55,6 +56,7 @@ void SubscriberPortUser::unsubscribe() noexcept
     if (getMembers()->m_subscribeRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_subscribeRequested.store(false, std::memory_order_relaxed);
+        getMembers()->m_discoveryNotifier.notify();
     }
 }
 
@@ -65,7 +67,26 @@ SubscribeState SubscriberPortUser::getSubscriptionState() const noexcept
 
 expected<const mepoo::ChunkHeader*, ChunkReceiveResult> SubscriberPortUser::tryGetChunk() noexcept
 {
-    return m_chunkReceiver.tryGet();
+    auto result = m_chunkReceiver.tryGet();
+    if (!result.has_error())
+    {
+        auto& statistics = getMembers()->m_statistics;
+        // only this thread writes the counter, therefore no read-modify-write is required
+        statistics.m_chunksReceived.store(statistics.m_chunksReceived.load(std::memory_order_relaxed) + 1U,
+                                          std::memory_order_relaxed);
+
+        // the timestamp is only set with 'IOX_LATENCY_STATISTICS'; history chunks are not recorded since they report
+        // their age instead of the latency
+        const auto publishTimestamp = result.value()->publishTimestamp();
+        if (build::IOX_LATENCY_STATISTICS_FLAG && publishTimestamp != mepoo::ChunkHeader::NO_PUBLISH_TIMESTAMP
+            && publishTimestamp
+                   > getMembers()->m_chunkReceiverData.m_newestHistoryPublishTimestamp.load(std::memory_order_relaxed))
+        {
+            const auto now = mepoo::ChunkHeader::currentPublishTime();
+            statistics.m_latency.record((now > publishTimestamp) ? now - publishTimestamp : 0U);
+        }
+    }
+    return result;
 }
 
 void SubscriberPortUser::releaseChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept
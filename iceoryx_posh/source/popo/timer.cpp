@@ -0,0 +1,159 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/timer.hpp"
+#include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iox/logging.hpp"
+
+namespace iox
+{
+namespace popo
+{
+// explicitly implemented for MSVC
+Timer::Timer() noexcept
+{
+}
+
+Timer::~Timer() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    releaseTimerSlot();
+}
+
+void Timer::startAt(const units::Duration deadline) noexcept
+{
+    start(deadline.toNanoseconds(), 0U);
+}
+
+void Timer::startPeriodic(const units::Duration period) noexcept
+{
+    startPeriodicAt(now() + period, period);
+}
+
+void Timer::startPeriodicAt(const units::Duration firstDeadline, const units::Duration period) noexcept
+{
+    start(firstDeadline.toNanoseconds(), period.toNanoseconds());
+}
+
+void Timer::stop() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    m_deadline = TimerSlot::DISARMED;
+    m_period = 0U;
+    if (m_timerSlot != nullptr)
+    {
+        IOX_DISCARD_RESULT(m_timerSlot->disarm());
+    }
+}
+
+bool Timer::hasFired() const noexcept
+{
+    return m_trigger.wasTriggered();
+}
+
+units::Duration Timer::now() noexcept
+{
+    return units::Duration::fromNanoseconds(TimerSlot::now());
+}
+
+void Timer::start(const uint64_t deadline, const uint64_t period) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    m_deadline = deadline;
+    m_period = period;
+    if (m_timerSlot != nullptr)
+    {
+        m_timerSlot->arm(m_deadline, m_period);
+        wakeUpWaiter();
+    }
+}
+
+void Timer::enableEvent(iox::popo::TriggerHandle&& triggerHandle) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    releaseTimerSlot();
+    m_trigger = std::move(triggerHandle);
+
+    auto* condVarData = m_trigger.getConditionVariableData();
+    if (condVarData == nullptr)
+    {
+        return;
+    }
+
+    for (auto& timerSlot : condVarData->m_timerSlots)
+    {
+        if (timerSlot.acquire(m_trigger.getUniqueId()))
+        {
+            m_timerSlot = &timerSlot;
+            break;
+        }
+    }
+
+    if (m_timerSlot == nullptr)
+    {
+        IOX_LOG(ERROR,
+                "Unable to arm the timer since all " << MAX_NUMBER_OF_TIMERS_PER_CONDITION_VARIABLE
+                                                     << " timer slots of the WaitSet/Listener are in use");
+        return;
+    }
+
+    if (m_deadline != TimerSlot::DISARMED)
+    {
+        m_timerSlot->arm(m_deadline, m_period);
+        wakeUpWaiter();
+    }
+}
+
+void Timer::disableEvent() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    releaseTimerSlot();
+    m_trigger.reset();
+}
+
+void Timer::invalidateTrigger(const uint64_t uniqueTriggerId) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    if (uniqueTriggerId == m_trigger.getUniqueId())
+    {
+        releaseTimerSlot();
+        m_trigger.invalidate();
+    }
+}
+
+void Timer::releaseTimerSlot() noexcept
+{
+    if (m_timerSlot == nullptr)
+    {
+        return;
+    }
+
+    // a one-shot timer which already fired stays disarmed and a periodic timer keeps its phase when it is attached
+    // again
+    m_deadline = m_timerSlot->disarm();
+    m_timerSlot->release();
+    m_timerSlot = nullptr;
+}
+
+void Timer::wakeUpWaiter() noexcept
+{
+    // the waiting thread has to re-evaluate the deadline, otherwise it could sleep past it
+    m_trigger.getConditionVariableData()->m_semaphore->post().or_else(
+        [](auto) { IOX_REPORT_FATAL(PoshError::POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY); });
+}
+
+} // namespace popo
+} // namespace iox
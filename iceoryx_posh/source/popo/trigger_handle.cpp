@@ -98,7 +98,8 @@ bool TriggerHandle::wasTriggered() const noexcept
     std::lock_guard<std::recursive_mutex> lock(m_mutex);
     if (m_conditionVariableDataPtr != nullptr)
     {
-        return m_conditionVariableDataPtr->m_activeNotifications[m_uniqueTriggerId].load(std::memory_order_relaxed);
+        return m_conditionVariableDataPtr->m_notifierSlots[m_uniqueTriggerId].m_isActive.load(
+            std::memory_order_relaxed);
     }
     return false;
 }
@@ -52,6 +52,7 @@ RouDiApp::RouDiApp(const IceoryxConfig& config) noexcept
         IOX_LOG(TRACE, "  Compatibility Check Level = " << roudiConfig.compatibilityCheckLevel);
         IOX_LOG(TRACE, "  Introspection Chunk Count = " << roudiConfig.introspectionChunkCount);
         IOX_LOG(TRACE, "  Discovery Chunk Count = " << roudiConfig.discoveryChunkCount);
+        IOX_LOG(TRACE, "  Discovery Shard Count = " << roudiConfig.discoveryShardCount);
     }
 }
 
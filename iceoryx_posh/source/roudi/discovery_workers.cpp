@@ -0,0 +1,135 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/discovery_workers.hpp"
+#include "iox/assertions.hpp"
+#include "iox/detail/convert.hpp"
+#include "iox/logging.hpp"
+#include "iox/thread.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace roudi
+{
+DiscoveryWorkers::DiscoveryWorkers(const uint32_t numberOfShards) noexcept
+    : m_numberOfShards(std::min(std::max(numberOfShards, 1U), MAX_NUMBER_OF_SHARDS))
+{
+    if (m_numberOfShards != numberOfShards)
+    {
+        IOX_LOG(WARN,
+                "The number of discovery shards is limited to [1, " << MAX_NUMBER_OF_SHARDS << "]! Using "
+                                                                    << m_numberOfShards << " instead of "
+                                                                    << numberOfShards << ".");
+    }
+
+    if (m_numberOfShards == 1U)
+    {
+        return;
+    }
+
+    UnnamedSemaphoreBuilder()
+        .initialValue(0U)
+        .isInterProcessCapable(false)
+        .create(m_finishedSemaphore)
+        .expect("Valid Semaphore");
+
+    for (uint32_t shard = 1U; shard < m_numberOfShards; ++shard)
+    {
+        UnnamedSemaphoreBuilder()
+            .initialValue(0U)
+            .isInterProcessCapable(false)
+            .create(m_startSemaphores[shard])
+            .expect("Valid Semaphore");
+
+        m_threads.emplace_back(&DiscoveryWorkers::work, this, shard);
+    }
+}
+
+DiscoveryWorkers::~DiscoveryWorkers() noexcept
+{
+    m_keepRunning.store(false, std::memory_order_relaxed);
+    for (uint32_t shard = 1U; shard < m_numberOfShards; ++shard)
+    {
+        IOX_DISCARD_RESULT(m_startSemaphores[shard]->post());
+    }
+
+    for (auto& thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+uint32_t DiscoveryWorkers::numberOfShards() const noexcept
+{
+    return m_numberOfShards;
+}
+
+void DiscoveryWorkers::run(const function_ref<void(const uint32_t)> shardHandler) noexcept
+{
+    if (m_numberOfShards == 1U)
+    {
+        shardHandler(0U);
+        return;
+    }
+
+    m_shardHandler = &shardHandler;
+    for (uint32_t shard = 1U; shard < m_numberOfShards; ++shard)
+    {
+        m_startSemaphores[shard]->post().or_else([](const auto& error) {
+            IOX_LOG(FATAL, "Could not start the discovery worker! Error: " << static_cast<uint32_t>(error));
+            IOX_PANIC("Discovery worker not started");
+        });
+    }
+
+    shardHandler(0U);
+
+    for (uint32_t shard = 1U; shard < m_numberOfShards; ++shard)
+    {
+        m_finishedSemaphore->wait().or_else([](const auto& error) {
+            IOX_LOG(FATAL, "Could not wait for the discovery workers! Error: " << static_cast<uint32_t>(error));
+            IOX_PANIC("Discovery workers not finished");
+        });
+    }
+    m_shardHandler = nullptr;
+}
+
+void DiscoveryWorkers::work(const uint32_t shard) noexcept
+{
+    setThreadName(ThreadName_t{TruncateToCapacity, ("Discover-" + convert::toString(shard)).c_str()});
+
+    while (true)
+    {
+        if (m_startSemaphores[shard]->wait().has_error())
+        {
+            IOX_LOG(ERROR, "Discovery worker " << shard << " could not wait for the next run");
+            continue;
+        }
+
+        if (!m_keepRunning.load(std::memory_order_relaxed))
+        {
+            break;
+        }
+
+        (*m_shardHandler)(shard);
+
+        IOX_DISCARD_RESULT(m_finishedSemaphore->post());
+    }
+}
+
+} // namespace roudi
+} // namespace iox
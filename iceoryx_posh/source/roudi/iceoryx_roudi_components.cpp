@@ -24,19 +24,21 @@ namespace roudi
 {
 IceOryxRouDiComponents::IceOryxRouDiComponents(const IceoryxConfig& config) noexcept
     : rouDiMemoryManager(config)
-    , portManager([&]() -> IceOryxRouDiMemoryManager* {
-        // this temporary object will create a roudi IPC channel
-        // and close it immediatelly
-        // if there was an outdated roudi IPC channel, it will be cleaned up
-        // if there is an outdated IPC channel, the start of the apps will be terminated
-        runtime::IpcInterfaceBase::cleanupOutdatedIpcChannel(roudi::IPC_CHANNEL_ROUDI_NAME);
+    , portManager(
+          [&]() -> IceOryxRouDiMemoryManager* {
+              // this temporary object will create a roudi IPC channel
+              // and close it immediatelly
+              // if there was an outdated roudi IPC channel, it will be cleaned up
+              // if there is an outdated IPC channel, the start of the apps will be terminated
+              runtime::IpcInterfaceBase::cleanupOutdatedIpcChannel(roudi::IPC_CHANNEL_ROUDI_NAME);
 
-        rouDiMemoryManager.createAndAnnounceMemory().or_else([](RouDiMemoryManagerError error) {
-            IOX_LOG(FATAL, "Could not create SharedMemory! Error: " << error);
-            IOX_REPORT_FATAL(PoshError::ROUDI_COMPONENTS__SHARED_MEMORY_UNAVAILABLE);
-        });
-        return &rouDiMemoryManager;
-    }())
+              rouDiMemoryManager.createAndAnnounceMemory().or_else([](RouDiMemoryManagerError error) {
+                  IOX_LOG(FATAL, "Could not create SharedMemory! Error: " << error);
+                  IOX_REPORT_FATAL(PoshError::ROUDI_COMPONENTS__SHARED_MEMORY_UNAVAILABLE);
+              });
+              return &rouDiMemoryManager;
+          }(),
+          config.discoveryShardCount)
 {
 }
 
@@ -19,6 +19,7 @@
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry_delta.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iox/memory.hpp"
 
@@ -41,6 +42,9 @@ DefaultRouDiMemory::DefaultRouDiMemory(const IceoryxConfig& config) noexcept
     m_managementShm.addMemoryBlock(&heartbeatPoolBlock).or_else([](auto) {
         IOX_REPORT_FATAL(PoshError::ROUDI__DEFAULT_ROUDI_MEMORY_FAILED_TO_ADD_HEARTBEAT_MEMORY_BLOCK);
     });
+    m_managementShm.addMemoryBlock(&requestChannelPoolBlock).or_else([](auto) {
+        IOX_REPORT_FATAL(PoshError::ROUDI__DEFAULT_ROUDI_MEMORY_FAILED_TO_ADD_REQUEST_CHANNEL_MEMORY_BLOCK);
+    });
     m_managementShm.addMemoryBlock(&m_segmentManagerBlock).or_else([](auto) {
         IOX_REPORT_FATAL(PoshError::ROUDI__DEFAULT_ROUDI_MEMORY_FAILED_TO_ADD_SEGMENT_MANAGER_MEMORY_BLOCK);
     });
@@ -61,6 +65,8 @@ mepoo::MePooConfig DefaultRouDiMemory::introspectionMemPoolConfig(const uint32_t
     mempoolConfig.m_mempoolConfig.push_back(
         {align(static_cast<uint32_t>(sizeof(roudi::SubscriberPortChangingIntrospectionFieldTopic)), ALIGNMENT),
          chunkCount});
+    mempoolConfig.m_mempoolConfig.push_back(
+        {align(static_cast<uint32_t>(sizeof(roudi::ChunkOwnershipIntrospectionTopic)), ALIGNMENT), chunkCount});
 
     mempoolConfig.optimize();
     return mempoolConfig;
@@ -72,6 +78,10 @@ mepoo::MePooConfig DefaultRouDiMemory::discoveryMemPoolConfig(const uint32_t chu
     mepoo::MePooConfig mempoolConfig;
     mempoolConfig.m_mempoolConfig.push_back(
         {align(static_cast<uint32_t>(sizeof(roudi::ServiceRegistry)), ALIGNMENT), chunkCount});
+    // the deltas are published more often than the snapshots and the subscribers queue more of them
+    mempoolConfig.m_mempoolConfig.push_back(
+        {align(static_cast<uint32_t>(sizeof(roudi::ServiceRegistryDelta)), ALIGNMENT),
+         chunkCount + roudi::ServiceRegistryDelta::QUEUE_CAPACITY + roudi::ServiceRegistryDelta::SNAPSHOT_INTERVAL});
 
     mempoolConfig.optimize();
     return mempoolConfig;
@@ -56,6 +56,7 @@ expected<void, RouDiMemoryManagerError> IceOryxRouDiMemoryManager::createAndAnno
 {
     auto result = m_memoryManager.createAndAnnounceMemory();
     m_defaultMemory.heartbeatPoolBlock.emplace();
+    m_defaultMemory.requestChannelPoolBlock.emplace();
     auto portPool = m_portPoolBlock.portPool();
     if (result.has_value() && portPool.has_value())
     {
@@ -94,6 +95,11 @@ optional<HeartbeatPool*> IceOryxRouDiMemoryManager::heartbeatPool() const noexce
     return m_defaultMemory.heartbeatPoolBlock.value();
 }
 
+optional<runtime::RequestChannelPool*> IceOryxRouDiMemoryManager::requestChannelPool() const noexcept
+{
+    return m_defaultMemory.requestChannelPoolBlock.value();
+}
+
 optional<mepoo::SegmentManager<>*> IceOryxRouDiMemoryManager::segmentManager() const noexcept
 {
     return m_defaultMemory.m_segmentManagerBlock.segmentManager();
@@ -49,7 +49,8 @@ capro::Interfaces StringToCaProInterface(const capro::IdString_t& str) noexcept
     return static_cast<capro::Interfaces>(i);
 }
 
-PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept
+PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface, const uint32_t numberOfDiscoveryShards) noexcept
+    : m_discoveryWorkers(numberOfDiscoveryShards)
 {
     m_roudiMemoryInterface = roudiMemoryInterface;
 
@@ -84,6 +85,20 @@ PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept
     PublisherPortRouDiType serviceRegistryPort(*m_serviceRegistryPublisherPortData);
     doDiscoveryForPublisherPort(serviceRegistryPort);
 
+    // the history enables late joiners to catch up with the deltas since the last snapshot
+    popo::PublisherOptions registryDeltaPortOptions;
+    registryDeltaPortOptions.historyCapacity = ServiceRegistryDelta::SNAPSHOT_INTERVAL;
+    registryDeltaPortOptions.nodeName = iox::NodeName_t("Service Registry");
+    registryDeltaPortOptions.offerOnCreate = true;
+
+    m_serviceRegistryDeltaPublisherPortData = acquireInternalPublisherPortDataWithoutDiscovery(
+        {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_DELTA_EVENT_NAME},
+        registryDeltaPortOptions,
+        discoveryMemoryManager);
+
+    PublisherPortRouDiType serviceRegistryDeltaPort(*m_serviceRegistryDeltaPublisherPortData);
+    doDiscoveryForPublisherPort(serviceRegistryDeltaPort);
+
     auto maybeIntrospectionMemoryManager = m_roudiMemoryInterface->introspectionMemoryManager();
     if (!maybeIntrospectionMemoryManager.has_value())
     {
@@ -109,6 +124,12 @@ PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept
                                               PublisherPortUserType(std::move(portThroughput)),
                                               PublisherPortUserType(std::move(subscriberPortsData)));
     m_portIntrospection.run();
+
+    popo::PublisherOptions chunkOwnershipOptions;
+    chunkOwnershipOptions.historyCapacity = 0U;
+    chunkOwnershipOptions.nodeName = INTROSPECTION_NODE_NAME;
+    m_chunkOwnershipPublisherPortData = acquireInternalPublisherPortData(
+        IntrospectionChunkOwnershipService, chunkOwnershipOptions, introspectionMemoryManager);
 }
 
 void PortManager::stopPortIntrospection() noexcept
@@ -118,19 +139,69 @@ void PortManager::stopPortIntrospection() noexcept
 
 void PortManager::doDiscovery() noexcept
 {
-    handlePublisherPorts();
+    if (m_discoveryWorkers.numberOfShards() == 1U)
+    {
+        handlePublisherPorts();
 
-    handleSubscriberPorts();
+        handleSubscriberPorts();
 
-    handleServerPorts();
+        handleServerPorts();
 
-    handleClientPorts();
+        handleClientPorts();
+    }
+    else
+    {
+        m_discoveryWorkers.run([this](const uint32_t shard) { doDiscoveryForShard(shard); });
+
+        // destroying a port modifies the port pool and the service port indices which are read by all shards
+        destroyPortsToBeDestroyed();
+    }
 
     handleInterfaces();
 
     handleConditionVariables();
 
     publishServiceRegistry();
+
+    publishChunkOwnership();
+}
+
+void PortManager::doDiscoveryForNotifiedPorts(
+    const popo::ConditionListener::NotificationVector_t& notifications) noexcept
+{
+    // the notifications are sorted by their index, therefore the ports are handled in the same order as with the
+    // cyclic discovery
+    for (const auto notificationIndex : notifications)
+    {
+        switch (static_cast<popo::DiscoveryNotificationOrigin>(notificationIndex))
+        {
+        case popo::DiscoveryNotificationOrigin::PUBLISHER_PORT:
+            handleDirtyPublisherPorts();
+            break;
+        case popo::DiscoveryNotificationOrigin::SUBSCRIBER_PORT:
+            handleDirtySubscriberPorts();
+            break;
+        case popo::DiscoveryNotificationOrigin::SERVER_PORT:
+            handleDirtyServerPorts();
+            break;
+        case popo::DiscoveryNotificationOrigin::CLIENT_PORT:
+            handleDirtyClientPorts();
+            break;
+        case popo::DiscoveryNotificationOrigin::INTERFACE_PORT:
+            handleInterfaces();
+            break;
+        case popo::DiscoveryNotificationOrigin::DISCOVERY_LOOP_TRIGGER:
+            // the discovery loop itself reacts on this notification
+            break;
+        }
+    }
+
+    publishServiceRegistry();
+}
+
+popo::ConditionVariableData& PortManager::discoveryConditionVariableData() noexcept
+{
+    return m_portPool->getDiscoveryConditionVariableData();
 }
 
 void PortManager::handlePublisherPorts() noexcept
@@ -141,15 +212,33 @@ void PortManager::handlePublisherPorts() noexcept
     while (port != publisherPorts.end())
     {
         auto currentPort = port++;
-        PublisherPortRouDiType publisherPort(currentPort.to_ptr());
-
-        doDiscoveryForPublisherPort(publisherPort);
+        handlePublisherPort(currentPort.to_ptr());
+    }
+}
 
-        // check if we have to destroy this publisher port
-        if (publisherPort.toBeDestroyed())
+void PortManager::handleDirtyPublisherPorts() noexcept
+{
+    auto& publisherPorts = m_portPool->getPublisherPortDataList();
+    m_portPool->getDirtyPublisherPorts().consume([&](const uint64_t index) {
+        // the port could already be destroyed by the cyclic discovery
+        auto port = publisherPorts.iter_from_index(static_cast<PortPoolData::PublisherContainer::IndexType>(index));
+        if (port != publisherPorts.end())
         {
-            destroyPublisherPort(currentPort.to_ptr());
+            handlePublisherPort(port.to_ptr());
         }
+    });
+}
+
+void PortManager::handlePublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData) noexcept
+{
+    PublisherPortRouDiType publisherPort(publisherPortData);
+
+    doDiscoveryForPublisherPort(publisherPort);
+
+    // check if we have to destroy this publisher port
+    if (publisherPort.toBeDestroyed())
+    {
+        destroyPublisherPort(publisherPortData);
     }
 }
 
@@ -190,15 +279,33 @@ void PortManager::handleSubscriberPorts() noexcept
     while (port != subscriberPorts.end())
     {
         auto currentPort = port++;
-        SubscriberPortType subscriberPort(currentPort.to_ptr());
-
-        doDiscoveryForSubscriberPort(subscriberPort);
+        handleSubscriberPort(currentPort.to_ptr());
+    }
+}
 
-        // check if we have to destroy this subscriber port
-        if (subscriberPort.toBeDestroyed())
+void PortManager::handleDirtySubscriberPorts() noexcept
+{
+    auto& subscriberPorts = m_portPool->getSubscriberPortDataList();
+    m_portPool->getDirtySubscriberPorts().consume([&](const uint64_t index) {
+        // the port could already be destroyed by the cyclic discovery
+        auto port = subscriberPorts.iter_from_index(static_cast<PortPoolData::SubscriberContainer::IndexType>(index));
+        if (port != subscriberPorts.end())
         {
-            destroySubscriberPort(currentPort.to_ptr());
+            handleSubscriberPort(port.to_ptr());
         }
+    });
+}
+
+void PortManager::handleSubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept
+{
+    SubscriberPortType subscriberPort(subscriberPortData);
+
+    doDiscoveryForSubscriberPort(subscriberPort);
+
+    // check if we have to destroy this subscriber port
+    if (subscriberPort.toBeDestroyed())
+    {
+        destroySubscriberPort(subscriberPortData);
     }
 }
 
@@ -263,6 +370,8 @@ void PortManager::destroyClientPort(popo::ClientPortData* const clientPortData)
                                                  << clientPortData->m_serviceDescription << "'");
 
     // delete client port from list after DISCONNECT was processed
+    m_clientPortIndex.remove(clientPortData);
+    m_clientPortRuntimeIndex.remove(clientPortData);
     m_portPool->removeClientPort(clientPortData);
 }
 
@@ -274,15 +383,33 @@ void PortManager::handleClientPorts() noexcept
     while (port != clientPorts.end())
     {
         auto currentPort = port++;
-        popo::ClientPortRouDi clientPort(*currentPort);
-
-        doDiscoveryForClientPort(clientPort);
+        handleClientPort(currentPort.to_ptr());
+    }
+}
 
-        // check if we have to destroy this clinet port
-        if (clientPort.toBeDestroyed())
+void PortManager::handleDirtyClientPorts() noexcept
+{
+    auto& clientPorts = m_portPool->getClientPortDataList();
+    m_portPool->getDirtyClientPorts().consume([&](const uint64_t index) {
+        // the port could already be destroyed by the cyclic discovery
+        auto port = clientPorts.iter_from_index(static_cast<PortPoolData::ClientContainer::IndexType>(index));
+        if (port != clientPorts.end())
         {
-            destroyClientPort(currentPort.to_ptr());
+            handleClientPort(port.to_ptr());
         }
+    });
+}
+
+void PortManager::handleClientPort(popo::ClientPortData* const clientPortData) noexcept
+{
+    popo::ClientPortRouDi clientPort(*clientPortData);
+
+    doDiscoveryForClientPort(clientPort);
+
+    // check if we have to destroy this clinet port
+    if (clientPort.toBeDestroyed())
+    {
+        destroyClientPort(clientPortData);
     }
 }
 
@@ -361,6 +488,8 @@ void PortManager::destroyServerPort(popo::ServerPortData* const serverPortData)
                                                  << serverPortData->m_serviceDescription << "'");
 
     // delete server port from list after STOP_OFFER was processed
+    m_serverPortIndex.remove(serverPortData);
+    m_serverPortRuntimeIndex.remove(serverPortData);
     m_portPool->removeServerPort(serverPortData);
 }
 
@@ -372,15 +501,33 @@ void PortManager::handleServerPorts() noexcept
     while (port != serverPorts.end())
     {
         auto currentPort = port++;
-        popo::ServerPortRouDi serverPort(*currentPort);
-
-        doDiscoveryForServerPort(serverPort);
+        handleServerPort(currentPort.to_ptr());
+    }
+}
 
-        // check if we have to destroy this server port
-        if (serverPort.toBeDestroyed())
+void PortManager::handleDirtyServerPorts() noexcept
+{
+    auto& serverPorts = m_portPool->getServerPortDataList();
+    m_portPool->getDirtyServerPorts().consume([&](const uint64_t index) {
+        // the port could already be destroyed by the cyclic discovery
+        auto port = serverPorts.iter_from_index(static_cast<PortPoolData::ServerContainer::IndexType>(index));
+        if (port != serverPorts.end())
         {
-            destroyServerPort(currentPort.to_ptr());
+            handleServerPort(port.to_ptr());
         }
+    });
+}
+
+void PortManager::handleServerPort(popo::ServerPortData* const serverPortData) noexcept
+{
+    popo::ServerPortRouDi serverPort(*serverPortData);
+
+    doDiscoveryForServerPort(serverPort);
+
+    // check if we have to destroy this server port
+    if (serverPort.toBeDestroyed())
+    {
+        destroyServerPort(serverPortData);
     }
 }
 
@@ -413,6 +560,93 @@ void PortManager::doDiscoveryForServerPort(popo::ServerPortRouDi& serverPort) no
     });
 }
 
+bool PortManager::isInDiscoveryShard(const capro::ServiceDescription& service, const uint32_t shard) const noexcept
+{
+    return service.getHash() % m_discoveryWorkers.numberOfShards() == shard;
+}
+
+void PortManager::doDiscoveryForShard(const uint32_t shard) noexcept
+{
+    for (auto& port : m_portPool->getPublisherPortDataList())
+    {
+        if (isInDiscoveryShard(port.m_serviceDescription, shard))
+        {
+            PublisherPortRouDiType publisherPort(&port);
+            doDiscoveryForPublisherPort(publisherPort);
+        }
+    }
+
+    for (auto& port : m_portPool->getSubscriberPortDataList())
+    {
+        if (isInDiscoveryShard(port.m_serviceDescription, shard))
+        {
+            SubscriberPortType subscriberPort(&port);
+            doDiscoveryForSubscriberPort(subscriberPort);
+        }
+    }
+
+    for (auto& port : m_portPool->getServerPortDataList())
+    {
+        if (isInDiscoveryShard(port.m_serviceDescription, shard))
+        {
+            popo::ServerPortRouDi serverPort(port);
+            doDiscoveryForServerPort(serverPort);
+        }
+    }
+
+    for (auto& port : m_portPool->getClientPortDataList())
+    {
+        if (isInDiscoveryShard(port.m_serviceDescription, shard))
+        {
+            popo::ClientPortRouDi clientPort(port);
+            doDiscoveryForClientPort(clientPort);
+        }
+    }
+}
+
+void PortManager::destroyPortsToBeDestroyed() noexcept
+{
+    auto& publisherPorts = m_portPool->getPublisherPortDataList();
+    for (auto port = publisherPorts.begin(); port != publisherPorts.end();)
+    {
+        auto currentPort = port++;
+        if (PublisherPortRouDiType(currentPort.to_ptr()).toBeDestroyed())
+        {
+            destroyPublisherPort(currentPort.to_ptr());
+        }
+    }
+
+    auto& subscriberPorts = m_portPool->getSubscriberPortDataList();
+    for (auto port = subscriberPorts.begin(); port != subscriberPorts.end();)
+    {
+        auto currentPort = port++;
+        if (SubscriberPortType(currentPort.to_ptr()).toBeDestroyed())
+        {
+            destroySubscriberPort(currentPort.to_ptr());
+        }
+    }
+
+    auto& serverPorts = m_portPool->getServerPortDataList();
+    for (auto port = serverPorts.begin(); port != serverPorts.end();)
+    {
+        auto currentPort = port++;
+        if (popo::ServerPortRouDi(*currentPort.to_ptr()).toBeDestroyed())
+        {
+            destroyServerPort(currentPort.to_ptr());
+        }
+    }
+
+    auto& clientPorts = m_portPool->getClientPortDataList();
+    for (auto port = clientPorts.begin(); port != clientPorts.end();)
+    {
+        auto currentPort = port++;
+        if (popo::ClientPortRouDi(*currentPort.to_ptr()).toBeDestroyed())
+        {
+            destroyClientPort(currentPort.to_ptr());
+        }
+    }
+}
+
 void PortManager::handleInterfaces() noexcept
 {
     // check if there are new interfaces that must get an initial offer information
@@ -437,7 +671,7 @@ void PortManager::handleInterfaces() noexcept
                     "Destroy interface port from runtime '" << currentPort->m_runtimeName
                                                             << "' and with service description '"
                                                             << currentPort->m_serviceDescription << "'");
-            m_portPool->removeInterfacePort(currentPort.to_ptr());
+            destroyInterfacePort(currentPort.to_ptr());
         }
     }
 
@@ -498,7 +732,7 @@ void PortManager::handleConditionVariables() noexcept
         if (currentCondVar->m_toBeDestroyed.load(std::memory_order_relaxed))
         {
             IOX_LOG(DEBUG, "Destroy ConditionVariableData from runtime '" << currentCondVar->m_runtimeName << "'");
-            m_portPool->removeConditionVariableData(currentCondVar.to_ptr());
+            destroyConditionVariableData(currentCondVar.to_ptr());
         }
     }
 }
@@ -527,9 +761,9 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
                                                   SubscriberPortType& subscriberSource) noexcept
 {
     bool publisherFound = false;
-    for (auto& publisherPortData : m_portPool->getPublisherPortDataList())
+    for (auto* publisherPortData : m_publisherPortIndex.find(subscriberSource.getCaProServiceDescription()))
     {
-        PublisherPortRouDiType publisherPort(&publisherPortData);
+        PublisherPortRouDiType publisherPort(publisherPortData);
 
         auto messageInterface = message.m_serviceDescription.getSourceInterface();
         auto publisherInterface = publisherPort.getCaProServiceDescription().getSourceInterface();
@@ -565,9 +799,9 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
 void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& message,
                                                    PublisherPortRouDiType& publisherSource) noexcept
 {
-    for (auto& subscriberPortData : m_portPool->getSubscriberPortDataList())
+    for (auto* subscriberPortData : m_subscriberPortIndex.find(publisherSource.getCaProServiceDescription()))
     {
-        SubscriberPortType subscriberPort(&subscriberPortData);
+        SubscriberPortType subscriberPort(subscriberPortData);
 
         auto messageInterface = message.m_serviceDescription.getSourceInterface();
         auto subscriberInterface = subscriberPort.getCaProServiceDescription().getSourceInterface();
@@ -631,9 +865,9 @@ bool PortManager::isCompatibleClientServer(const popo::ServerPortRouDi& server,
 void PortManager::sendToAllMatchingClientPorts(const capro::CaproMessage& message,
                                                popo::ServerPortRouDi& serverSource) noexcept
 {
-    for (auto& clientPortData : m_portPool->getClientPortDataList())
+    for (auto* clientPortData : m_clientPortIndex.find(serverSource.getCaProServiceDescription()))
     {
-        popo::ClientPortRouDi clientPort(clientPortData);
+        popo::ClientPortRouDi clientPort(*clientPortData);
         if (isCompatibleClientServer(serverSource, clientPort))
         {
             // send OFFER/STOP_OFFER to client
@@ -670,9 +904,9 @@ bool PortManager::sendToAllMatchingServerPorts(const capro::CaproMessage& messag
                                                popo::ClientPortRouDi& clientSource) noexcept
 {
     bool serverFound = false;
-    for (auto& serverPortData : m_portPool->getServerPortDataList())
+    for (auto* serverPortData : m_serverPortIndex.find(clientSource.getCaProServiceDescription()))
     {
-        popo::ServerPortRouDi serverPort(serverPortData);
+        popo::ServerPortRouDi serverPort(*serverPortData);
         if (isCompatibleClientServer(serverPort, clientSource))
         {
             // send CONNECT/DISCONNECT to server
@@ -698,6 +932,7 @@ bool PortManager::sendToAllMatchingServerPorts(const capro::CaproMessage& messag
 
 void PortManager::sendToAllMatchingInterfacePorts(const capro::CaproMessage& message) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_interfacePortsMutex);
     for (auto& interfacePortData : m_portPool->getInterfacePortDataList())
     {
         iox::popo::InterfacePort interfacePort(&interfacePortData);
@@ -756,81 +991,62 @@ void PortManager::deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcep
     if (runtimeName == RuntimeName_t(iox::roudi::IPC_CHANNEL_ROUDI_NAME))
     {
         m_serviceRegistryPublisherPortData.reset();
+        m_chunkOwnershipPublisherPortData.reset();
     }
-    auto& publisherPorts = m_portPool->getPublisherPortDataList();
-    auto publisherPort = publisherPorts.begin();
-    while (publisherPort != publisherPorts.end())
+
+    // only the resources of the runtime are touched; the lists are copied since destroying a port removes it from the
+    // runtime index
+    const auto publisherPorts = m_publisherPortRuntimeIndex.find(runtimeName);
+    for (auto* publisherPortData : publisherPorts)
     {
-        auto currentPort = publisherPort++;
-        PublisherPortRouDiType sender(currentPort.to_ptr());
-        if (runtimeName == sender.getRuntimeName())
-        {
-            destroyPublisherPort(currentPort.to_ptr());
-        }
+        destroyPublisherPort(publisherPortData);
     }
 
-    auto& subscriberPorts = m_portPool->getSubscriberPortDataList();
-    auto subscriberPort = subscriberPorts.begin();
-    while (subscriberPort != subscriberPorts.end())
+    const auto subscriberPorts = m_subscriberPortRuntimeIndex.find(runtimeName);
+    for (auto* subscriberPortData : subscriberPorts)
     {
-        auto currentPort = subscriberPort++;
-        SubscriberPortUserType subscriber(currentPort.to_ptr());
-        if (runtimeName == subscriber.getRuntimeName())
-        {
-            destroySubscriberPort(currentPort.to_ptr());
-        }
+        destroySubscriberPort(subscriberPortData);
     }
 
-    auto& serverPorts = m_portPool->getServerPortDataList();
-    auto serverPort = serverPorts.begin();
-    while (serverPort != serverPorts.end())
+    const auto serverPorts = m_serverPortRuntimeIndex.find(runtimeName);
+    for (auto* serverPortData : serverPorts)
     {
-        auto currentPort = serverPort++;
-        popo::ServerPortRouDi server(*currentPort);
-        if (runtimeName == server.getRuntimeName())
-        {
-            destroyServerPort(currentPort.to_ptr());
-        }
+        destroyServerPort(serverPortData);
     }
 
-    auto& clientPorts = m_portPool->getClientPortDataList();
-    auto clientPort = clientPorts.begin();
-    while (clientPort != clientPorts.end())
+    const auto clientPorts = m_clientPortRuntimeIndex.find(runtimeName);
+    for (auto* clientPortData : clientPorts)
     {
-        auto currentPort = clientPort++;
-        popo::ClientPortRouDi client(*currentPort);
-        if (runtimeName == client.getRuntimeName())
-        {
-            destroyClientPort(currentPort.to_ptr());
-        }
+        destroyClientPort(clientPortData);
     }
 
-    auto& interfacePorts = m_portPool->getInterfacePortDataList();
-    auto interfacePort = interfacePorts.begin();
-    while (interfacePort != interfacePorts.end())
+    const auto interfacePorts = m_interfacePortRuntimeIndex.find(runtimeName);
+    for (auto* interfacePortData : interfacePorts)
     {
-        auto currentPort = interfacePort++;
-        popo::InterfacePort interface(currentPort.to_ptr());
-        if (runtimeName == interface.getRuntimeName())
-        {
-            IOX_LOG(DEBUG, "Deleted Interface of application " << runtimeName);
-            m_portPool->removeInterfacePort(currentPort.to_ptr());
-        }
+        IOX_LOG(DEBUG, "Deleted Interface of application " << runtimeName);
+        destroyInterfacePort(interfacePortData);
     }
 
-    auto& condVars = m_portPool->getConditionVariableDataList();
-    auto condVar = condVars.begin();
-    while (condVar != condVars.end())
+    const auto condVars = m_conditionVariableRuntimeIndex.find(runtimeName);
+    for (auto* condVar : condVars)
     {
-        auto currentCondVar = condVar++;
-        if (runtimeName == currentCondVar->m_runtimeName)
-        {
-            IOX_LOG(DEBUG, "Deleted condition variable of application" << runtimeName);
-            m_portPool->removeConditionVariableData(currentCondVar.to_ptr());
-        }
+        IOX_LOG(DEBUG, "Deleted condition variable of application" << runtimeName);
+        destroyConditionVariableData(condVar);
     }
 }
 
+void PortManager::destroyInterfacePort(popo::InterfacePortData* const interfacePortData) noexcept
+{
+    m_interfacePortRuntimeIndex.remove(interfacePortData);
+    m_portPool->removeInterfacePort(interfacePortData);
+}
+
+void PortManager::destroyConditionVariableData(popo::ConditionVariableData* const conditionVariableData) noexcept
+{
+    m_conditionVariableRuntimeIndex.remove(conditionVariableData);
+    m_portPool->removeConditionVariableData(conditionVariableData);
+}
+
 void PortManager::destroyPublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData) noexcept
 {
     // create temporary publisher ports to orderly shut this publisher down
@@ -858,6 +1074,8 @@ void PortManager::destroyPublisherPort(PublisherPortRouDiType::MemberType_t* con
                                                     << "' and with service description '"
                                                     << publisherPortData->m_serviceDescription << "'");
     // delete publisher port from list after STOP_OFFER was processed
+    m_publisherPortIndex.remove(publisherPortData);
+    m_publisherPortRuntimeIndex.remove(publisherPortData);
     m_portPool->removePublisherPort(publisherPortData);
 }
 
@@ -886,6 +1104,8 @@ void PortManager::destroySubscriberPort(SubscriberPortType::MemberType_t* const
                                                      << "' and with service description '"
                                                      << subscriberPortData->m_serviceDescription << "'");
     // delete subscriber port from list after UNSUB was processed
+    m_subscriberPortIndex.remove(subscriberPortData);
+    m_subscriberPortRuntimeIndex.remove(subscriberPortData);
     m_portPool->removeSubscriberPort(subscriberPortData);
 }
 
@@ -944,6 +1164,8 @@ PortManager::acquirePublisherPortDataWithoutDiscovery(const capro::ServiceDescri
         auto publisherPortData = maybePublisherPortData.value();
         if (publisherPortData)
         {
+            m_publisherPortIndex.add(publisherPortData);
+            m_publisherPortRuntimeIndex.add(publisherPortData);
             m_portIntrospection.addPublisher(*publisherPortData);
         }
     }
@@ -997,6 +1219,8 @@ PortManager::acquireSubscriberPortData(const capro::ServiceDescription& service,
         auto subscriberPortData = maybeSubscriberPortData.value();
         if (subscriberPortData)
         {
+            m_subscriberPortIndex.add(subscriberPortData);
+            m_subscriberPortRuntimeIndex.add(subscriberPortData);
             m_portIntrospection.addSubscriber(*subscriberPortData);
 
             // we do discovery here for trying to connect with publishers if subscribe on create is desired
@@ -1019,6 +1243,8 @@ PortManager::acquireClientPortData(const capro::ServiceDescription& service,
     return m_portPool
         ->addClientPort(service, payloadDataSegmentMemoryManager, runtimeName, clientOptions, portConfigInfo.memoryInfo)
         .and_then([this](auto clientPortData) {
+            m_clientPortIndex.add(clientPortData);
+            m_clientPortRuntimeIndex.add(clientPortData);
             /// @todo iox-#1128 add to port introspection
 
             // we do discovery here for trying to connect the client if offer on create is desired
@@ -1035,35 +1261,32 @@ PortManager::acquireServerPortData(const capro::ServiceDescription& service,
                                    const PortConfigInfo& portConfigInfo) noexcept
 {
     // it is not allowed to have two servers with the same ServiceDescription;
-    // check if the server is already in the list
-    auto& serverPorts = m_portPool->getServerPortDataList();
-    auto port = serverPorts.begin();
-    while (port != serverPorts.end())
+    // check if the server is already in the list; the lookup is repeated after a port was destroyed since this also
+    // removes the port from the index
+    while (!m_serverPortIndex.find(service).empty())
     {
-        auto currentPort = port++;
-
-        if (service == currentPort->m_serviceDescription)
+        auto* serverPortData = m_serverPortIndex.find(service).front();
+        if (serverPortData->m_toBeDestroyed)
         {
-            if (currentPort->m_toBeDestroyed)
-            {
-                destroyServerPort(currentPort.to_ptr());
-                continue;
-            }
-            IOX_LOG(WARN,
-                    "Process '"
-                        << runtimeName
-                        << "' violates the communication policy by requesting a ServerPort which is already used by '"
-                        << currentPort->m_runtimeName << "' with service '"
-                        << service.operator Serialization().toString() << "'.");
-            IOX_REPORT(PoshError::POSH__PORT_MANAGER_SERVERPORT_NOT_UNIQUE, iox::er::RUNTIME_ERROR);
-            return err(PortPoolError::UNIQUE_SERVER_PORT_ALREADY_EXISTS);
+            destroyServerPort(serverPortData);
+            continue;
         }
+        IOX_LOG(WARN,
+                "Process '"
+                    << runtimeName
+                    << "' violates the communication policy by requesting a ServerPort which is already used by '"
+                    << serverPortData->m_runtimeName << "' with service '"
+                    << service.operator Serialization().toString() << "'.");
+        IOX_REPORT(PoshError::POSH__PORT_MANAGER_SERVERPORT_NOT_UNIQUE, iox::er::RUNTIME_ERROR);
+        return err(PortPoolError::UNIQUE_SERVER_PORT_ALREADY_EXISTS);
     }
 
     // we can create a new port
     return m_portPool
         ->addServerPort(service, payloadDataSegmentMemoryManager, runtimeName, serverOptions, portConfigInfo.memoryInfo)
         .and_then([this](auto serverPortData) {
+            m_serverPortIndex.add(serverPortData);
+            m_serverPortRuntimeIndex.add(serverPortData);
             /// @todo iox-#1128 add to port introspection
 
             // we do discovery here for trying to connect the waiting client if offer on create is desired
@@ -1079,6 +1302,9 @@ popo::InterfacePortData* PortManager::acquireInterfacePortData(capro::Interfaces
     auto result = m_portPool->addInterfacePort(runtimeName, interface);
     if (result.has_value())
     {
+        m_interfacePortRuntimeIndex.add(result.value());
+        // wake up the discovery loop to forward the initial offers to the new interface
+        result.value()->m_discoveryNotifier.notify();
         return result.value();
     }
     else
@@ -1101,28 +1327,228 @@ void PortManager::publishServiceRegistry() noexcept
         IOX_LOG(WARN, "Could not publish service registry!");
         return;
     }
+
+    m_serviceRegistryDelta.setChangeCounter(m_serviceRegistry.changeCounter());
+
+    // the snapshot is published before the delta; a ServiceDiscovery which cannot apply the delta therefore already
+    // finds the snapshot in its queue
+    const bool isSnapshotInterval =
+        (m_numberOfServiceRegistryPublications % ServiceRegistryDelta::SNAPSHOT_INTERVAL) == 0U;
+    // the ServiceDiscovery holds its latest snapshot sample, therefore the snapshot chunks can run out when many
+    // ServiceDiscovery instances hold different snapshots; a failed snapshot is retried with the next publication
+    bool isSnapshotRequired = !m_serviceRegistryDeltaPublisherPortData.has_value()
+                              || !m_serviceRegistryDelta.isComplete() || isSnapshotInterval
+                              || m_isServiceRegistrySnapshotPending;
+    bool isSnapshotPublished{false};
+    if (isSnapshotRequired)
+    {
+        isSnapshotPublished = publishServiceRegistrySnapshot();
+    }
+
+    if (m_serviceRegistryDeltaPublisherPortData.has_value() && !publishServiceRegistryDelta() && !isSnapshotRequired)
+    {
+        isSnapshotRequired = true;
+        isSnapshotPublished = publishServiceRegistrySnapshot();
+    }
+    m_isServiceRegistrySnapshotPending = isSnapshotRequired && !isSnapshotPublished;
+
+    ++m_numberOfServiceRegistryPublications;
+    m_serviceRegistryDelta.reset(m_serviceRegistry.changeCounter());
+}
+
+bool PortManager::publishServiceRegistrySnapshot() noexcept
+{
     PublisherPortUserType publisher(m_serviceRegistryPublisherPortData.value());
-    publisher
+    return publisher
         .tryAllocateChunk(sizeof(ServiceRegistry),
                           alignof(ServiceRegistry),
                           CHUNK_NO_USER_HEADER_SIZE,
                           CHUNK_NO_USER_HEADER_ALIGNMENT)
         .and_then([&](auto& chunk) {
             // It's ok to copy as the modifications happen in the same thread and not concurrently
-            new (chunk->userPayload()) ServiceRegistry(m_serviceRegistry);
+            new (chunk->userPayload()) ServiceRegistry(m_serviceRegistry.registry());
+
+            publisher.sendChunk(chunk);
+        })
+        .or_else([](auto&) { IOX_LOG(WARN, "Could not allocate a chunk for the service registry!"); })
+        .has_value();
+}
+
+bool PortManager::publishServiceRegistryDelta() noexcept
+{
+    PublisherPortUserType publisher(m_serviceRegistryDeltaPublisherPortData.value());
+    return publisher
+        .tryAllocateChunk(sizeof(ServiceRegistryDelta),
+                          alignof(ServiceRegistryDelta),
+                          CHUNK_NO_USER_HEADER_SIZE,
+                          CHUNK_NO_USER_HEADER_ALIGNMENT)
+        .and_then([&](auto& chunk) {
+            new (chunk->userPayload()) ServiceRegistryDelta(m_serviceRegistryDelta);
+
+            publisher.sendChunk(chunk);
+        })
+        .or_else([](auto&) { IOX_LOG(WARN, "Could not allocate a chunk for the service registry delta!"); })
+        .has_value();
+}
+
+void PortManager::publishChunkOwnership() noexcept
+{
+    if (!m_chunkOwnershipPublisherPortData.has_value() || !m_chunkOwnershipIntrospectionTimer.hasExpired())
+    {
+        return;
+    }
+
+    // scanning the ports is only done on demand and not on the data path
+    PublisherPortUserType publisher(m_chunkOwnershipPublisherPortData.value());
+    if (!publisher.hasSubscribers())
+    {
+        return;
+    }
+    m_chunkOwnershipIntrospectionTimer.reset(CHUNK_OWNERSHIP_INTROSPECTION_INTERVAL);
+
+    publisher
+        .tryAllocateChunk(sizeof(ChunkOwnershipIntrospectionTopic),
+                          alignof(ChunkOwnershipIntrospectionTopic),
+                          CHUNK_NO_USER_HEADER_SIZE,
+                          CHUNK_NO_USER_HEADER_ALIGNMENT)
+        .and_then([&](auto& chunk) {
+            auto topic = new (chunk->userPayload()) ChunkOwnershipIntrospectionTopic();
+            collectChunkOwnership(*topic);
 
             publisher.sendChunk(chunk);
         })
-        .or_else([](auto&) { IOX_LOG(WARN, "Could not allocate a chunk for the service registry!"); });
+        .or_else([](auto&) { IOX_LOG(WARN, "Could not allocate a chunk for the chunk ownership introspection!"); });
+}
+
+void PortManager::collectChunkOwnership(ChunkOwnershipIntrospectionTopic& topic) noexcept
+{
+    // the index is the same as the id of the MemPoolIntrospectionInfo, i.e. the RouDi internal memory first and then
+    // the shared memory segments; chunks of other memory, like the service registry, are not attributed
+    vector<mepoo::MemoryManager*, MAX_SHM_SEGMENTS + 1U> memoryManagers;
+    memoryManagers.push_back(m_roudiMemoryInterface->introspectionMemoryManager().value_or(nullptr));
+    m_roudiMemoryInterface->segmentManager().and_then([&](auto segmentManager) {
+        for (auto& segment : segmentManager->m_segmentContainer)
+        {
+            memoryManagers.push_back(&segment.getMemoryManager());
+        }
+    });
+
+    auto& ownershipList = topic.m_chunkOwnershipList;
+    uint64_t firstEntryOfPort{0U};
+    ChunkOwnershipData portEntry;
+
+    auto startPort = [&](const RuntimeName_t& runtimeName, const popo::UniquePortId& uniqueId) {
+        firstEntryOfPort = ownershipList.size();
+        portEntry = ChunkOwnershipData();
+        portEntry.m_runtimeName = runtimeName;
+        portEntry.m_portID = static_cast<uint64_t>(uniqueId);
+    };
+
+    auto recordChunk = [&](const mepoo::ChunkHeader* const chunkHeader, const bool isRetained) {
+        for (uint32_t segmentId = 0U; segmentId < memoryManagers.size(); ++segmentId)
+        {
+            if (memoryManagers[segmentId] == nullptr)
+            {
+                continue;
+            }
+
+            const auto memPoolIndex = memoryManagers[segmentId]->getMemPoolIndex(chunkHeader);
+            if (!memPoolIndex.has_value())
+            {
+                continue;
+            }
+
+            auto entryIndex = firstEntryOfPort;
+            while (entryIndex < ownershipList.size()
+                   && (ownershipList[entryIndex].m_segmentId != segmentId
+                       || ownershipList[entryIndex].m_memPoolIndex != memPoolIndex.value()))
+            {
+                ++entryIndex;
+            }
+
+            if (entryIndex == ownershipList.size())
+            {
+                portEntry.m_segmentId = segmentId;
+                portEntry.m_memPoolIndex = memPoolIndex.value();
+                if (!ownershipList.push_back(portEntry))
+                {
+                    topic.m_isTruncated = true;
+                    return;
+                }
+            }
+
+            auto& entry = ownershipList[entryIndex];
+            if (isRetained)
+            {
+                ++entry.m_chunksRetained;
+            }
+            else
+            {
+                ++entry.m_chunksInUse;
+            }
+            return;
+        }
+    };
+    // the applications change their chunks concurrently; only entries which refer to a ChunkManagement of the known
+    // memory are dereferenced
+    auto isChunkManagement = [&](const mepoo::ChunkManagement* chunkManagement) {
+        for (const auto memoryManager : memoryManagers)
+        {
+            if (memoryManager != nullptr && memoryManager->containsChunkManagement(chunkManagement))
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+    auto recordChunkInUse = [&](const mepoo::ChunkHeader* chunkHeader) { recordChunk(chunkHeader, false); };
+    auto recordRetainedChunk = [&](const mepoo::ChunkHeader* chunkHeader) { recordChunk(chunkHeader, true); };
+
+    for (auto& publisherPortData : m_portPool->getPublisherPortDataList())
+    {
+        PublisherPortRouDiType publisherPort(&publisherPortData);
+        startPort(publisherPort.getRuntimeName(), publisherPort.getUniqueID());
+        publisherPort.forEachHeldChunk(isChunkManagement, recordChunkInUse, recordRetainedChunk);
+    }
+
+    for (auto& subscriberPortData : m_portPool->getSubscriberPortDataList())
+    {
+        SubscriberPortType subscriberPort(&subscriberPortData);
+        startPort(subscriberPort.getRuntimeName(), subscriberPort.getUniqueID());
+        subscriberPort.forEachChunkInUse(isChunkManagement, recordChunkInUse);
+    }
+
+    for (auto& clientPortData : m_portPool->getClientPortDataList())
+    {
+        popo::ClientPortRouDi clientPort(clientPortData);
+        startPort(clientPort.getRuntimeName(), clientPort.getUniqueID());
+        clientPort.forEachHeldChunk(isChunkManagement, recordChunkInUse, recordRetainedChunk);
+    }
+
+    for (auto& serverPortData : m_portPool->getServerPortDataList())
+    {
+        popo::ServerPortRouDi serverPort(serverPortData);
+        startPort(serverPort.getRuntimeName(), serverPort.getUniqueID());
+        serverPort.forEachHeldChunk(isChunkManagement, recordChunkInUse, recordRetainedChunk);
+    }
+}
+
+void PortManager::recordServiceRegistryChange(const ServiceRegistryDelta::Operation operation,
+                                              const capro::ServiceDescription& service) noexcept
+{
+    // an overflow is not an error; the next publication contains a snapshot instead of the delta
+    IOX_DISCARD_RESULT(m_serviceRegistryDelta.record(operation, service));
 }
 
-const ServiceRegistry& PortManager::serviceRegistry() const noexcept
+const IndexedServiceRegistry& PortManager::serviceRegistry() const noexcept
 {
     return m_serviceRegistry;
 }
 
 void PortManager::addPublisherToServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_serviceRegistryMutex);
+    recordServiceRegistryChange(ServiceRegistryDelta::Operation::ADD_PUBLISHER, service);
     m_serviceRegistry.addPublisher(service).or_else([&](auto&) {
         IOX_LOG(WARN, "Could not add publisher with service description '" << service << "' to service registry!");
         IOX_REPORT(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, iox::er::RUNTIME_ERROR);
@@ -1131,11 +1557,15 @@ void PortManager::addPublisherToServiceRegistry(const capro::ServiceDescription&
 
 void PortManager::removePublisherFromServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_serviceRegistryMutex);
+    recordServiceRegistryChange(ServiceRegistryDelta::Operation::REMOVE_PUBLISHER, service);
     m_serviceRegistry.removePublisher(service);
 }
 
 void PortManager::addServerToServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_serviceRegistryMutex);
+    recordServiceRegistryChange(ServiceRegistryDelta::Operation::ADD_SERVER, service);
     m_serviceRegistry.addServer(service).or_else([&](auto&) {
         IOX_LOG(WARN, "Could not add server with service description '" << service << "' to service registry!");
         IOX_REPORT(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, iox::er::RUNTIME_ERROR);
@@ -1144,13 +1574,16 @@ void PortManager::addServerToServiceRegistry(const capro::ServiceDescription& se
 
 void PortManager::removeServerFromServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_serviceRegistryMutex);
+    recordServiceRegistryChange(ServiceRegistryDelta::Operation::REMOVE_SERVER, service);
     m_serviceRegistry.removeServer(service);
 }
 
 expected<popo::ConditionVariableData*, PortPoolError>
 PortManager::acquireConditionVariableData(const RuntimeName_t& runtimeName) noexcept
 {
-    return m_portPool->addConditionVariableData(runtimeName);
+    return m_portPool->addConditionVariableData(runtimeName).and_then(
+        [this](auto conditionVariableData) { m_conditionVariableRuntimeIndex.add(conditionVariableData); });
 }
 
 bool PortManager::isInternal(const capro::ServiceDescription& service) const noexcept
@@ -38,6 +38,31 @@ PortPoolData::CondVarContainer& PortPool::getConditionVariableDataList() noexcep
     return m_portPoolData->m_conditionVariableMembers;
 }
 
+popo::ConditionVariableData& PortPool::getDiscoveryConditionVariableData() noexcept
+{
+    return m_portPoolData->m_discoveryConditionVariableData;
+}
+
+PortPoolData::DirtyPublisherPorts& PortPool::getDirtyPublisherPorts() noexcept
+{
+    return m_portPoolData->m_dirtyPublisherPorts;
+}
+
+PortPoolData::DirtySubscriberPorts& PortPool::getDirtySubscriberPorts() noexcept
+{
+    return m_portPoolData->m_dirtySubscriberPorts;
+}
+
+PortPoolData::DirtyServerPorts& PortPool::getDirtyServerPorts() noexcept
+{
+    return m_portPoolData->m_dirtyServerPorts;
+}
+
+PortPoolData::DirtyClientPorts& PortPool::getDirtyClientPorts() noexcept
+{
+    return m_portPoolData->m_dirtyClientPorts;
+}
+
 expected<popo::InterfacePortData*, PortPoolError> PortPool::addInterfacePort(const RuntimeName_t& runtimeName,
                                                                              const capro::Interfaces interface) noexcept
 {
@@ -49,6 +74,8 @@ expected<popo::InterfacePortData*, PortPoolError> PortPool::addInterfacePort(con
         IOX_REPORT(PoshError::PORT_POOL__INTERFACELIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::INTERFACE_PORT_LIST_FULL);
     }
+    interfacePortData->m_discoveryNotifier.attach(getDiscoveryConditionVariableData(),
+                                                  popo::DiscoveryNotificationOrigin::INTERFACE_PORT);
     return ok(interfacePortData.to_ptr());
 }
 
@@ -102,6 +129,10 @@ PortPool::addPublisherPort(const capro::ServiceDescription& serviceDescription,
         IOX_REPORT(PoshError::PORT_POOL__PUBLISHERLIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::PUBLISHER_PORT_LIST_FULL);
     }
+    publisherPortData->m_discoveryNotifier.attach(getDiscoveryConditionVariableData(),
+                                                  popo::DiscoveryNotificationOrigin::PUBLISHER_PORT,
+                                                  getDirtyPublisherPorts(),
+                                                  publisherPortData.to_index());
     return ok(publisherPortData.to_ptr());
 }
 
@@ -151,6 +182,10 @@ PortPool::addClientPort(const capro::ServiceDescription& serviceDescription,
         IOX_REPORT(PoshError::PORT_POOL__CLIENTLIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::CLIENT_PORT_LIST_FULL);
     }
+    clientPortData->m_discoveryNotifier.attach(getDiscoveryConditionVariableData(),
+                                               popo::DiscoveryNotificationOrigin::CLIENT_PORT,
+                                               getDirtyClientPorts(),
+                                               clientPortData.to_index());
     return ok(clientPortData.to_ptr());
 }
 
@@ -171,6 +206,10 @@ PortPool::addServerPort(const capro::ServiceDescription& serviceDescription,
         IOX_REPORT(PoshError::PORT_POOL__SERVERLIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::SERVER_PORT_LIST_FULL);
     }
+    serverPortData->m_discoveryNotifier.attach(getDiscoveryConditionVariableData(),
+                                               popo::DiscoveryNotificationOrigin::SERVER_PORT,
+                                               getDirtyServerPorts(),
+                                               serverPortData.to_index());
     return ok(serverPortData.to_ptr());
 }
 
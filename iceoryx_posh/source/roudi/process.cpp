@@ -31,10 +31,12 @@ Process::Process(const RuntimeName_t& name,
                  const uint32_t pid,
                  const PosixUser& user,
                  const HeartbeatPoolIndexType heartbeatPoolIndex,
-                 const uint64_t sessionId) noexcept
+                 const uint64_t sessionId,
+                 runtime::RequestChannel* const requestChannel) noexcept
     : m_pid(pid)
     , m_ipcChannel(name, domainId, ResourceType::USER_DEFINED)
     , m_heartbeatPoolIndex(heartbeatPoolIndex)
+    , m_requestChannel(requestChannel)
     , m_user(user)
     , m_sessionId(sessionId)
 {
@@ -52,6 +54,11 @@ const RuntimeName_t Process::getName() const noexcept
 
 void Process::sendViaIpcChannel(const runtime::IpcMessage& data) noexcept
 {
+    if (m_requestChannel != nullptr && m_requestChannel->sendResponse(data))
+    {
+        return;
+    }
+
     bool sendSuccess = m_ipcChannel.send(data);
     if (!sendSuccess)
     {
@@ -80,5 +87,10 @@ bool Process::isMonitored() const noexcept
     return m_heartbeatPoolIndex != HeartbeatPool::Index::INVALID;
 }
 
+runtime::RequestChannel* Process::getRequestChannel() const noexcept
+{
+    return m_requestChannel;
+}
+
 } // namespace roudi
 } // namespace iox
@@ -29,6 +29,7 @@
 #include "iox/std_chrono_support.hpp"
 #include "iox/vector.hpp"
 
+#include <array>
 #include <chrono>
 #include <thread>
 
@@ -47,6 +48,9 @@ ProcessManager::ProcessManager(RouDiMemoryInterface& roudiMemoryInterface,
     , m_domainId(domainId)
     , m_compatibilityCheckLevel(compatibilityCheckLevel)
 {
+    // the index must not rehash while the process list grows
+    m_processIndex.reserve(MAX_PROCESS_NUMBER);
+
     bool fatalError{false};
 
     auto maybeSegmentManager = m_roudiMemoryInterface.segmentManager();
@@ -93,6 +97,17 @@ ProcessManager::ProcessManager(RouDiMemoryInterface& roudiMemoryInterface,
         m_heartbeatPool = maybeHeartbeatPool.value();
     }
 
+    auto maybeRequestChannelPool = m_roudiMemoryInterface.requestChannelPool();
+    if (!maybeRequestChannelPool.has_value())
+    {
+        IOX_LOG(FATAL, "Invalid state! Could not obtain RequestChannelPool!");
+        fatalError = true;
+    }
+    else
+    {
+        m_requestChannelPool = maybeRequestChannelPool.value();
+    }
+
     if (fatalError)
     {
         /// @todo iox-#539 Use separate error enums once RouDi is more modular
@@ -163,6 +178,7 @@ void ProcessManager::printWarningForRegisteredProcessesAndClearProcessList() noe
                               << "' is still running after SIGKILL was sent. RouDi is ignoring this process.");
     }
     m_processList.clear();
+    m_processIndex.clear();
 }
 
 bool ProcessManager::requestShutdownOfProcess(Process& process, ShutdownPolicy shutdownPolicy) noexcept
@@ -297,14 +313,30 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
 
     auto heartbeatPoolIndex = HeartbeatPool::Index::INVALID;
     iox::UntypedRelativePointer::offset_t heartbeatOffset{iox::UntypedRelativePointer::NULL_POINTER_OFFSET};
+    const runtime::Heartbeat* heartbeatOfProcess{nullptr};
 
     if (isMonitored)
     {
         auto heartbeat = m_heartbeatPool->emplace();
         heartbeatPoolIndex = heartbeat.to_index();
+        heartbeatOfProcess = heartbeat.to_ptr();
         heartbeatOffset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, heartbeat.to_ptr());
     }
-    m_processList.emplace_back(name, m_domainId, pid, user, heartbeatPoolIndex, sessionId);
+
+    // without a request channel the process sends all requests via the IPC channel
+    runtime::RequestChannel* requestChannel{nullptr};
+    iox::UntypedRelativePointer::offset_t requestChannelOffset{iox::UntypedRelativePointer::NULL_POINTER_OFFSET};
+    m_requestChannelPool->acquire(name)
+        .and_then([&](auto channel) {
+            requestChannel = channel;
+            requestChannelOffset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, channel);
+        })
+        .or_else([&] { IOX_LOG(WARN, "No request channel available for '" << name << "'"); });
+
+    m_processList.emplace_back(name, m_domainId, pid, user, heartbeatPoolIndex, sessionId, requestChannel);
+    auto processIter = m_processList.end();
+    --processIter;
+    m_processIndex.emplace(name, processIter);
 
     // send REG_ACK and BaseAddrString
     runtime::IpcMessage sendBuffer;
@@ -312,11 +344,12 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
     auto segmentManagerOffset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, m_segmentManager);
     sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::REG_ACK)
                << m_roudiMemoryInterface.mgmtMemoryProvider()->size() << segmentManagerOffset << transmissionTimestamp
-               << m_mgmtSegmentId << heartbeatOffset;
+               << m_mgmtSegmentId << heartbeatOffset << requestChannelOffset;
 
     m_processList.back().sendViaIpcChannel(sendBuffer);
 
-    m_processIntrospection->addProcess(static_cast<int>(pid), name);
+    // the process is removed from the introspection before its heartbeat is released
+    m_processIntrospection->addProcess(static_cast<int>(pid), name, heartbeatOfProcess);
 
     IOX_LOG(DEBUG, "Registered new application " << name);
     return true;
@@ -335,22 +368,18 @@ bool ProcessManager::unregisterProcess(const RuntimeName_t& name) noexcept
 
 bool ProcessManager::searchForProcessAndRemoveIt(const RuntimeName_t& name, const TerminationFeedback feedback) noexcept
 {
-    // we need to search for the process (currently linear search)
-    auto it = m_processList.begin();
-    while (it != m_processList.end())
+    auto entry = m_processIndex.find(name);
+    if (entry == m_processIndex.end())
     {
-        auto otherName = it->getName();
-        if (name == otherName)
-        {
-            if (removeProcessAndDeleteRespectiveSharedMemoryObjects(it, feedback))
-            {
-                IOX_LOG(DEBUG, "Removed existing application " << name);
-            }
-            return true; // we can assume there are no other processes with this name
-        }
-        ++it;
+        return false;
     }
-    return false;
+    auto processIter = entry->second;
+
+    if (removeProcessAndDeleteRespectiveSharedMemoryObjects(processIter, feedback))
+    {
+        IOX_LOG(DEBUG, "Removed existing application " << name);
+    }
+    return true;
 }
 
 bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(ProcessList_t::iterator& processIter,
@@ -374,6 +403,11 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
         {
             m_heartbeatPool->erase(heartbeatIter);
         }
+        if (processIter->getRequestChannel() != nullptr)
+        {
+            m_requestChannelPool->release(*processIter->getRequestChannel());
+        }
+        m_processIndex.erase(processIter->getName());
         processIter = m_processList.erase(processIter); // delete application
         return true;
     }
@@ -418,34 +452,8 @@ void ProcessManager::addSubscriberForProcess(const RuntimeName_t& name,
 {
     findProcess(name)
         .and_then([&](auto& process) {
-            // create a SubscriberPort
-            auto maybeSubscriber =
-                m_portManager.acquireSubscriberPortData(service, subscriberOptions, name, portConfigInfo);
-
-            if (maybeSubscriber.has_value())
-            {
-                // send SubscriberPort to app as a serialized relative pointer
-                auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybeSubscriber.value());
-
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK)
-                           << convert::toString(offset) << convert::toString(m_mgmtSegmentId);
-                process->sendViaIpcChannel(sendBuffer);
-
-                IOX_LOG(DEBUG,
-                        "Created new SubscriberPort for application '" << name << "' with service description '"
-                                                                       << service << "'");
-            }
-            else
-            {
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::SUBSCRIBER_LIST_FULL);
-                process->sendViaIpcChannel(sendBuffer);
-                IOX_LOG(ERROR,
-                        "Could not create SubscriberPort for application '" << name << "' with service description '"
-                                                                            << service << "'");
-            }
+            process->sendViaIpcChannel(
+                createSubscriberForProcess(*process, service, subscriberOptions, portConfigInfo));
         })
         .or_else([&]() {
             IOX_LOG(WARN,
@@ -454,81 +462,122 @@ void ProcessManager::addSubscriberForProcess(const RuntimeName_t& name,
         });
 }
 
+runtime::IpcMessage ProcessManager::createSubscriberForProcess(Process& process,
+                                                               const capro::ServiceDescription& service,
+                                                               const popo::SubscriberOptions& subscriberOptions,
+                                                               const PortConfigInfo& portConfigInfo) noexcept
+{
+    const auto name = process.getName();
+    runtime::IpcMessage sendBuffer;
+
+    // create a SubscriberPort
+    auto maybeSubscriber = m_portManager.acquireSubscriberPortData(service, subscriberOptions, name, portConfigInfo);
+
+    if (maybeSubscriber.has_value())
+    {
+        // send SubscriberPort to app as a serialized relative pointer
+        auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybeSubscriber.value());
+
+        sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK)
+                   << convert::toString(offset) << convert::toString(m_mgmtSegmentId);
+
+        IOX_LOG(DEBUG,
+                "Created new SubscriberPort for application '" << name << "' with service description '" << service
+                                                               << "'");
+    }
+    else
+    {
+        sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
+        sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::SUBSCRIBER_LIST_FULL);
+        IOX_LOG(ERROR,
+                "Could not create SubscriberPort for application '" << name << "' with service description '"
+                                                                    << service << "'");
+    }
+    return sendBuffer;
+}
+
 void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
                                             const capro::ServiceDescription& service,
                                             const popo::PublisherOptions& publisherOptions,
                                             const PortConfigInfo& portConfigInfo) noexcept
 {
     findProcess(name)
-        .and_then([&](auto& process) { // create a PublisherPort
-            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
+        .and_then([&](auto& process) {
+            process->sendViaIpcChannel(createPublisherForProcess(*process, service, publisherOptions, portConfigInfo));
+        })
+        .or_else([&]() {
+            IOX_LOG(WARN,
+                    "Unknown application '" << name << "' requested a PublisherPort with service description '"
+                                            << service << "'");
+        });
+}
 
-            if (!segmentInfo.m_memoryManager.has_value())
-            {
-                // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT);
-                process->sendViaIpcChannel(sendBuffer);
-                return;
-            }
+runtime::IpcMessage ProcessManager::createPublisherForProcess(Process& process,
+                                                              const capro::ServiceDescription& service,
+                                                              const popo::PublisherOptions& publisherOptions,
+                                                              const PortConfigInfo& portConfigInfo) noexcept
+{
+    const auto name = process.getName();
+    runtime::IpcMessage sendBuffer;
 
-            auto maybePublisher = m_portManager.acquirePublisherPortData(
-                service, publisherOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
+    // create a PublisherPort
+    auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process.getUser());
 
-            if (maybePublisher.has_value())
-            {
-                // send PublisherPort to app as a serialized relative pointer
-                auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybePublisher.value());
+    if (!segmentInfo.m_memoryManager.has_value())
+    {
+        // Tell the app no writable shared memory segment was found
+        sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
+        sendBuffer << runtime::IpcMessageErrorTypeToString(
+            runtime::IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT);
+        return sendBuffer;
+    }
 
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PUBLISHER_ACK)
-                           << convert::toString(offset) << convert::toString(m_mgmtSegmentId);
-                process->sendViaIpcChannel(sendBuffer);
+    auto maybePublisher = m_portManager.acquirePublisherPortData(
+        service, publisherOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
 
-                IOX_LOG(DEBUG,
-                        "Created new PublisherPort for application '" << name << "' with service description '"
-                                                                      << service << "'");
-            }
-            else
-            {
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
+    if (maybePublisher.has_value())
+    {
+        // send PublisherPort to app as a serialized relative pointer
+        auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybePublisher.value());
 
-                std::string error;
-                switch (maybePublisher.error())
-                {
-                case PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::NO_UNIQUE_CREATED);
-                    break;
-                }
-                case PortPoolError::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(
-                        runtime::IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN);
-                    break;
-                }
-                default:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL);
-                    break;
-                }
-                }
-                sendBuffer << error;
+        sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PUBLISHER_ACK)
+                   << convert::toString(offset) << convert::toString(m_mgmtSegmentId);
 
-                process->sendViaIpcChannel(sendBuffer);
-                IOX_LOG(ERROR,
-                        "Could not create PublisherPort for application '" << name << "' with service description '"
-                                                                           << service << "'");
-            }
-        })
-        .or_else([&]() {
-            IOX_LOG(WARN,
-                    "Unknown application '" << name << "' requested a PublisherPort with service description '"
-                                            << service << "'");
-        });
+        IOX_LOG(DEBUG,
+                "Created new PublisherPort for application '" << name << "' with service description '" << service
+                                                              << "'");
+    }
+    else
+    {
+        sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
+
+        std::string error;
+        switch (maybePublisher.error())
+        {
+        case PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS:
+        {
+            error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::NO_UNIQUE_CREATED);
+            break;
+        }
+        case PortPoolError::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
+        {
+            error = runtime::IpcMessageErrorTypeToString(
+                runtime::IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN);
+            break;
+        }
+        default:
+        {
+            error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL);
+            break;
+        }
+        }
+        sendBuffer << error;
+
+        IOX_LOG(ERROR,
+                "Could not create PublisherPort for application '" << name << "' with service description '"
+                                                                   << service << "'");
+    }
+    return sendBuffer;
 }
 
 void ProcessManager::addClientForProcess(const RuntimeName_t& name,
@@ -642,33 +691,80 @@ void ProcessManager::addServerForProcess(const RuntimeName_t& name,
 void ProcessManager::addConditionVariableForProcess(const RuntimeName_t& runtimeName) noexcept
 {
     findProcess(runtimeName)
-        .and_then([&](auto& process) { // Try to create a condition variable
-            m_portManager.acquireConditionVariableData(runtimeName)
-                .and_then([&](auto condVar) {
-                    auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, condVar);
+        .and_then([&](auto& process) { process->sendViaIpcChannel(createConditionVariableForProcess(*process)); })
+        .or_else([&]() { IOX_LOG(WARN, "Unknown application " << runtimeName << " requested a ConditionVariable."); });
+}
 
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(
-                        runtime::IpcMessageType::CREATE_CONDITION_VARIABLE_ACK)
-                               << convert::toString(offset) << convert::toString(m_mgmtSegmentId);
-                    process->sendViaIpcChannel(sendBuffer);
+runtime::IpcMessage ProcessManager::createConditionVariableForProcess(Process& process) noexcept
+{
+    const auto runtimeName = process.getName();
+    runtime::IpcMessage sendBuffer;
 
-                    IOX_LOG(DEBUG, "Created new ConditionVariable for application " << runtimeName);
-                })
-                .or_else([&](PortPoolError error) {
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                    if (error == PortPoolError::CONDITION_VARIABLE_LIST_FULL)
-                    {
-                        sendBuffer << runtime::IpcMessageErrorTypeToString(
-                            runtime::IpcMessageErrorType::CONDITION_VARIABLE_LIST_FULL);
-                    }
-                    process->sendViaIpcChannel(sendBuffer);
+    // Try to create a condition variable
+    m_portManager.acquireConditionVariableData(runtimeName)
+        .and_then([&](auto condVar) {
+            auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, condVar);
 
-                    IOX_LOG(DEBUG, "Could not create new ConditionVariable for application " << runtimeName);
-                });
+            sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_CONDITION_VARIABLE_ACK)
+                       << convert::toString(offset) << convert::toString(m_mgmtSegmentId);
+
+            IOX_LOG(DEBUG, "Created new ConditionVariable for application " << runtimeName);
         })
-        .or_else([&]() { IOX_LOG(WARN, "Unknown application " << runtimeName << " requested a ConditionVariable."); });
+        .or_else([&](PortPoolError error) {
+            sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
+            // the error type is always sent, since the responses of a batched port request are parsed one after
+            // another
+            sendBuffer << runtime::IpcMessageErrorTypeToString(
+                (error == PortPoolError::CONDITION_VARIABLE_LIST_FULL)
+                    ? runtime::IpcMessageErrorType::CONDITION_VARIABLE_LIST_FULL
+                    : runtime::IpcMessageErrorType::NOTYPE);
+
+            IOX_LOG(DEBUG, "Could not create new ConditionVariable for application " << runtimeName);
+        });
+    return sendBuffer;
+}
+
+void ProcessManager::addPortsForProcess(const RuntimeName_t& name, const PortRequestList_t& portRequests) noexcept
+{
+    findProcess(name)
+        .and_then([&](auto& process) {
+            runtime::IpcMessage sendBuffer;
+            sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PORTS_ACK);
+
+            for (const auto& portRequest : portRequests)
+            {
+                runtime::IpcMessage response;
+                switch (portRequest.type)
+                {
+                case runtime::IpcMessageType::CREATE_PUBLISHER:
+                    response = createPublisherForProcess(
+                        *process, portRequest.service, portRequest.publisherOptions, portRequest.portConfigInfo);
+                    break;
+                case runtime::IpcMessageType::CREATE_SUBSCRIBER:
+                    response = createSubscriberForProcess(
+                        *process, portRequest.service, portRequest.subscriberOptions, portRequest.portConfigInfo);
+                    break;
+                case runtime::IpcMessageType::CREATE_CONDITION_VARIABLE:
+                    response = createConditionVariableForProcess(*process);
+                    break;
+                default:
+                    response << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR)
+                             << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::NOTYPE);
+                    break;
+                }
+
+                // the responses are appended in the order of the requests
+                for (uint32_t i = 0U; i < response.getNumberOfElements(); ++i)
+                {
+                    sendBuffer << response.getElementAtIndex(i);
+                }
+            }
+
+            process->sendViaIpcChannel(sendBuffer);
+        })
+        .or_else([&]() {
+            IOX_LOG(WARN, "Unknown application '" << name << "' requested " << portRequests.size() << " ports.");
+        });
 }
 
 void ProcessManager::initIntrospection(ProcessIntrospectionType* processIntrospection) noexcept
@@ -693,15 +789,13 @@ ProcessManager::addIntrospectionPublisherPort(const capro::ServiceDescription& s
 
 optional<Process*> ProcessManager::findProcess(const RuntimeName_t& name) noexcept
 {
-    for (auto& process : m_processList)
+    auto entry = m_processIndex.find(name);
+    if (entry == m_processIndex.end())
     {
-        if (process.getName() == name)
-        {
-            return make_optional<Process*>(&process);
-        }
+        return nullopt;
     }
 
-    return nullopt;
+    return make_optional<Process*>(&*entry->second);
 }
 
 void ProcessManager::monitorProcesses() noexcept
@@ -709,38 +803,63 @@ void ProcessManager::monitorProcesses() noexcept
     static_assert(runtime::PROCESS_KEEP_ALIVE_TIMEOUT > runtime::PROCESS_KEEP_ALIVE_INTERVAL,
                   "keep alive timeout too small");
     auto timeout = runtime::PROCESS_KEEP_ALIVE_TIMEOUT.toMilliseconds();
-    auto heartbeatIterator = m_heartbeatPool->begin();
-    while (heartbeatIterator != m_heartbeatPool->end())
+
+    // the heartbeats are stored consecutively in the management segment and are checked in a single sweep with one
+    // clock read; the process list is only traversed if at least one heartbeat timed out
+    std::array<uint64_t, MAX_PROCESS_NUMBER> elapsedMillisecondsOfTimedOutHeartbeats{};
+    uint64_t numberOfTimedOutHeartbeats{0U};
+    const auto nowMilliseconds = runtime::Heartbeat::milliseconds_since_epoch();
+    for (auto heartbeatIterator = m_heartbeatPool->begin(); heartbeatIterator != m_heartbeatPool->end();
+         ++heartbeatIterator)
     {
-        auto currentHeartbeatIterator = heartbeatIterator++;
-        auto elapsedMilliseconds = currentHeartbeatIterator->elapsed_milliseconds_since_last_beat();
+        auto elapsedMilliseconds = heartbeatIterator->elapsed_milliseconds_since_last_beat(nowMilliseconds);
         if (elapsedMilliseconds > timeout)
         {
-            bool removed{false};
-            auto processIterator = m_processList.begin();
-            while (processIterator != m_processList.end())
-            {
-                if (processIterator->getHeartbeatPoolIndex() != currentHeartbeatIterator.to_index())
-                {
-                    ++processIterator;
-                    continue;
-                }
+            elapsedMillisecondsOfTimedOutHeartbeats[heartbeatIterator.to_index()] = elapsedMilliseconds;
+            ++numberOfTimedOutHeartbeats;
+        }
+    }
 
-                IOX_LOG(WARN,
-                        "Application " << processIterator->getName() << " not responding (last response "
-                                       << elapsedMilliseconds << " milliseconds ago) --> removing it");
+    if (numberOfTimedOutHeartbeats == 0U)
+    {
+        return;
+    }
 
-                removed = removeProcessAndDeleteRespectiveSharedMemoryObjects(
-                    processIterator, TerminationFeedback::DO_NOT_SEND_ACK_TO_PROCESS);
-                break;
-            }
-            if (!removed)
-            {
-                IOX_LOG(WARN,
-                        "Could not find application for corresponding heartbeat! HeartbeatPoolIndex: "
-                            << currentHeartbeatIterator.to_index());
-                m_heartbeatPool->erase(currentHeartbeatIterator);
-            }
+    auto processIterator = m_processList.begin();
+    while (processIterator != m_processList.end())
+    {
+        const auto heartbeatPoolIndex = processIterator->getHeartbeatPoolIndex();
+        const bool isTimedOut = (heartbeatPoolIndex < MAX_PROCESS_NUMBER)
+                                && (elapsedMillisecondsOfTimedOutHeartbeats[heartbeatPoolIndex] != 0U);
+        if (!isTimedOut)
+        {
+            ++processIterator;
+            continue;
+        }
+
+        IOX_LOG(WARN,
+                "Application " << processIterator->getName() << " not responding (last response "
+                               << elapsedMillisecondsOfTimedOutHeartbeats[heartbeatPoolIndex]
+                               << " milliseconds ago) --> removing it");
+
+        elapsedMillisecondsOfTimedOutHeartbeats[heartbeatPoolIndex] = 0U;
+        --numberOfTimedOutHeartbeats;
+        // advances the iterator to the next process
+        IOX_DISCARD_RESULT(removeProcessAndDeleteRespectiveSharedMemoryObjects(
+            processIterator, TerminationFeedback::DO_NOT_SEND_ACK_TO_PROCESS));
+    }
+
+    for (HeartbeatPoolIndexType heartbeatPoolIndex = 0U;
+         numberOfTimedOutHeartbeats > 0U && heartbeatPoolIndex < MAX_PROCESS_NUMBER;
+         ++heartbeatPoolIndex)
+    {
+        if (elapsedMillisecondsOfTimedOutHeartbeats[heartbeatPoolIndex] != 0U)
+        {
+            IOX_LOG(WARN,
+                    "Could not find application for corresponding heartbeat! HeartbeatPoolIndex: "
+                        << heartbeatPoolIndex);
+            m_heartbeatPool->erase(heartbeatPoolIndex);
+            --numberOfTimedOutHeartbeats;
         }
     }
 }
@@ -750,5 +869,11 @@ void ProcessManager::discoveryUpdate() noexcept
     m_portManager.doDiscovery();
 }
 
+void ProcessManager::discoveryUpdateForNotifiedPorts(
+    const popo::ConditionListener::NotificationVector_t& notifications) noexcept
+{
+    m_portManager.doDiscoveryForNotifiedPorts(notifications);
+}
+
 } // namespace roudi
 } // namespace iox
@@ -17,8 +17,9 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/roudi/roudi.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
-#include "iceoryx_posh/popo/wait_set.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
 #include "iox/detail/convert.hpp"
@@ -38,6 +39,7 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
     : m_roudiConfig(roudiConfig)
     , m_runMonitoringAndDiscoveryThread(true)
     , m_runHandleRuntimeMessageThread(true)
+    , m_discoveryConditionVariableData(&portManager.discoveryConditionVariableData())
     , m_roudiMemoryInterface(&roudiMemoryInterface)
     , m_portManager(&portManager)
     , m_prcMgr(concurrent::ForwardArgsToCTor,
@@ -89,6 +91,7 @@ void RouDi::startProcessRuntimeMessagesThread() noexcept
                     runtime::IpcInterfaceCreator::create(
                         IPC_CHANNEL_ROUDI_NAME, m_roudiConfig.domainId, ResourceType::ICEORYX_DEFINED)
                         .expect("Creating IPC channel for request to RouDi"));
+    m_handleRequestChannelMessageThread = std::thread(&RouDi::processRequestChannelMessages, this);
 }
 
 void RouDi::shutdown() noexcept
@@ -96,7 +99,7 @@ void RouDi::shutdown() noexcept
     // trigger the shutdown of the monitoring and discovery thread in order to prevent application to register while
     // shutting down
     m_runMonitoringAndDiscoveryThread = false;
-    m_discoveryLoopTrigger.trigger();
+    triggerDiscoveryLoop();
 
     // stop the introspection
     m_processIntrospection.stop();
@@ -167,6 +170,13 @@ void RouDi::shutdown() noexcept
         m_handleRuntimeMessageThread.join();
         IOX_LOG(DEBUG, "...'IPC-msg-process' thread joined.");
     }
+
+    if (m_handleRequestChannelMessageThread.joinable())
+    {
+        IOX_LOG(DEBUG, "Joining 'IPC-shm-process' thread...");
+        m_handleRequestChannelMessageThread.join();
+        IOX_LOG(DEBUG, "...'IPC-shm-process' thread joined.");
+    }
 }
 
 void RouDi::cyclicUpdateHook() noexcept
@@ -189,7 +199,7 @@ void RouDi::triggerDiscoveryLoopAndWaitToFinish(units::Duration timeout) noexcep
                             << static_cast<uint32_t>(error));
             });
     }
-    m_discoveryLoopTrigger.trigger();
+    triggerDiscoveryLoop();
     m_discoveryFinishedSemaphore->timedWait(timeout).or_else([](const auto& error) {
         IOX_LOG(ERROR,
                 "A timed wait on the semaphore which signals a finished run of the "
@@ -198,29 +208,35 @@ void RouDi::triggerDiscoveryLoopAndWaitToFinish(units::Duration timeout) noexcep
     });
 }
 
+void RouDi::triggerDiscoveryLoop() noexcept
+{
+    popo::ConditionNotifier(*m_discoveryConditionVariableData,
+                            static_cast<uint64_t>(popo::DiscoveryNotificationOrigin::DISCOVERY_LOOP_TRIGGER))
+        .notify();
+}
+
 void RouDi::monitorAndDiscoveryUpdate() noexcept
 {
     setThreadName("Mon+Discover");
 
-    class DiscoveryWaitSet : public popo::WaitSet<1>
-    {
-      public:
-        DiscoveryWaitSet(popo::ConditionVariableData& condVarData) noexcept
-            : WaitSet(condVarData)
-        {
-        }
-    };
-
-    popo::ConditionVariableData conditionVariableData;
-    DiscoveryWaitSet discoveryLoopWaitset{conditionVariableData};
-    discoveryLoopWaitset.attachEvent(m_discoveryLoopTrigger).expect("Failed to attach a single event");
+    // the ports notify the discovery condition variable when they have a pending CaPro message and are handled right
+    // away; the cyclic run with DISCOVERY_INTERVAL is still required to monitor the processes and to clean up the
+    // resources of crashed processes
+    popo::ConditionListener discoveryListener{*m_discoveryConditionVariableData};
+    deadline_timer cyclicRunTimer{DISCOVERY_INTERVAL};
+    bool doCyclicRun{true};
     bool manuallyTriggered{false};
 
     while (m_runMonitoringAndDiscoveryThread)
     {
-        m_prcMgr->run();
+        if (doCyclicRun)
+        {
+            m_prcMgr->run();
 
-        cyclicUpdateHook();
+            cyclicUpdateHook();
+
+            cyclicRunTimer.reset();
+        }
 
         if (manuallyTriggered)
         {
@@ -232,14 +248,22 @@ void RouDi::monitorAndDiscoveryUpdate() noexcept
         }
 
         manuallyTriggered = false;
-        for (const auto& notification : discoveryLoopWaitset.timedWait(DISCOVERY_INTERVAL))
+        const auto notifications = discoveryListener.timedWait(cyclicRunTimer.remainingTime());
+        for (const auto notificationIndex : notifications)
         {
-            if (notification->doesOriginateFrom(&m_discoveryLoopTrigger))
+            if (notificationIndex
+                == static_cast<uint64_t>(popo::DiscoveryNotificationOrigin::DISCOVERY_LOOP_TRIGGER))
             {
                 manuallyTriggered = true;
-                break;
             }
         }
+
+        if (!notifications.empty() && m_runMonitoringAndDiscoveryThread)
+        {
+            m_prcMgr->discoveryUpdateForNotifiedPorts(notifications);
+        }
+
+        doCyclicRun = manuallyTriggered || cyclicRunTimer.hasExpired();
     }
 }
 
@@ -268,6 +292,37 @@ void RouDi::processRuntimeMessages(runtime::IpcInterfaceCreator&& roudiIpcInterf
     }
 }
 
+void RouDi::processRequestChannelMessages() noexcept
+{
+    setThreadName("IPC-shm-process");
+
+    auto requestChannelPool = m_roudiMemoryInterface->requestChannelPool().expect("Valid RequestChannelPool");
+
+    while (m_runHandleRuntimeMessageThread)
+    {
+        requestChannelPool->waitForRequest(m_runtimeMessagesThreadTimeout).and_then([this](auto requestChannel) {
+            requestChannel->takeRequest().and_then([this, requestChannel](auto& message) {
+                auto cmd = runtime::stringToIpcMessageType(message.getElementAtIndex(0).c_str());
+                RuntimeName_t runtimeName{into<lossy<RuntimeName_t>>(message.getElementAtIndex(1))};
+
+                // the response is sent to the process with the name from the request, which must therefore be the
+                // owner of the channel
+                if (runtimeName == requestChannel->getRuntimeName())
+                {
+                    processMessage(message, cmd, runtimeName);
+                }
+                else
+                {
+                    IOX_LOG(ERROR,
+                            "Got message from \"" << runtimeName << "\" via the request channel of \""
+                                                  << requestChannel->getRuntimeName() << "\"!");
+                }
+                requestChannel->finishRequest();
+            });
+        });
+    }
+}
+
 version::VersionInfo RouDi::parseRegisterMessage(const runtime::IpcMessage& message,
                                                  uint32_t& pid,
                                                  uid_t& userId,
@@ -286,6 +341,90 @@ version::VersionInfo RouDi::parseRegisterMessage(const runtime::IpcMessage& mess
     return serializationVersionInfo;
 }
 
+bool RouDi::parsePortRequests(const runtime::IpcMessage& message,
+                              ProcessManager::PortRequestList_t& portRequests) noexcept
+{
+    // service description, options and port config info of a publisher or subscriber
+    constexpr uint32_t NUMBER_OF_PORT_ENTRIES{3U};
+
+    uint32_t index{2U};
+    while (index < message.getNumberOfElements())
+    {
+        runtime::PortRequest portRequest;
+        portRequest.type = runtime::stringToIpcMessageType(message.getElementAtIndex(index).c_str());
+        ++index;
+
+        if (portRequest.type == runtime::IpcMessageType::CREATE_PUBLISHER
+            || portRequest.type == runtime::IpcMessageType::CREATE_SUBSCRIBER)
+        {
+            if (index + NUMBER_OF_PORT_ENTRIES > message.getNumberOfElements())
+            {
+                IOX_LOG(ERROR, "Incomplete port request in \"IpcMessageType::CREATE_PORTS\"");
+                return false;
+            }
+
+            auto deserializationResult =
+                capro::ServiceDescription::deserialize(Serialization(message.getElementAtIndex(index)));
+            if (deserializationResult.has_error())
+            {
+                IOX_LOG(ERROR,
+                        "Deserialization failed when '" << message.getElementAtIndex(index).c_str()
+                                                        << "' was provided\n");
+                return false;
+            }
+            portRequest.service = deserializationResult.value();
+
+            if (portRequest.type == runtime::IpcMessageType::CREATE_PUBLISHER)
+            {
+                auto publisherOptionsDeserializationResult =
+                    popo::PublisherOptions::deserialize(Serialization(message.getElementAtIndex(index + 1U)));
+                if (publisherOptionsDeserializationResult.has_error())
+                {
+                    IOX_LOG(ERROR,
+                            "Deserialization of 'PublisherOptions' failed when '"
+                                << message.getElementAtIndex(index + 1U).c_str() << "' was provided\n");
+                    return false;
+                }
+                portRequest.publisherOptions = publisherOptionsDeserializationResult.value();
+            }
+            else
+            {
+                auto subscriberOptionsDeserializationResult =
+                    popo::SubscriberOptions::deserialize(Serialization(message.getElementAtIndex(index + 1U)));
+                if (subscriberOptionsDeserializationResult.has_error())
+                {
+                    IOX_LOG(ERROR,
+                            "Deserialization of 'SubscriberOptions' failed when '"
+                                << message.getElementAtIndex(index + 1U).c_str() << "' was provided\n");
+                    return false;
+                }
+                portRequest.subscriberOptions = subscriberOptionsDeserializationResult.value();
+            }
+
+            portRequest.portConfigInfo =
+                iox::runtime::PortConfigInfo(Serialization(message.getElementAtIndex(index + 2U)));
+            index += NUMBER_OF_PORT_ENTRIES;
+        }
+        else if (portRequest.type != runtime::IpcMessageType::CREATE_CONDITION_VARIABLE)
+        {
+            IOX_LOG(ERROR,
+                    "Unsupported port request '" << message.getElementAtIndex(index - 1U).c_str()
+                                                 << "' in \"IpcMessageType::CREATE_PORTS\"");
+            return false;
+        }
+
+        if (!portRequests.push_back(portRequest))
+        {
+            IOX_LOG(ERROR,
+                    "\"IpcMessageType::CREATE_PORTS\" exceeds the maximum of " << MAX_PORT_REQUESTS_PER_BATCH
+                                                                               << " ports");
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void RouDi::processMessage(const runtime::IpcMessage& message,
                            const iox::runtime::IpcMessageType& cmd,
                            const RuntimeName_t& runtimeName) noexcept
@@ -499,6 +638,20 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         break;
     }
+    case runtime::IpcMessageType::CREATE_PORTS:
+    {
+        ProcessManager::PortRequestList_t portRequests;
+        if (!parsePortRequests(message, portRequests))
+        {
+            IOX_LOG(ERROR,
+                    "Malformed \"IpcMessageType::CREATE_PORTS\" from \"" << runtimeName << "\"received!");
+        }
+        else
+        {
+            m_prcMgr->addPortsForProcess(runtimeName, portRequests);
+        }
+        break;
+    }
     case runtime::IpcMessageType::CREATE_INTERFACE:
     {
         if (message.getNumberOfElements() != 4)
@@ -26,18 +26,134 @@ ServiceRegistry::ServiceDescriptionEntry::ServiceDescriptionEntry(const capro::S
 {
 }
 
+ServiceRegistryIndex::HashIndex::HashIndex() noexcept
+{
+    for (auto& head : m_head)
+    {
+        head = NO_INDEX;
+    }
+    for (auto& chainLength : m_chainLength)
+    {
+        chainLength = 0U;
+    }
+    for (auto& next : m_next)
+    {
+        next = NO_INDEX;
+    }
+}
+
+uint32_t ServiceRegistryIndex::HashIndex::bucket(const uint64_t hash) noexcept
+{
+    return static_cast<uint32_t>(hash % NUMBER_OF_BUCKETS);
+}
+
+void ServiceRegistryIndex::HashIndex::insert(const uint64_t hash, const uint32_t index) noexcept
+{
+    const auto bucketIndex = bucket(hash);
+    // the chain is kept sorted by index so that the search results have the order of the container
+    auto* link = &m_head[bucketIndex];
+    while (*link != NO_INDEX && *link < index)
+    {
+        link = &m_next[*link];
+    }
+    m_next[index] = *link;
+    *link = index;
+    ++m_chainLength[bucketIndex];
+}
+
+void ServiceRegistryIndex::HashIndex::remove(const uint64_t hash, const uint32_t index) noexcept
+{
+    const auto bucketIndex = bucket(hash);
+    auto* link = &m_head[bucketIndex];
+    while (*link != NO_INDEX)
+    {
+        if (*link == index)
+        {
+            *link = m_next[index];
+            m_next[index] = NO_INDEX;
+            --m_chainLength[bucketIndex];
+            return;
+        }
+        link = &m_next[*link];
+    }
+}
+
+uint32_t ServiceRegistryIndex::HashIndex::first(const uint64_t hash) const noexcept
+{
+    return m_head[bucket(hash)];
+}
+
+uint32_t ServiceRegistryIndex::HashIndex::next(const uint32_t index) const noexcept
+{
+    return m_next[index];
+}
+
+uint32_t ServiceRegistryIndex::HashIndex::chainLength(const uint64_t hash) const noexcept
+{
+    return m_chainLength[bucket(hash)];
+}
+
+void ServiceRegistryIndex::insert(const capro::ServiceDescription& serviceDescription, const uint32_t index) noexcept
+{
+    m_serviceDescriptionIndex.insert(serviceDescription.getHash(), index);
+    m_serviceIndex.insert(capro::hashIdString(serviceDescription.getServiceIDString()), index);
+    m_instanceIndex.insert(capro::hashIdString(serviceDescription.getInstanceIDString()), index);
+    m_eventIndex.insert(capro::hashIdString(serviceDescription.getEventIDString()), index);
+}
+
+void ServiceRegistryIndex::remove(const capro::ServiceDescription& serviceDescription, const uint32_t index) noexcept
+{
+    m_serviceDescriptionIndex.remove(serviceDescription.getHash(), index);
+    m_serviceIndex.remove(capro::hashIdString(serviceDescription.getServiceIDString()), index);
+    m_instanceIndex.remove(capro::hashIdString(serviceDescription.getInstanceIDString()), index);
+    m_eventIndex.remove(capro::hashIdString(serviceDescription.getEventIDString()), index);
+}
+
+void ServiceRegistry::emplaceEntry(const uint32_t slot,
+                                   const capro::ServiceDescription& serviceDescription,
+                                   ReferenceCounter_t ServiceDescriptionEntry::*count,
+                                   ServiceRegistryIndex* const index) noexcept
+{
+    auto& entry = m_serviceDescriptions[slot];
+    entry.emplace(serviceDescription);
+    (*entry).*count = 1U;
+
+    if (index != nullptr)
+    {
+        index->insert(serviceDescription, slot);
+    }
+
+    markChanged();
+}
+
+void ServiceRegistry::resetEntry(const uint32_t slot, ServiceRegistryIndex* const index) noexcept
+{
+    auto& entry = m_serviceDescriptions[slot];
+
+    if (index != nullptr)
+    {
+        index->remove(entry->serviceDescription, slot);
+    }
+
+    entry.reset();
+    // reuse the slot in the next insertion
+    m_freeIndex = slot;
+    markChanged();
+}
+
 expected<void, ServiceRegistry::Error> ServiceRegistry::add(const capro::ServiceDescription& serviceDescription,
-                                                            ReferenceCounter_t ServiceDescriptionEntry::*count)
+                                                            ReferenceCounter_t ServiceDescriptionEntry::*count,
+                                                            ServiceRegistryIndex* const index)
 {
-    auto index = findIndex(serviceDescription);
-    if (index != NO_INDEX)
+    auto slot = findIndex(serviceDescription, index);
+    if (slot != NO_INDEX)
     {
         // multiple entries with the same service descripion are possible
         // and we just increase the count in this case (multi-set semantics)
         // entry exists, increment counter
-        auto& entry = m_serviceDescriptions[index];
+        auto& entry = m_serviceDescriptions[slot];
         ((*entry).*count)++;
-        m_dataChanged = true;
+        markChanged();
         return ok();
     }
 
@@ -47,22 +163,17 @@ expected<void, ServiceRegistry::Error> ServiceRegistry::add(const capro::Service
     // prefer to fill entries close to the front
     if (m_freeIndex != NO_INDEX)
     {
-        auto& entry = m_serviceDescriptions[m_freeIndex];
-        entry.emplace(serviceDescription);
-        (*entry).*count = 1U;
-        m_dataChanged = true;
+        emplaceEntry(m_freeIndex, serviceDescription, count, index);
         m_freeIndex = NO_INDEX;
         return ok();
     }
 
     // search from start
-    for (auto& entry : m_serviceDescriptions)
+    for (uint32_t i = 0; i < m_serviceDescriptions.size(); ++i)
     {
-        if (!entry)
+        if (!m_serviceDescriptions[i])
         {
-            entry.emplace(serviceDescription);
-            (*entry).*count = 1U;
-            m_dataChanged = true;
+            emplaceEntry(i, serviceDescription, count, index);
             return ok();
         }
     }
@@ -70,10 +181,7 @@ expected<void, ServiceRegistry::Error> ServiceRegistry::add(const capro::Service
     // append new entry at the end (the size only grows up to capacity)
     if (m_serviceDescriptions.emplace_back())
     {
-        auto& entry = m_serviceDescriptions.back();
-        entry.emplace(serviceDescription);
-        (*entry).*count = 1U;
-        m_dataChanged = true;
+        emplaceEntry(static_cast<uint32_t>(m_serviceDescriptions.size() - 1U), serviceDescription, count, index);
         return ok();
     }
 
@@ -83,50 +191,44 @@ expected<void, ServiceRegistry::Error> ServiceRegistry::add(const capro::Service
 expected<void, ServiceRegistry::Error>
 ServiceRegistry::addPublisher(const capro::ServiceDescription& serviceDescription) noexcept
 {
-    return add(serviceDescription, &ServiceDescriptionEntry::publisherCount);
+    return add(serviceDescription, &ServiceDescriptionEntry::publisherCount, nullptr);
 }
 
 expected<void, ServiceRegistry::Error>
 ServiceRegistry::addServer(const capro::ServiceDescription& serviceDescription) noexcept
 {
-    return add(serviceDescription, &ServiceDescriptionEntry::serverCount);
+    return add(serviceDescription, &ServiceDescriptionEntry::serverCount, nullptr);
 }
 
 void ServiceRegistry::removePublisher(const capro::ServiceDescription& serviceDescription) noexcept
 {
-    auto index = findIndex(serviceDescription);
-    if (index != NO_INDEX)
-    {
-        auto& entry = m_serviceDescriptions[index];
-
-        if (entry && entry->publisherCount >= 1U)
-        {
-            if (--entry->publisherCount == 0U && entry->serverCount == 0)
-            {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
-                m_dataChanged = true;
-            }
-        }
-    }
+    remove(serviceDescription, &ServiceDescriptionEntry::publisherCount, nullptr);
 }
 
 void ServiceRegistry::removeServer(const capro::ServiceDescription& serviceDescription) noexcept
 {
-    auto index = findIndex(serviceDescription);
-    if (index != NO_INDEX)
+    remove(serviceDescription, &ServiceDescriptionEntry::serverCount, nullptr);
+}
+
+void ServiceRegistry::remove(const capro::ServiceDescription& serviceDescription,
+                             ReferenceCounter_t ServiceDescriptionEntry::*count,
+                             ServiceRegistryIndex* const index) noexcept
+{
+    auto slot = findIndex(serviceDescription, index);
+    if (slot != NO_INDEX)
     {
-        auto& entry = m_serviceDescriptions[index];
+        auto& entry = m_serviceDescriptions[slot];
 
-        if (entry && entry->serverCount >= 1U)
+        if (entry && (*entry).*count >= 1U)
         {
-            if (--entry->serverCount == 0U && entry->publisherCount == 0)
+            --((*entry).*count);
+            if (entry->publisherCount == 0U && entry->serverCount == 0U)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
-                m_dataChanged = true;
+                resetEntry(slot, index);
+            }
+            else
+            {
+                markChanged();
             }
         }
     }
@@ -134,14 +236,16 @@ void ServiceRegistry::removeServer(const capro::ServiceDescription& serviceDescr
 
 void ServiceRegistry::purge(const capro::ServiceDescription& serviceDescription) noexcept
 {
-    auto index = findIndex(serviceDescription);
-    if (index != NO_INDEX)
+    purge(serviceDescription, nullptr);
+}
+
+void ServiceRegistry::purge(const capro::ServiceDescription& serviceDescription,
+                            ServiceRegistryIndex* const index) noexcept
+{
+    auto slot = findIndex(serviceDescription, index);
+    if (slot != NO_INDEX)
     {
-        auto& entry = m_serviceDescriptions[index];
-        entry.reset();
-        // reuse the slot in the next insertion
-        m_freeIndex = index;
-        m_dataChanged = true;
+        resetEntry(slot, index);
     }
 }
 
@@ -150,25 +254,91 @@ void ServiceRegistry::find(const optional<capro::IdString_t>& service,
                            const optional<capro::IdString_t>& event,
                            function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
 {
-    for (auto& entry : m_serviceDescriptions)
+    find(service, instance, event, callable, nullptr);
+}
+
+void ServiceRegistry::find(const optional<capro::IdString_t>& service,
+                           const optional<capro::IdString_t>& instance,
+                           const optional<capro::IdString_t>& event,
+                           function_ref<void(const ServiceDescriptionEntry&)> callable,
+                           const ServiceRegistryIndex* const index) const noexcept
+{
+    const auto matches = [&](const ServiceDescriptionEntry& entry) {
+        bool match = (service) ? (entry.serviceDescription.getServiceIDString() == *service) : true;
+        match &= (instance) ? (entry.serviceDescription.getInstanceIDString() == *instance) : true;
+        match &= (event) ? (entry.serviceDescription.getEventIDString() == *event) : true;
+        return match;
+    };
+
+    // select the chain of the most selective string; the chain can contain entries of other strings which share the
+    // hash bucket, therefore the entries are still matched against all provided strings; without an index or a
+    // provided string all entries are visited
+    const ServiceRegistryIndex::HashIndex* selectedIndex{nullptr};
+    uint64_t selectedHash{0U};
+    if (index != nullptr && service && instance && event)
     {
-        if (entry)
-        {
-            bool match = (service) ? (entry->serviceDescription.getServiceIDString() == *service) : true;
-            match &= (instance) ? (entry->serviceDescription.getInstanceIDString() == *instance) : true;
-            match &= (event) ? (entry->serviceDescription.getEventIDString() == *event) : true;
+        selectedIndex = &index->m_serviceDescriptionIndex;
+        selectedHash = capro::ServiceDescription(*service, *instance, *event).getHash();
+    }
+    else if (index != nullptr)
+    {
+        const auto selectIfShorter = [&](const optional<capro::IdString_t>& idString,
+                                         const ServiceRegistryIndex::HashIndex& hashIndex) {
+            if (!idString)
+            {
+                return;
+            }
+            const auto hash = capro::hashIdString(*idString);
+            if (selectedIndex == nullptr || hashIndex.chainLength(hash) < selectedIndex->chainLength(selectedHash))
+            {
+                selectedIndex = &hashIndex;
+                selectedHash = hash;
+            }
+        };
+        selectIfShorter(service, index->m_serviceIndex);
+        selectIfShorter(instance, index->m_instanceIndex);
+        selectIfShorter(event, index->m_eventIndex);
+    }
 
-            if (match)
+    if (selectedIndex == nullptr)
+    {
+        forEach([&](const ServiceDescriptionEntry& entry) {
+            if (matches(entry))
             {
-                callable(*entry);
+                callable(entry);
             }
+        });
+        return;
+    }
+
+    for (auto i = selectedIndex->first(selectedHash); i != NO_INDEX; i = selectedIndex->next(i))
+    {
+        auto& entry = m_serviceDescriptions[i];
+        if (entry && matches(*entry))
+        {
+            callable(*entry);
         }
     }
 }
 
-uint32_t ServiceRegistry::findIndex(const capro::ServiceDescription& serviceDescription) const noexcept
+uint32_t ServiceRegistry::findIndex(const capro::ServiceDescription& serviceDescription,
+                                    const ServiceRegistryIndex* const index) const noexcept
 {
-    for (uint32_t i = 0; i < m_serviceDescriptions.size(); ++i)
+    if (index == nullptr)
+    {
+        for (uint32_t i = 0; i < m_serviceDescriptions.size(); ++i)
+        {
+            auto& entry = m_serviceDescriptions[i];
+            if (entry && entry->serviceDescription == serviceDescription)
+            {
+                return i;
+            }
+        }
+        return NO_INDEX;
+    }
+
+    const auto& hashIndex = index->m_serviceDescriptionIndex;
+    for (auto i = hashIndex.first(serviceDescription.getHash()); i != NO_INDEX; i = hashIndex.next(i))
     {
         auto& entry = m_serviceDescriptions[i];
         if (entry && entry->serviceDescription == serviceDescription)
@@ -190,6 +360,17 @@ void ServiceRegistry::forEach(function_ref<void(const ServiceDescriptionEntry&)>
     }
 }
 
+void ServiceRegistry::markChanged() noexcept
+{
+    m_dataChanged = true;
+    ++m_changeCounter;
+}
+
+uint64_t ServiceRegistry::changeCounter() const noexcept
+{
+    return m_changeCounter;
+}
+
 bool ServiceRegistry::hasDataChangedSinceLastCall() noexcept
 {
     auto dataChanged = m_dataChanged;
@@ -197,5 +378,60 @@ bool ServiceRegistry::hasDataChangedSinceLastCall() noexcept
     return dataChanged;
 }
 
+expected<void, IndexedServiceRegistry::Error>
+IndexedServiceRegistry::addPublisher(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    return m_registry.add(serviceDescription, &ServiceDescriptionEntry::publisherCount, &m_index);
+}
+
+void IndexedServiceRegistry::removePublisher(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    m_registry.remove(serviceDescription, &ServiceDescriptionEntry::publisherCount, &m_index);
+}
+
+expected<void, IndexedServiceRegistry::Error>
+IndexedServiceRegistry::addServer(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    return m_registry.add(serviceDescription, &ServiceDescriptionEntry::serverCount, &m_index);
+}
+
+void IndexedServiceRegistry::removeServer(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    m_registry.remove(serviceDescription, &ServiceDescriptionEntry::serverCount, &m_index);
+}
+
+void IndexedServiceRegistry::purge(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    m_registry.purge(serviceDescription, &m_index);
+}
+
+void IndexedServiceRegistry::find(const optional<capro::IdString_t>& service,
+                                  const optional<capro::IdString_t>& instance,
+                                  const optional<capro::IdString_t>& event,
+                                  function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
+{
+    m_registry.find(service, instance, event, callable, &m_index);
+}
+
+void IndexedServiceRegistry::forEach(function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
+{
+    m_registry.forEach(callable);
+}
+
+bool IndexedServiceRegistry::hasDataChangedSinceLastCall() noexcept
+{
+    return m_registry.hasDataChangedSinceLastCall();
+}
+
+uint64_t IndexedServiceRegistry::changeCounter() const noexcept
+{
+    return m_registry.changeCounter();
+}
+
+const ServiceRegistry& IndexedServiceRegistry::registry() const noexcept
+{
+    return m_registry;
+}
+
 } // namespace roudi
 } // namespace iox
@@ -0,0 +1,121 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/service_registry_delta.hpp"
+#include "iox/attributes.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+ServiceRegistryDelta::Change::Change(const Operation operation,
+                                     const capro::ServiceDescription& serviceDescription) noexcept
+    : operation(operation)
+    , serviceDescription(serviceDescription)
+{
+}
+
+ServiceRegistryDelta::ServiceRegistryDelta(const uint64_t previousChangeCounter) noexcept
+    : m_previousChangeCounter(previousChangeCounter)
+    , m_changeCounter(previousChangeCounter)
+{
+}
+
+void ServiceRegistryDelta::reset(const uint64_t previousChangeCounter) noexcept
+{
+    m_previousChangeCounter = previousChangeCounter;
+    m_changeCounter = previousChangeCounter;
+    m_isComplete = true;
+    m_changes.clear();
+}
+
+bool ServiceRegistryDelta::record(const Operation operation,
+                                  const capro::ServiceDescription& serviceDescription) noexcept
+{
+    if (!m_isComplete)
+    {
+        return false;
+    }
+
+    if (!m_changes.emplace_back(operation, serviceDescription))
+    {
+        // the operations are useless without the ones which do not fit anymore
+        m_isComplete = false;
+        m_changes.clear();
+        return false;
+    }
+
+    return true;
+}
+
+void ServiceRegistryDelta::setChangeCounter(const uint64_t changeCounter) noexcept
+{
+    m_changeCounter = changeCounter;
+}
+
+uint64_t ServiceRegistryDelta::previousChangeCounter() const noexcept
+{
+    return m_previousChangeCounter;
+}
+
+uint64_t ServiceRegistryDelta::changeCounter() const noexcept
+{
+    return m_changeCounter;
+}
+
+bool ServiceRegistryDelta::isComplete() const noexcept
+{
+    return m_isComplete;
+}
+
+const vector<ServiceRegistryDelta::Change, ServiceRegistryDelta::CAPACITY>&
+ServiceRegistryDelta::changes() const noexcept
+{
+    return m_changes;
+}
+
+bool ServiceRegistryDelta::applyTo(ServiceRegistry& registry) const noexcept
+{
+    if (!m_isComplete || registry.changeCounter() != m_previousChangeCounter)
+    {
+        return false;
+    }
+
+    for (const auto& change : m_changes)
+    {
+        // a full registry fails in the same way as the one of RouDi
+        switch (change.operation)
+        {
+        case Operation::ADD_PUBLISHER:
+            IOX_DISCARD_RESULT(registry.addPublisher(change.serviceDescription));
+            break;
+        case Operation::REMOVE_PUBLISHER:
+            registry.removePublisher(change.serviceDescription);
+            break;
+        case Operation::ADD_SERVER:
+            IOX_DISCARD_RESULT(registry.addServer(change.serviceDescription));
+            break;
+        case Operation::REMOVE_SERVER:
+            registry.removeServer(change.serviceDescription);
+            break;
+        }
+    }
+
+    return true;
+}
+
+} // namespace roudi
+} // namespace iox
@@ -32,13 +32,17 @@ Heartbeat::Heartbeat() noexcept
 /// @brief Get the elapsed milliseconds since the last heartbeat
 uint64_t Heartbeat::elapsed_milliseconds_since_last_beat() const noexcept
 {
-    auto now = milliseconds_since_epoch();
+    return elapsed_milliseconds_since_last_beat(milliseconds_since_epoch());
+}
+
+uint64_t Heartbeat::elapsed_milliseconds_since_last_beat(const uint64_t now_milliseconds) const noexcept
+{
     auto timestamp_last_beat = m_timestamp_last_beat.load(std::memory_order_relaxed);
-    if (timestamp_last_beat >= now)
+    if (timestamp_last_beat >= now_milliseconds)
     {
         return 0;
     }
-    return now - timestamp_last_beat;
+    return now_milliseconds - timestamp_last_beat;
 }
 
 /// @brief Update the heartbeat timestamp
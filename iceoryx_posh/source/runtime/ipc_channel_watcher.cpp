@@ -0,0 +1,112 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/ipc_channel_watcher.hpp"
+#include "iceoryx_platform/platform_settings.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iox/logging.hpp"
+#include "iox/posix_call.hpp"
+
+#include <chrono>
+#include <thread>
+
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/inotify.h>
+#endif
+
+namespace iox
+{
+namespace runtime
+{
+IpcChannelWatcher::IpcChannelWatcher() noexcept
+{
+#if defined(__linux__)
+    // on Linux the IPC channels are unix domain sockets which are created as files in a common directory
+    auto initCall = IOX_POSIX_CALL(inotify_init1)(IN_NONBLOCK | IN_CLOEXEC).failureReturnValue(-1).evaluate();
+    if (initCall.has_error())
+    {
+        IOX_LOG(DEBUG, "Unable to create an inotify instance; falling back to polling for RouDi");
+        return;
+    }
+
+    if (IOX_POSIX_CALL(inotify_add_watch)(
+            initCall->value, platform::IOX_UDS_SOCKET_PATH_PREFIX, IN_CREATE | IN_MOVED_TO | IN_ATTRIB)
+            .failureReturnValue(-1)
+            .evaluate()
+            .has_error())
+    {
+        IOX_LOG(DEBUG,
+                "Unable to watch '" << platform::IOX_UDS_SOCKET_PATH_PREFIX << "'; falling back to polling for RouDi");
+        IOX_DISCARD_RESULT(IOX_POSIX_CALL(iox_close)(initCall->value).failureReturnValue(-1).evaluate());
+        return;
+    }
+
+    m_fileDescriptor = initCall->value;
+#endif
+}
+
+IpcChannelWatcher::~IpcChannelWatcher() noexcept
+{
+    if (m_fileDescriptor != INVALID_FILE_DESCRIPTOR)
+    {
+        IOX_DISCARD_RESULT(IOX_POSIX_CALL(iox_close)(m_fileDescriptor).failureReturnValue(-1).evaluate());
+    }
+}
+
+bool IpcChannelWatcher::isWatching() const noexcept
+{
+    return m_fileDescriptor != INVALID_FILE_DESCRIPTOR;
+}
+
+void IpcChannelWatcher::waitForChange(const units::Duration timeout) noexcept
+{
+    if (!isWatching())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(timeout.toMilliseconds()));
+        return;
+    }
+
+#if defined(__linux__)
+    pollfd pollFd{m_fileDescriptor, POLLIN, 0};
+    auto pollCall = IOX_POSIX_CALL(poll)(&pollFd, 1U, static_cast<int>(timeout.toMilliseconds()))
+                        .failureReturnValue(-1)
+                        .ignoreErrnos(EINTR)
+                        .evaluate();
+    if (pollCall.has_error() || pollCall->value <= 0)
+    {
+        return;
+    }
+
+    // the events are only used to wake up; the caller checks itself whether the file it waits for exists
+    constexpr uint64_t EVENT_BUFFER_SIZE{4096U};
+    alignas(inotify_event) char eventBuffer[EVENT_BUFFER_SIZE];
+    while (true)
+    {
+        auto readCall = IOX_POSIX_CALL(iox_read)(m_fileDescriptor, &eventBuffer[0], EVENT_BUFFER_SIZE)
+                            .failureReturnValue(-1)
+                            .ignoreErrnos(EAGAIN, EWOULDBLOCK, EINTR)
+                            .evaluate();
+        if (readCall.has_error() || readCall->value <= 0)
+        {
+            break;
+        }
+    }
+#endif
+}
+
+} // namespace runtime
+} // namespace iox
@@ -17,8 +17,6 @@
 
 #include "iceoryx_posh/internal/runtime/ipc_message.hpp"
 
-#include <algorithm>
-
 namespace iox
 {
 namespace runtime
@@ -40,27 +38,19 @@ IpcMessage::IpcMessage(const std::string& msg) noexcept
 
 uint32_t IpcMessage::getNumberOfElements() const noexcept
 {
-    return m_numberOfElements;
+    return static_cast<uint32_t>(m_entryPositions.size());
 }
 
 std::string IpcMessage::getElementAtIndex(const uint32_t index) const noexcept
 {
-    std::string messageRemainder(m_msg);
-    size_t startPos = 0u;
-    size_t endPos = messageRemainder.find_first_of(m_separator, startPos);
-
-    for (uint32_t counter = 0u; endPos != std::string::npos; ++counter)
+    if (index >= m_entryPositions.size())
     {
-        if (counter == index)
-        {
-            return messageRemainder.substr(startPos, endPos - startPos);
-        }
-
-        startPos = endPos + 1u;
-        endPos = messageRemainder.find_first_of(m_separator, startPos);
+        return std::string();
     }
 
-    return std::string();
+    const auto startPos = m_entryPositions[index];
+    const auto endPos = (index + 1U < m_entryPositions.size()) ? m_entryPositions[index + 1U] - 1U : m_msg.size() - 1U;
+    return m_msg.substr(startPos, endPos - startPos);
 }
 
 bool IpcMessage::isValidEntry(const std::string& entry) const noexcept
@@ -93,18 +83,39 @@ void IpcMessage::setMessage(const std::string& msg) noexcept
     }
     else
     {
-        m_numberOfElements =
-            static_cast<uint32_t>(std::count_if(m_msg.begin(), m_msg.end(), [&](char c) { return c == m_separator; }));
+        std::string::size_type startPos{0U};
+        for (std::string::size_type pos = 0U; pos < m_msg.size(); ++pos)
+        {
+            if (m_msg[pos] == m_separator)
+            {
+                m_entryPositions.push_back(startPos);
+                startPos = pos + 1U;
+            }
+        }
     }
 }
 
 void IpcMessage::clearMessage() noexcept
 {
     m_msg.clear();
-    m_numberOfElements = 0u;
+    m_entryPositions.clear();
     m_isValid = true;
 }
 
+void IpcMessage::appendEntry(const std::string& entry) noexcept
+{
+    if (!isValidEntry(entry))
+    {
+        IOX_LOG(ERROR, "\'" << entry.c_str() << "\' is an invalid IPC channel entry");
+        m_isValid = false;
+        return;
+    }
+
+    m_entryPositions.push_back(m_msg.size());
+    m_msg.append(entry);
+    m_msg.push_back(m_separator);
+}
+
 bool IpcMessage::operator==(const IpcMessage& rhs) const noexcept
 {
     return this->getMessage() == rhs.getMessage();
@@ -17,6 +17,7 @@
 
 #include "iceoryx_posh/internal/runtime/ipc_runtime_interface.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_channel_watcher.hpp"
 #include "iceoryx_posh/version/version_info.hpp"
 #include "iox/assertions.hpp"
 #include "iox/detail/convert.hpp"
@@ -24,7 +25,7 @@
 #include "iox/posix_user.hpp"
 #include "iox/std_string_support.hpp"
 
-#include <thread>
+#include <algorithm>
 
 namespace iox
 {
@@ -170,6 +171,14 @@ UntypedRelativePointer::offset_t IpcRuntimeInterface::getSegmentManagerAddressOf
 
 bool IpcRuntimeInterface::sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answer) noexcept
 {
+    // RouDi releases the request channel while it handles the termination request, therefore the response must be
+    // received via the IPC channel
+    if (m_requestChannel != nullptr
+        && stringToIpcMessageType(msg.getElementAtIndex(0U).c_str()) != IpcMessageType::TERMINATION)
+    {
+        return m_requestChannel->sendRequest(msg, answer);
+    }
+
     if (!m_RoudiIpcInterface.send(msg))
     {
         IOX_LOG(ERROR, "Could not send request via RouDi IPC channel interface.\n");
@@ -185,6 +194,15 @@ bool IpcRuntimeInterface::sendRequestToRouDi(const IpcMessage& msg, IpcMessage&
     return true;
 }
 
+uint64_t IpcRuntimeInterface::getMaxMessageSize() const noexcept
+{
+    if (m_requestChannel != nullptr)
+    {
+        return REQUEST_CHANNEL_MESSAGE_SIZE;
+    }
+    return std::min(ROUDI_MESSAGE_SIZE, APP_MESSAGE_SIZE);
+}
+
 uint64_t IpcRuntimeInterface::getShmTopicSize() noexcept
 {
     return m_mgmtShmCharacteristics.shmTopicSize;
@@ -192,6 +210,13 @@ uint64_t IpcRuntimeInterface::getShmTopicSize() noexcept
 
 void IpcRuntimeInterface::waitForRoudi(IpcInterfaceUser& roudiIpcInterface, deadline_timer& timer) noexcept
 {
+    using namespace units::duration_literals;
+    // the polling interval is only an upper bound when the directory of the IPC channels is watched, since the watcher
+    // wakes up as soon as RouDi creates its channel; it must be created before the first attempt to open the channel
+    // in order to not miss the creation in between
+    constexpr units::Duration MAX_POLLING_INTERVAL{100_ms};
+    IpcChannelWatcher ipcChannelWatcher;
+
     bool printWaitingWarning = true;
     bool printFoundMessage = false;
     uint32_t numberOfRemainingFastPolls{10};
@@ -211,15 +236,14 @@ void IpcRuntimeInterface::waitForRoudi(IpcInterfaceUser& roudiIpcInterface, dead
             printWaitingWarning = false;
             printFoundMessage = true;
         }
-        if (numberOfRemainingFastPolls > 0)
+
+        auto pollingInterval = MAX_POLLING_INTERVAL;
+        if (!ipcChannelWatcher.isWatching() && numberOfRemainingFastPolls > 0)
         {
             --numberOfRemainingFastPolls;
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
-        }
-        else
-        {
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            pollingInterval = 10_ms;
         }
+        ipcChannelWatcher.waitForChange(std::min(pollingInterval, timer.remainingTime()));
     }
 
     if (printFoundMessage && roudiIpcInterface.isInitialized())
@@ -247,7 +271,7 @@ IpcRuntimeInterface::waitForRegAck(int64_t transmissionTimestamp,
 
             if (stringToIpcMessageType(cmd.c_str()) == IpcMessageType::REG_ACK)
             {
-                constexpr uint32_t REGISTER_ACK_PARAMETERS = 6U;
+                constexpr uint32_t REGISTER_ACK_PARAMETERS = 7U;
                 if (receiveBuffer.getNumberOfElements() != REGISTER_ACK_PARAMETERS)
                 {
                     IOX_REPORT_FATAL(PoshError::IPC_INTERFACE__REG_ACK_INVALIG_NUMBER_OF_PARAMS);
@@ -256,6 +280,7 @@ IpcRuntimeInterface::waitForRegAck(int64_t transmissionTimestamp,
                 // read out the shared memory base address and save it
                 UntypedRelativePointer::offset_t segmentManagerOffset{UntypedRelativePointer::NULL_POINTER_OFFSET};
                 UntypedRelativePointer::offset_t heartbeatOffset{UntypedRelativePointer::NULL_POINTER_OFFSET};
+                UntypedRelativePointer::offset_t requestChannelOffset{UntypedRelativePointer::NULL_POINTER_OFFSET};
                 int64_t receivedTimestamp{0U};
 
                 auto topic_size_result =
@@ -268,11 +293,13 @@ IpcRuntimeInterface::waitForRegAck(int64_t transmissionTimestamp,
                     iox::convert::from_string<uint64_t>(receiveBuffer.getElementAtIndex(4U).c_str());
                 auto heartbeat_offset_result =
                     iox::convert::from_string<uintptr_t>(receiveBuffer.getElementAtIndex(5U).c_str());
+                auto request_channel_offset_result =
+                    iox::convert::from_string<uintptr_t>(receiveBuffer.getElementAtIndex(6U).c_str());
 
                 // validate conversion results
                 if (!topic_size_result.has_value() || !segment_manager_offset_result.has_value()
                     || !recv_timestamp_result.has_value() || !segment_id_result.has_value()
-                    || !heartbeat_offset_result.has_value())
+                    || !heartbeat_offset_result.has_value() || !request_channel_offset_result.has_value())
                 {
                     return RegAckResult::MALFORMED_RESPONSE;
                 }
@@ -283,6 +310,7 @@ IpcRuntimeInterface::waitForRegAck(int64_t transmissionTimestamp,
                 segmentManagerOffset = segment_manager_offset_result.value();
                 receivedTimestamp = recv_timestamp_result.value();
                 heartbeatOffset = heartbeat_offset_result.value();
+                requestChannelOffset = request_channel_offset_result.value();
 
                 mgmtShmCharacteristics.segmentManagerAddressOffset = segmentManagerOffset;
 
@@ -291,6 +319,11 @@ IpcRuntimeInterface::waitForRegAck(int64_t transmissionTimestamp,
                     mgmtShmCharacteristics.heartbeatAddressOffset = heartbeatOffset;
                 }
 
+                if (requestChannelOffset != UntypedRelativePointer::NULL_POINTER_OFFSET)
+                {
+                    mgmtShmCharacteristics.requestChannelAddressOffset = requestChannelOffset;
+                }
+
                 if (transmissionTimestamp == receivedTimestamp)
                 {
                     return RegAckResult::SUCCESS;
@@ -320,5 +353,15 @@ optional<UntypedRelativePointer::offset_t> IpcRuntimeInterface::getHeartbeatAddr
     return m_mgmtShmCharacteristics.heartbeatAddressOffset;
 }
 
+optional<UntypedRelativePointer::offset_t> IpcRuntimeInterface::getRequestChannelAddressOffset() const noexcept
+{
+    return m_mgmtShmCharacteristics.requestChannelAddressOffset;
+}
+
+void IpcRuntimeInterface::useRequestChannel(RequestChannel& requestChannel) noexcept
+{
+    m_requestChannel = &requestChannel;
+}
+
 } // namespace runtime
 } // namespace iox
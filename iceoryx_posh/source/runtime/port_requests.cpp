@@ -0,0 +1,63 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/runtime/port_requests.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+PortRequests& PortRequests::addPublisher(const capro::ServiceDescription& service,
+                                         const popo::PublisherOptions& publisherOptions,
+                                         const PortConfigInfo& portConfigInfo) noexcept
+{
+    PortRequest request;
+    request.type = IpcMessageType::CREATE_PUBLISHER;
+    request.service = service;
+    request.publisherOptions = publisherOptions;
+    request.portConfigInfo = portConfigInfo;
+    m_requests.push_back(request);
+    return *this;
+}
+
+PortRequests& PortRequests::addSubscriber(const capro::ServiceDescription& service,
+                                          const popo::SubscriberOptions& subscriberOptions,
+                                          const PortConfigInfo& portConfigInfo) noexcept
+{
+    PortRequest request;
+    request.type = IpcMessageType::CREATE_SUBSCRIBER;
+    request.service = service;
+    request.subscriberOptions = subscriberOptions;
+    request.portConfigInfo = portConfigInfo;
+    m_requests.push_back(request);
+    return *this;
+}
+
+PortRequests& PortRequests::addConditionVariable() noexcept
+{
+    PortRequest request;
+    request.type = IpcMessageType::CREATE_CONDITION_VARIABLE;
+    m_requests.push_back(request);
+    return *this;
+}
+
+uint64_t PortRequests::size() const noexcept
+{
+    return m_requests.size();
+}
+
+} // namespace runtime
+} // namespace iox
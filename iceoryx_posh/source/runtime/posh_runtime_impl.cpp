@@ -26,12 +26,36 @@
 #include "iceoryx_posh/runtime/port_config_info.hpp"
 #include "iox/logging.hpp"
 
+#include <algorithm>
 #include <cstdint>
+#include <limits>
 
 namespace iox
 {
 namespace runtime
 {
+namespace
+{
+// a port response consists of the message type, the offset and the segment id or of the message type and the error;
+// each entry is a number with at most the digits of an uint64_t followed by the separator
+constexpr uint64_t MAX_PORT_RESPONSE_SIZE{3U * (static_cast<uint64_t>(std::numeric_limits<uint64_t>::digits10) + 2U)};
+
+IpcMessageType portAckType(const IpcMessageType requestType) noexcept
+{
+    switch (requestType)
+    {
+    case IpcMessageType::CREATE_PUBLISHER:
+        return IpcMessageType::CREATE_PUBLISHER_ACK;
+    case IpcMessageType::CREATE_SUBSCRIBER:
+        return IpcMessageType::CREATE_SUBSCRIBER_ACK;
+    case IpcMessageType::CREATE_CONDITION_VARIABLE:
+        return IpcMessageType::CREATE_CONDITION_VARIABLE_ACK;
+    default:
+        return IpcMessageType::NOTYPE;
+    }
+}
+} // namespace
+
 PoshRuntimeImpl::PoshRuntimeImpl(optional<const RuntimeName_t*> name,
                                  std::pair<IpcRuntimeInterface, optional<SharedMemoryUser>>&& interfaces) noexcept
     : PoshRuntime(name)
@@ -46,6 +70,14 @@ PoshRuntimeImpl::PoshRuntimeImpl(optional<const RuntimeName_t*> name,
                                                          heartbeatAddressOffset.value());
     }
 
+    // the request channel can only be used after the management segment is mapped
+    auto requestChannelAddressOffset = ipcInterface->getRequestChannelAddressOffset();
+    if (requestChannelAddressOffset.has_value())
+    {
+        ipcInterface->useRequestChannel(*RelativePointer<RequestChannel>::getPtr(
+            segment_id_t{ipcInterface->getSegmentId()}, requestChannelAddressOffset.value()));
+    }
+
     static_assert(PROCESS_KEEP_ALIVE_INTERVAL > roudi::DISCOVERY_INTERVAL, "Keep alive interval too small");
     m_keepAliveTask.emplace(concurrent::detail::PeriodicTaskAutoStart,
                             PROCESS_KEEP_ALIVE_INTERVAL,
@@ -147,10 +179,9 @@ PoshRuntimeImpl::~PoshRuntimeImpl() noexcept
     }
 }
 
-PublisherPortUserType::MemberType_t*
-PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service,
-                                        const popo::PublisherOptions& publisherOptions,
-                                        const PortConfigInfo& portConfigInfo) noexcept
+IpcMessage PoshRuntimeImpl::createPublisherRequest(const capro::ServiceDescription& service,
+                                                  const popo::PublisherOptions& publisherOptions,
+                                                  const PortConfigInfo& portConfigInfo) const noexcept
 {
     constexpr uint64_t MAX_HISTORY_CAPACITY =
         PublisherPortUserType::MemberType_t::ChunkSenderData_t::ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY;
@@ -175,6 +206,22 @@ PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service
                << static_cast<Serialization>(service).toString() << publisherOptions.serialize().toString()
                << static_cast<Serialization>(portConfigInfo).toString();
 
+    return sendBuffer;
+}
+
+PublisherPortUserType::MemberType_t*
+PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service,
+                                        const popo::PublisherOptions& publisherOptions,
+                                        const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto sendBuffer = createPublisherRequest(service, publisherOptions, portConfigInfo);
+
+    auto requestedPort = takeRequestedPort(sendBuffer);
+    if (requestedPort.has_value())
+    {
+        return static_cast<PublisherPortUserType::MemberType_t*>(requestedPort.value());
+    }
+
     auto maybePublisher = requestPublisherFromRoudi(sendBuffer);
     if (maybePublisher.has_error())
     {
@@ -266,10 +313,9 @@ PoshRuntimeImpl::requestPublisherFromRoudi(const IpcMessage& sendBuffer) noexcep
     return err(IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE);
 }
 
-SubscriberPortUserType::MemberType_t*
-PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& service,
-                                         const popo::SubscriberOptions& subscriberOptions,
-                                         const PortConfigInfo& portConfigInfo) noexcept
+IpcMessage PoshRuntimeImpl::createSubscriberRequest(const capro::ServiceDescription& service,
+                                                   const popo::SubscriberOptions& subscriberOptions,
+                                                   const PortConfigInfo& portConfigInfo) const noexcept
 {
     constexpr uint64_t MAX_QUEUE_CAPACITY = SubscriberPortUserType::MemberType_t::ChunkQueueData_t::MAX_CAPACITY;
 
@@ -308,6 +354,22 @@ PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& servic
                << static_cast<Serialization>(service).toString() << options.serialize().toString()
                << static_cast<Serialization>(portConfigInfo).toString();
 
+    return sendBuffer;
+}
+
+SubscriberPortUserType::MemberType_t*
+PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& service,
+                                         const popo::SubscriberOptions& subscriberOptions,
+                                         const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto sendBuffer = createSubscriberRequest(service, subscriberOptions, portConfigInfo);
+
+    auto requestedPort = takeRequestedPort(sendBuffer);
+    if (requestedPort.has_value())
+    {
+        return static_cast<SubscriberPortUserType::MemberType_t*>(requestedPort.value());
+    }
+
     auto maybeSubscriber = requestSubscriberFromRoudi(sendBuffer);
 
     if (maybeSubscriber.has_error())
@@ -693,10 +755,22 @@ PoshRuntimeImpl::requestConditionVariableFromRoudi(const IpcMessage& sendBuffer)
     return err(IpcMessageErrorType::REQUEST_CONDITION_VARIABLE_WRONG_IPC_MESSAGE_RESPONSE);
 }
 
-popo::ConditionVariableData* PoshRuntimeImpl::getMiddlewareConditionVariable() noexcept
+IpcMessage PoshRuntimeImpl::createConditionVariableRequest() const noexcept
 {
     IpcMessage sendBuffer;
     sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_CONDITION_VARIABLE) << m_appName;
+    return sendBuffer;
+}
+
+popo::ConditionVariableData* PoshRuntimeImpl::getMiddlewareConditionVariable() noexcept
+{
+    auto sendBuffer = createConditionVariableRequest();
+
+    auto requestedPort = takeRequestedPort(sendBuffer);
+    if (requestedPort.has_value())
+    {
+        return static_cast<popo::ConditionVariableData*>(requestedPort.value());
+    }
 
     auto maybeConditionVariable = requestConditionVariableFromRoudi(sendBuffer);
     if (maybeConditionVariable.has_error())
@@ -728,6 +802,133 @@ popo::ConditionVariableData* PoshRuntimeImpl::getMiddlewareConditionVariable() n
     return maybeConditionVariable.value();
 }
 
+void PoshRuntimeImpl::requestPorts(const PortRequests& portRequests) noexcept
+{
+    const auto maxMessageSize = m_ipcChannelInterface->getMaxMessageSize();
+    // the responses of all ports of a batch and the CREATE_PORTS_ACK must fit into a message
+    const auto maxPortsPerBatch = std::min<uint64_t>(MAX_PORT_REQUESTS_PER_BATCH,
+                                                     ((maxMessageSize - 1U) / MAX_PORT_RESPONSE_SIZE) - 1U);
+
+    IpcMessage batchHeader;
+    batchHeader << IpcMessageTypeToString(IpcMessageType::CREATE_PORTS) << m_appName;
+    const auto batchHeaderSize = batchHeader.getMessage().size();
+
+    std::vector<IpcMessage> batch;
+    auto batchSize = batchHeaderSize;
+    for (const auto& portRequest : portRequests.m_requests)
+    {
+        IpcMessage request;
+        switch (portRequest.type)
+        {
+        case IpcMessageType::CREATE_PUBLISHER:
+            request =
+                createPublisherRequest(portRequest.service, portRequest.publisherOptions, portRequest.portConfigInfo);
+            break;
+        case IpcMessageType::CREATE_SUBSCRIBER:
+            request =
+                createSubscriberRequest(portRequest.service, portRequest.subscriberOptions, portRequest.portConfigInfo);
+            break;
+        default:
+            request = createConditionVariableRequest();
+            break;
+        }
+
+        // the runtime name is contained only once in the batched request
+        const auto requestSize = request.getMessage().size() - request.getElementAtIndex(1U).size() - 1U;
+        if (batchHeaderSize + requestSize >= maxMessageSize)
+        {
+            IOX_LOG(DEBUG, "The port request '" << request.getMessage() << "' is too large to be batched");
+            continue;
+        }
+
+        if (batch.size() == maxPortsPerBatch || batchSize + requestSize >= maxMessageSize)
+        {
+            requestPortsFromRoudi(batch);
+            batch.clear();
+            batchSize = batchHeaderSize;
+        }
+        batch.push_back(request);
+        batchSize += requestSize;
+    }
+
+    if (!batch.empty())
+    {
+        requestPortsFromRoudi(batch);
+    }
+}
+
+void PoshRuntimeImpl::requestPortsFromRoudi(const std::vector<IpcMessage>& requests) noexcept
+{
+    IpcMessage sendBuffer;
+    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PORTS) << m_appName;
+    for (const auto& request : requests)
+    {
+        sendBuffer << request.getElementAtIndex(0U);
+        for (uint32_t i = 2U; i < request.getNumberOfElements(); ++i)
+        {
+            sendBuffer << request.getElementAtIndex(i);
+        }
+    }
+
+    IpcMessage receiveBuffer;
+    if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false
+        || stringToIpcMessageType(receiveBuffer.getElementAtIndex(0U).c_str()) != IpcMessageType::CREATE_PORTS_ACK)
+    {
+        IOX_LOG(WARN,
+                "Request ports got invalid response, the " << requests.size() << " ports are requested on demand");
+        return;
+    }
+
+    auto requestedPorts = m_requestedPorts.get_scope_guard();
+    uint32_t index{1U};
+    for (const auto& request : requests)
+    {
+        const auto responseType = stringToIpcMessageType(receiveBuffer.getElementAtIndex(index).c_str());
+        if (responseType == IpcMessageType::ERROR)
+        {
+            // the getMiddleware call requests the port again and reports the error
+            IOX_LOG(DEBUG, "RouDi could not create the requested port '" << request.getMessage() << "'");
+            index += 2U;
+            continue;
+        }
+
+        const auto requestType = stringToIpcMessageType(request.getElementAtIndex(0U).c_str());
+        if (responseType != portAckType(requestType) || index + 3U > receiveBuffer.getNumberOfElements())
+        {
+            IOX_LOG(ERROR, "Request ports got wrong response from IPC channel :'" << receiveBuffer.getMessage() << "'");
+            return;
+        }
+
+        IpcMessage portResponse;
+        portResponse << receiveBuffer.getElementAtIndex(index) << receiveBuffer.getElementAtIndex(index + 1U)
+                     << receiveBuffer.getElementAtIndex(index + 2U);
+        index += 3U;
+
+        auto result = convert_id_and_offset(portResponse);
+        if (!result)
+        {
+            return;
+        }
+
+        auto [segment_id, offset] = result.value();
+        requestedPorts->emplace(request.getMessage(), UntypedRelativePointer::getPtr(segment_id_t{segment_id}, offset));
+    }
+}
+
+optional<void*> PoshRuntimeImpl::takeRequestedPort(const IpcMessage& request) noexcept
+{
+    auto requestedPorts = m_requestedPorts.get_scope_guard();
+    auto requestedPort = requestedPorts->find(request.getMessage());
+    if (requestedPort == requestedPorts->end())
+    {
+        return nullopt;
+    }
+
+    auto ptr = requestedPort->second;
+    requestedPorts->erase(requestedPort);
+    return ptr;
+}
+
 bool PoshRuntimeImpl::sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answer) noexcept
 {
     return m_ipcChannelInterface->sendRequestToRouDi(msg, answer);
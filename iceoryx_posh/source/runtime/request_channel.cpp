@@ -0,0 +1,269 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/request_channel.hpp"
+#include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iox/deadline_timer.hpp"
+#include "iox/logging.hpp"
+
+#include <cstring>
+
+namespace iox
+{
+namespace runtime
+{
+RequestChannel::RequestChannel() noexcept
+{
+    UnnamedSemaphoreBuilder()
+        .initialValue(0U)
+        .isInterProcessCapable(true)
+        .create(m_responseSemaphore)
+        .or_else([](auto) { IOX_REPORT_FATAL(PoshError::POSH__RUNTIME_REQUEST_CHANNEL_FAILED_TO_CREATE_SEMAPHORE); });
+}
+
+bool RequestChannel::copyMessage(const IpcMessage& message, char* const destination, const uint64_t capacity) noexcept
+{
+    const auto serializedMessage = message.getMessage();
+    // the terminating null character must also fit into the buffer
+    if (serializedMessage.size() >= capacity)
+    {
+        return false;
+    }
+    std::memcpy(destination, serializedMessage.c_str(), serializedMessage.size() + 1U);
+    return true;
+}
+
+bool RequestChannel::sendRequest(const IpcMessage& request,
+                                 IpcMessage& answer,
+                                 const units::Duration timeout) noexcept
+{
+    if (!request.isValid())
+    {
+        IOX_LOG(ERROR,
+                "Trying to send the message " << request.getMessage() << " which "
+                                              << "does not follow the specified syntax.");
+        return false;
+    }
+
+    // the channel is claimed before the request is written, therefore concurrent senders cannot overwrite the request
+    auto expectedState = State::IDLE;
+    if (!m_state.compare_exchange_strong(expectedState, State::WRITING_REQUEST, std::memory_order_acq_rel))
+    {
+        IOX_LOG(ERROR, "Could not send request via the request channel since a previous request is still in flight");
+        return false;
+    }
+
+    if (!copyMessage(request, &m_request[0], REQUEST_CHANNEL_MESSAGE_SIZE))
+    {
+        IOX_LOG(ERROR, "Could not send request via the request channel since it exceeds the maximum message size");
+        m_state.store(State::IDLE, std::memory_order_release);
+        return false;
+    }
+
+    m_state.store(State::REQUEST_PENDING, std::memory_order_release);
+    if (!m_pool->notifyRequest(m_index))
+    {
+        IOX_LOG(ERROR, "Could not send request via the request channel since the queue of pending requests is full");
+        IOX_DISCARD_RESULT(withdrawRequest());
+        return false;
+    }
+
+    // a wake up from a response which was sent to a previous owner of the channel is ignored by checking the state
+    deadline_timer timer(timeout);
+    while (m_state.load(std::memory_order_acquire) != State::RESPONSE_PENDING)
+    {
+        auto waitResult = m_responseSemaphore->timedWait(timer.remainingTime());
+        if (waitResult.has_error())
+        {
+            IOX_LOG(ERROR, "Could not wait for the response via the request channel");
+            if (withdrawRequest())
+            {
+                return false;
+            }
+            break;
+        }
+
+        if (waitResult.value() == SemaphoreWaitState::TIMEOUT)
+        {
+            // the response could have arrived in between, then it is not withdrawn but received
+            if (withdrawRequest())
+            {
+                IOX_LOG(ERROR, "RouDi did not respond to the request via the request channel in time");
+                return false;
+            }
+            break;
+        }
+    }
+
+    answer.setMessage(std::string(&m_response[0]));
+    m_state.store(State::IDLE, std::memory_order_release);
+    return true;
+}
+
+bool RequestChannel::withdrawRequest() noexcept
+{
+    // a request which was not yet taken by RouDi is withdrawn and its outdated index in the queue is skipped; a
+    // request which is processed by RouDi is abandoned and RouDi resets the channel instead of sending the response
+    auto expectedState = State::REQUEST_PENDING;
+    if (m_state.compare_exchange_strong(expectedState, State::IDLE, std::memory_order_acq_rel))
+    {
+        return true;
+    }
+
+    if (expectedState == State::PROCESSING_REQUEST
+        && m_state.compare_exchange_strong(expectedState, State::REQUEST_ABANDONED, std::memory_order_acq_rel))
+    {
+        return true;
+    }
+
+    // RouDi took the request and sent the response in the meantime
+    return expectedState != State::RESPONSE_PENDING;
+}
+
+optional<IpcMessage> RequestChannel::takeRequest() noexcept
+{
+    auto expectedState = State::REQUEST_PENDING;
+    if (!m_state.compare_exchange_strong(expectedState, State::PROCESSING_REQUEST, std::memory_order_acq_rel))
+    {
+        return nullopt;
+    }
+
+    // the request is written by the application, therefore it cannot be relied on the terminating null character
+    return IpcMessage(std::string(&m_request[0], strnlen(&m_request[0], REQUEST_CHANNEL_MESSAGE_SIZE)));
+}
+
+bool RequestChannel::sendResponse(const IpcMessage& response) noexcept
+{
+    if (resetAbandonedRequest() || m_state.load(std::memory_order_acquire) != State::PROCESSING_REQUEST)
+    {
+        return false;
+    }
+
+    if (!copyMessage(response, &m_response[0], REQUEST_CHANNEL_MESSAGE_SIZE))
+    {
+        IOX_LOG(ERROR, "Could not send response via the request channel since it exceeds the maximum message size");
+        m_response[0] = '\0';
+    }
+
+    auto expectedState = State::PROCESSING_REQUEST;
+    if (!m_state.compare_exchange_strong(expectedState, State::RESPONSE_PENDING, std::memory_order_acq_rel))
+    {
+        // the application abandoned the request while the response was written
+        IOX_DISCARD_RESULT(resetAbandonedRequest());
+        return false;
+    }
+
+    IOX_DISCARD_RESULT(m_responseSemaphore->post());
+    return true;
+}
+
+bool RequestChannel::resetAbandonedRequest() noexcept
+{
+    auto expectedState = State::REQUEST_ABANDONED;
+    return m_state.compare_exchange_strong(expectedState, State::IDLE, std::memory_order_acq_rel);
+}
+
+void RequestChannel::finishRequest() noexcept
+{
+    const auto state = m_state.load(std::memory_order_acquire);
+    if (state == State::PROCESSING_REQUEST || state == State::REQUEST_ABANDONED)
+    {
+        IOX_DISCARD_RESULT(sendResponse(IpcMessage()));
+    }
+}
+
+const RuntimeName_t& RequestChannel::getRuntimeName() const noexcept
+{
+    return m_runtimeName;
+}
+
+RequestChannelPool::RequestChannelPool() noexcept
+{
+    for (uint32_t index = 0U; index < MAX_PROCESS_NUMBER; ++index)
+    {
+        m_channels[index].m_pool = this;
+        m_channels[index].m_index = index;
+    }
+
+    UnnamedSemaphoreBuilder()
+        .initialValue(0U)
+        .isInterProcessCapable(true)
+        .create(m_requestSemaphore)
+        .or_else([](auto) { IOX_REPORT_FATAL(PoshError::POSH__RUNTIME_REQUEST_CHANNEL_FAILED_TO_CREATE_SEMAPHORE); });
+}
+
+optional<RequestChannel*> RequestChannelPool::acquire(const RuntimeName_t& runtimeName) noexcept
+{
+    for (uint32_t index = 0U; index < MAX_PROCESS_NUMBER; ++index)
+    {
+        if (!m_isInUse[index])
+        {
+            auto& channel = m_channels[index];
+            // discard wake ups which were meant for the previous owner of the channel
+            bool hasPendingWakeUp{true};
+            while (hasPendingWakeUp)
+            {
+                channel.m_responseSemaphore->tryWait()
+                    .and_then([&hasPendingWakeUp](const auto& countNonZero) { hasPendingWakeUp = countNonZero; })
+                    .or_else([&hasPendingWakeUp](const auto&) { hasPendingWakeUp = false; });
+            }
+            channel.m_runtimeName = runtimeName;
+            channel.m_state.store(RequestChannel::State::IDLE, std::memory_order_release);
+            m_isInUse[index] = true;
+            return &channel;
+        }
+    }
+    return nullopt;
+}
+
+void RequestChannelPool::release(RequestChannel& channel) noexcept
+{
+    // an outdated request in the queue is skipped since the channel is not in the 'REQUEST_PENDING' state
+    channel.m_state.store(RequestChannel::State::IDLE, std::memory_order_release);
+    m_isInUse[channel.m_index] = false;
+}
+
+optional<RequestChannel*> RequestChannelPool::waitForRequest(const units::Duration timeout) noexcept
+{
+    // every request posts the semaphore once, therefore the queue is not empty after a successful wait
+    auto waitResult = m_requestSemaphore->timedWait(timeout);
+    if (waitResult.has_error() || waitResult.value() == SemaphoreWaitState::TIMEOUT)
+    {
+        return nullopt;
+    }
+
+    auto index = m_pendingRequests.pop();
+    if (!index.has_value())
+    {
+        return nullopt;
+    }
+    return &m_channels[index.value()];
+}
+
+bool RequestChannelPool::notifyRequest(const uint32_t index) noexcept
+{
+    // there is at most one request in flight per channel, but withdrawn requests leave outdated indices in the queue
+    // until RouDi skips them, therefore the queue can be full
+    if (!m_pendingRequests.tryPush(index))
+    {
+        return false;
+    }
+    IOX_DISCARD_RESULT(m_requestSemaphore->post());
+    return true;
+}
+
+} // namespace runtime
+} // namespace iox
@@ -28,10 +28,42 @@ ServiceDiscovery::ServiceDiscovery() noexcept
 
 void ServiceDiscovery::update()
 {
-    // allows us to use update and hence findService concurrently
-    std::lock_guard<std::mutex> lock(m_serviceRegistryMutex);
+    // a newer snapshot replaces the held one, afterwards only the deltas which are not contained in it are applied
+    updateFromSnapshot();
+
+    bool hasDelta{true};
+    while (hasDelta)
+    {
+        hasDelta =
+            m_serviceRegistryDeltaSubscriber.take()
+                .and_then([&](popo::Sample<const roudi::ServiceRegistryDelta>& deltaSample) {
+                    if (deltaSample->changeCounter() <= m_serviceRegistryView->changeCounter())
+                    {
+                        // the changes are already contained in the snapshot
+                        return;
+                    }
+
+                    if (!m_serviceRegistryView->apply(*deltaSample))
+                    {
+                        // a delta was missed, is incomplete or exceeds the overlay of the view; RouDi published a
+                        // snapshot before this delta or retries a failed one, until then the view keeps its state
+                        updateFromSnapshot();
+                        IOX_DISCARD_RESULT(m_serviceRegistryView->apply(*deltaSample));
+                    }
+                })
+                .has_value();
+    }
+}
+
+void ServiceDiscovery::updateFromSnapshot()
+{
     m_serviceRegistrySubscriber.take().and_then([&](popo::Sample<const roudi::ServiceRegistry>& serviceRegistrySample) {
-        *m_serviceRegistry = *serviceRegistrySample;
+        // the sample is searched in place; it replaces the held sample, therefore every ServiceDiscovery pins at
+        // most one snapshot chunk besides the one in its queue
+        if (serviceRegistrySample->changeCounter() >= m_serviceRegistryView->changeCounter())
+        {
+            m_serviceRegistryView->setSnapshot(std::move(serviceRegistrySample));
+        }
     });
 }
 
@@ -41,13 +73,15 @@ void ServiceDiscovery::findService(const optional<capro::IdString_t>& service,
                                    const function_ref<void(const capro::ServiceDescription&)> callableForEach,
                                    const popo::MessagingPattern pattern) noexcept
 {
+    // allows us to use findService concurrently; the view must not be updated while it is searched
+    std::lock_guard<std::mutex> lock(m_serviceRegistryMutex);
     update();
 
     switch (pattern)
     {
     case popo::MessagingPattern::PUB_SUB:
     {
-        m_serviceRegistry->find(
+        m_serviceRegistryView->find(
             service, instance, event, [&](const roudi::ServiceRegistry::ServiceDescriptionEntry& serviceEntry) {
                 if (serviceEntry.publisherCount > 0)
                 {
@@ -58,7 +92,7 @@ void ServiceDiscovery::findService(const optional<capro::IdString_t>& service,
     }
     case popo::MessagingPattern::REQ_RES:
     {
-        m_serviceRegistry->find(
+        m_serviceRegistryView->find(
             service, instance, event, [&](const roudi::ServiceRegistry::ServiceDescriptionEntry& serviceEntry) {
                 if (serviceEntry.serverCount > 0)
                 {
@@ -81,7 +115,7 @@ void ServiceDiscovery::enableEvent(popo::TriggerHandle&& triggerHandle, const Se
     {
     case ServiceDiscoveryEvent::SERVICE_REGISTRY_CHANGED:
     {
-        m_serviceRegistrySubscriber.enableEvent(std::move(triggerHandle), popo::SubscriberEvent::DATA_RECEIVED);
+        m_serviceRegistryDeltaSubscriber.enableEvent(std::move(triggerHandle), popo::SubscriberEvent::DATA_RECEIVED);
         break;
     }
     default:
@@ -98,7 +132,7 @@ void ServiceDiscovery::disableEvent(const ServiceDiscoveryEvent event) noexcept
     {
     case ServiceDiscoveryEvent::SERVICE_REGISTRY_CHANGED:
     {
-        m_serviceRegistrySubscriber.disableEvent(popo::SubscriberEvent::DATA_RECEIVED);
+        m_serviceRegistryDeltaSubscriber.disableEvent(popo::SubscriberEvent::DATA_RECEIVED);
         break;
     }
     default:
@@ -111,13 +145,13 @@ void ServiceDiscovery::disableEvent(const ServiceDiscoveryEvent event) noexcept
 
 void ServiceDiscovery::invalidateTrigger(const uint64_t uniqueTriggerId)
 {
-    m_serviceRegistrySubscriber.invalidateTrigger(uniqueTriggerId);
+    m_serviceRegistryDeltaSubscriber.invalidateTrigger(uniqueTriggerId);
 }
 
 popo::WaitSetIsConditionSatisfiedCallback
 ServiceDiscovery::getCallbackForIsStateConditionSatisfied(const popo::SubscriberState state)
 {
-    return m_serviceRegistrySubscriber.getCallbackForIsStateConditionSatisfied(state);
+    return m_serviceRegistryDeltaSubscriber.getCallbackForIsStateConditionSatisfied(state);
 }
 
 } // namespace runtime
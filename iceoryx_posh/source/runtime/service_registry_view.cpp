@@ -0,0 +1,212 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/service_registry_view.hpp"
+#include "iox/attributes.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+namespace
+{
+bool matches(const optional<capro::IdString_t>& filter, const capro::IdString_t& value) noexcept
+{
+    return !filter.has_value() || *filter == value;
+}
+} // namespace
+
+ServiceRegistryView::OverlayEntry::OverlayEntry(
+    const roudi::ServiceRegistry::ServiceDescriptionEntry& snapshotEntry) noexcept
+    : entry(snapshotEntry)
+    , snapshotPublisherCount(snapshotEntry.publisherCount)
+    , snapshotServerCount(snapshotEntry.serverCount)
+{
+}
+
+bool ServiceRegistryView::OverlayEntry::isInSnapshot() const noexcept
+{
+    return snapshotPublisherCount > 0U || snapshotServerCount > 0U;
+}
+
+bool ServiceRegistryView::OverlayEntry::isInView() const noexcept
+{
+    return entry.publisherCount > 0U || entry.serverCount > 0U;
+}
+
+uint64_t ServiceRegistryView::changeCounter() const noexcept
+{
+    return m_changeCounter;
+}
+
+void ServiceRegistryView::setSnapshot(Snapshot_t&& snapshot) noexcept
+{
+    m_changeCounter = snapshot->changeCounter();
+    m_numberOfEntries = 0U;
+    snapshot->forEach([&](const auto&) { ++m_numberOfEntries; });
+
+    // the previous snapshot is released, therefore the view holds at most one sample
+    m_overlay.clear();
+    m_snapshot.reset();
+    m_snapshot.emplace(std::move(snapshot));
+}
+
+bool ServiceRegistryView::apply(const roudi::ServiceRegistryDelta& delta) noexcept
+{
+    if (!delta.isComplete() || delta.previousChangeCounter() != m_changeCounter)
+    {
+        return false;
+    }
+
+    // every change can occupy a new overlay entry; when the overlay is exhausted, the view waits for the next
+    // snapshot which RouDi publishes at least with every SNAPSHOT_INTERVAL-th delta or retries when it failed
+    if (m_overlay.size() + delta.changes().size() > OVERLAY_CAPACITY)
+    {
+        return false;
+    }
+
+    using Operation = roudi::ServiceRegistryDelta::Operation;
+    using Entry_t = roudi::ServiceRegistry::ServiceDescriptionEntry;
+    for (const auto& change : delta.changes())
+    {
+        switch (change.operation)
+        {
+        case Operation::ADD_PUBLISHER:
+            add(change.serviceDescription, &Entry_t::publisherCount);
+            break;
+        case Operation::REMOVE_PUBLISHER:
+            remove(change.serviceDescription, &Entry_t::publisherCount);
+            break;
+        case Operation::ADD_SERVER:
+            add(change.serviceDescription, &Entry_t::serverCount);
+            break;
+        case Operation::REMOVE_SERVER:
+            remove(change.serviceDescription, &Entry_t::serverCount);
+            break;
+        }
+    }
+
+    m_changeCounter = delta.changeCounter();
+    return true;
+}
+
+void ServiceRegistryView::find(
+    const optional<capro::IdString_t>& service,
+    const optional<capro::IdString_t>& instance,
+    const optional<capro::IdString_t>& event,
+    function_ref<void(const roudi::ServiceRegistry::ServiceDescriptionEntry&)> callable) const noexcept
+{
+    if (m_snapshot.has_value())
+    {
+        // the entries of the snapshot are searched in place, changed entries are replaced by the ones of the overlay
+        (*m_snapshot)->find(
+            service, instance, event, [&](const roudi::ServiceRegistry::ServiceDescriptionEntry& snapshotEntry) {
+                const auto index = indexInOverlay(snapshotEntry.serviceDescription);
+                if (index == m_overlay.size())
+                {
+                    callable(snapshotEntry);
+                }
+                else if (m_overlay[index].isInView())
+                {
+                    callable(m_overlay[index].entry);
+                }
+            });
+    }
+
+    for (const auto& overlayEntry : m_overlay)
+    {
+        const auto& serviceDescription = overlayEntry.entry.serviceDescription;
+        if (!overlayEntry.isInSnapshot() && overlayEntry.isInView()
+            && matches(service, serviceDescription.getServiceIDString())
+            && matches(instance, serviceDescription.getInstanceIDString())
+            && matches(event, serviceDescription.getEventIDString()))
+        {
+            callable(overlayEntry.entry);
+        }
+    }
+}
+
+uint64_t ServiceRegistryView::indexInOverlay(const capro::ServiceDescription& serviceDescription) const noexcept
+{
+    // the overlay is small and the comparison of the service descriptions starts with their hashes
+    for (uint64_t i = 0U; i < m_overlay.size(); ++i)
+    {
+        if (m_overlay[i].entry.serviceDescription == serviceDescription)
+        {
+            return i;
+        }
+    }
+    return m_overlay.size();
+}
+
+ServiceRegistryView::OverlayEntry&
+ServiceRegistryView::acquireOverlayEntry(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    const auto index = indexInOverlay(serviceDescription);
+    if (index < m_overlay.size())
+    {
+        return m_overlay[index];
+    }
+
+    roudi::ServiceRegistry::ServiceDescriptionEntry snapshotEntry{serviceDescription};
+    if (m_snapshot.has_value())
+    {
+        (*m_snapshot)
+            ->find(optional<capro::IdString_t>(serviceDescription.getServiceIDString()),
+                   optional<capro::IdString_t>(serviceDescription.getInstanceIDString()),
+                   optional<capro::IdString_t>(serviceDescription.getEventIDString()),
+                   [&](const roudi::ServiceRegistry::ServiceDescriptionEntry& entry) { snapshotEntry = entry; });
+    }
+
+    // the capacity is ensured by apply
+    IOX_DISCARD_RESULT(m_overlay.emplace_back(snapshotEntry));
+    return m_overlay.back();
+}
+
+void ServiceRegistryView::add(const capro::ServiceDescription& serviceDescription,
+                              ReferenceCounter_t roudi::ServiceRegistry::ServiceDescriptionEntry::*count) noexcept
+{
+    auto& overlayEntry = acquireOverlayEntry(serviceDescription);
+    if (!overlayEntry.isInView())
+    {
+        // mirrors the SERVICE_REGISTRY_FULL error of RouDi
+        if (m_numberOfEntries >= roudi::ServiceRegistry::CAPACITY)
+        {
+            return;
+        }
+        ++m_numberOfEntries;
+    }
+    ++(overlayEntry.entry.*count);
+}
+
+void ServiceRegistryView::remove(const capro::ServiceDescription& serviceDescription,
+                                 ReferenceCounter_t roudi::ServiceRegistry::ServiceDescriptionEntry::*count) noexcept
+{
+    auto& overlayEntry = acquireOverlayEntry(serviceDescription);
+    if ((overlayEntry.entry.*count) == 0U)
+    {
+        return;
+    }
+
+    --(overlayEntry.entry.*count);
+    if (!overlayEntry.isInView())
+    {
+        --m_numberOfEntries;
+    }
+}
+
+} // namespace runtime
+} // namespace iox
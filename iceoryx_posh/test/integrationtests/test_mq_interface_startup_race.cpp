@@ -100,8 +100,11 @@ class CMqInterfaceStartupRace_test : public Test
         constexpr uint32_t INDEX_OF_TIMESTAMP{4};
         constexpr iox::UntypedRelativePointer::offset_t OFFSET_ADDRESS_HEARTBEAT{
             iox::UntypedRelativePointer::NULL_POINTER_OFFSET};
+        constexpr iox::UntypedRelativePointer::offset_t OFFSET_ADDRESS_REQUEST_CHANNEL{
+            iox::UntypedRelativePointer::NULL_POINTER_OFFSET};
         regAck << IpcMessageTypeToString(IpcMessageType::REG_ACK) << DUMMY_SHM_SIZE << DUMMY_SHM_OFFSET
-               << oldMsg.getElementAtIndex(INDEX_OF_TIMESTAMP) << DUMMY_SEGMENT_ID << OFFSET_ADDRESS_HEARTBEAT;
+               << oldMsg.getElementAtIndex(INDEX_OF_TIMESTAMP) << DUMMY_SEGMENT_ID << OFFSET_ADDRESS_HEARTBEAT
+               << OFFSET_ADDRESS_REQUEST_CHANNEL;
 
         if (!m_appQueue.has_value())
         {
@@ -360,6 +360,49 @@ TEST_F(ServiceDescription_test, TwoServiceDescriptionsWithSameStringsComparedWit
     EXPECT_FALSE(serviceDescription1 != serviceDescription2);
 }
 
+TEST_F(ServiceDescription_test, TwoServiceDescriptionsWithSameStringsHaveTheSameHash)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c5d1e8a2-7b3f-4e96-a0c4-2f8b6d9e1a37");
+    ServiceDescription serviceDescription1("Radar", "FrontLeft", "Objects", {1U, 2U, 3U, 4U});
+    ServiceDescription serviceDescription2("Radar", "FrontLeft", "Objects", {5U, 6U, 7U, 8U}, Interfaces::DDS);
+
+    EXPECT_THAT(serviceDescription1.getHash(), Eq(serviceDescription2.getHash()));
+}
+
+TEST_F(ServiceDescription_test, TwoServiceDescriptionsWithDifferentStringsHaveDifferentHashes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6f2a9c4e-1d8b-4b73-95e0-a7c3d1f8b624");
+    ServiceDescription serviceDescription1("Radar", "FrontLeft", "Objects");
+    ServiceDescription serviceDescription2("Radar", "FrontRight", "Objects");
+
+    EXPECT_THAT(serviceDescription1.getHash(), Ne(serviceDescription2.getHash()));
+}
+
+TEST_F(ServiceDescription_test, HashDistinguishesTheBoundariesBetweenTheStrings)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "45e8a1d7-b3c9-4f02-8e6a-d1c7b5f3a920");
+    ServiceDescription serviceDescription1("ab", "c", "d");
+    ServiceDescription serviceDescription2("a", "bc", "d");
+
+    EXPECT_THAT(serviceDescription1.getHash(), Ne(serviceDescription2.getHash()));
+    EXPECT_FALSE(serviceDescription1 == serviceDescription2);
+}
+
+TEST_F(ServiceDescription_test, DeserializedServiceDescriptionHasTheSameHashAsTheOriginal)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a83d5f1b-2c6e-4f0a-b9d7-4e1c8a3f6b52");
+    ServiceDescription serviceDescription("Radar", "FrontLeft", "Objects");
+
+    ServiceDescription::deserialize(static_cast<iox::Serialization>(serviceDescription))
+        .and_then([&](const auto& service) {
+            EXPECT_THAT(service.getHash(), Eq(serviceDescription.getHash()));
+            EXPECT_TRUE(service == serviceDescription);
+        })
+        .or_else([](const auto& error) {
+            GTEST_FAIL() << "Deserialization should not fail but failed with: " << static_cast<uint32_t>(error);
+        });
+}
+
 TEST_F(ServiceDescription_test, ServiceMatchMethodReturnsTrueIfTheServiceStringIsSame)
 {
     ::testing::Test::RecordProperty("TEST_ID", "47bb698b-bb13-4885-afab-b5a975b67715");
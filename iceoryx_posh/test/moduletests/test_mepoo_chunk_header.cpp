@@ -52,12 +52,14 @@ TEST(ChunkHeader_test, ChunkHeaderHasInitializedMembers)
     EXPECT_THAT(sut.chunkSize(), Eq(CHUNK_SIZE));
 
     // deliberately used a magic number to make the test fail when CHUNK_HEADER_VERSION changes
-    EXPECT_THAT(sut.chunkHeaderVersion(), Eq(2U));
+    EXPECT_THAT(sut.chunkHeaderVersion(), Eq(3U));
 
     EXPECT_THAT(sut.originId(), Eq(iox::popo::UniquePortId(iox::popo::InvalidPortId)));
 
     EXPECT_THAT(sut.sequenceNumber(), Eq(0U));
 
+    EXPECT_THAT(sut.publishTimestamp(), Eq(ChunkHeader::NO_PUBLISH_TIMESTAMP));
+
     EXPECT_THAT(sut.userHeaderId(), Eq(ChunkHeader::NO_USER_HEADER));
     EXPECT_THAT(sut.userHeaderSize(), Eq(0U));
     EXPECT_THAT(sut.userPayloadSize(), Eq(USER_PAYLOAD_SIZE));
@@ -87,11 +89,12 @@ TEST(ChunkHeader_test, ChunkHeaderBinaryCompatibilityCheck)
         uint64_t sequenceNumber{0U};
         uint64_t chunkSize{0U};
         uint64_t userPayloadSize{0U};
+        uint64_t publishTimestamp{0U};
         uint32_t userPayloadAlignment{0U};
         uint32_t userPayloadOffset{0U};
     };
 
-    constexpr auto EXPECTED_CHUNK_HEADER_VERSION{2U};
+    constexpr auto EXPECTED_CHUNK_HEADER_VERSION{3U};
     EXPECT_THAT(ChunkHeader::CHUNK_HEADER_VERSION, Eq(EXPECTED_CHUNK_HEADER_VERSION));
 
     EXPECT_THAT(sizeof(ChunkHeader), Eq(sizeof(ExpectedChunkHeaderLayout)));
@@ -121,6 +124,7 @@ TEST(ChunkHeader_test, ChunkHeaderBinaryCompatibilityCheck)
     IOX_TEST_CHUNK_HEADER_MEMBER_COMPATIBILITY(sequenceNumber);
     IOX_TEST_CHUNK_HEADER_MEMBER_COMPATIBILITY(userHeaderSize);
     IOX_TEST_CHUNK_HEADER_MEMBER_COMPATIBILITY(userPayloadSize);
+    IOX_TEST_CHUNK_HEADER_MEMBER_COMPATIBILITY(publishTimestamp);
     IOX_TEST_CHUNK_HEADER_MEMBER_COMPATIBILITY(userPayloadAlignment);
 
     // special handling for originId since it is a UniquePortId
@@ -26,6 +26,9 @@
 #include "iceoryx_hoofs/testing/fatal_failure.hpp"
 #include "test.hpp"
 
+#include <chrono>
+#include <thread>
+
 namespace
 {
 using namespace ::testing;
@@ -435,6 +438,103 @@ TEST_F(MemoryManager_test, getChunkWithUserPayloadSizeZeroShouldNotFail)
     });
 }
 
+TEST_F(MemoryManager_test, getChunkRecordsTheChunkUtilizationAndTheLoanDuration)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dcf2ed6d-cba3-4597-9a7a-001607a1866a");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint64_t MINIMAL_LOAN_DURATION_IN_NANOSECONDS{1000000U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    {
+        auto chunkStore = getChunksFromSut(1U, chunkSettings_32);
+        std::this_thread::sleep_for(std::chrono::nanoseconds(MINIMAL_LOAN_DURATION_IN_NANOSECONDS));
+    }
+
+    const auto info = sut->getMemPoolInfo(0U);
+    EXPECT_THAT(info.m_numberOfAllocations, Eq(1U));
+    EXPECT_THAT(info.m_numberOfFrees, Eq(1U));
+    if (iox::build::IOX_LATENCY_STATISTICS_FLAG)
+    {
+        // the chunk size of the mempool matches the required chunk size exactly
+        EXPECT_THAT(info.m_chunkUtilization[iox::mepoo::NUMBER_OF_CHUNK_UTILIZATION_BUCKETS - 1U], Eq(1U));
+        EXPECT_THAT(info.m_loanDurationP50InNanoseconds, Ge(MINIMAL_LOAN_DURATION_IN_NANOSECONDS));
+    }
+    else
+    {
+        EXPECT_THAT(info.m_chunkUtilization[iox::mepoo::NUMBER_OF_CHUNK_UTILIZATION_BUCKETS - 1U], Eq(0U));
+        EXPECT_THAT(info.m_loanDurationP50InNanoseconds, Eq(0U));
+    }
+}
+
+TEST_F(MemoryManager_test, getMemPoolIndexReturnsTheMemPoolOfTheChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4d5e2f53-08e5-4e0f-95f1-68c30285b128");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore32 = getChunksFromSut(CHUNK_COUNT, chunkSettings_32);
+    auto chunkStore64 = getChunksFromSut(CHUNK_COUNT, chunkSettings_64);
+
+    for (auto& chunk : chunkStore32)
+    {
+        const auto memPoolIndex = sut->getMemPoolIndex(chunk.getChunkHeader());
+        ASSERT_TRUE(memPoolIndex.has_value());
+        EXPECT_THAT(memPoolIndex.value(), Eq(0U));
+    }
+    for (auto& chunk : chunkStore64)
+    {
+        const auto memPoolIndex = sut->getMemPoolIndex(chunk.getChunkHeader());
+        ASSERT_TRUE(memPoolIndex.has_value());
+        EXPECT_THAT(memPoolIndex.value(), Eq(1U));
+    }
+}
+
+TEST_F(MemoryManager_test, getMemPoolIndexOfForeignMemoryReturnsNullopt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "76a4ec62-1a12-4a68-aa9b-65fe534b6897");
+    mempoolconf.addMemPool({CHUNK_SIZE_32, 10U});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    uint64_t foreignMemory{0U};
+
+    EXPECT_FALSE(sut->getMemPoolIndex(&foreignMemory).has_value());
+}
+
+TEST_F(MemoryManager_test, getMemPoolIndexOfAPointerIntoAChunkReturnsNullopt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a0f524c4-7d7d-4cf4-bafb-64f3c15a6dc4");
+    mempoolconf.addMemPool({CHUNK_SIZE_32, 10U});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(1U, chunkSettings_32);
+
+    EXPECT_FALSE(sut->getMemPoolIndex(static_cast<uint8_t*>(chunkStore[0].getUserPayload()) + 1U).has_value());
+}
+
+TEST_F(MemoryManager_test, containsChunkManagementIsOnlyTrueForTheChunkManagementOfAChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bb54613d-a6f4-4f8d-89fc-a2f256fb7042");
+    mempoolconf.addMemPool({CHUNK_SIZE_32, 10U});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(1U, chunkSettings_32);
+    auto chunkHeader = chunkStore[0].getChunkHeader();
+    auto chunkManagement = chunkStore[0].release();
+    const auto chunkManagementAddress = reinterpret_cast<uint64_t>(chunkManagement);
+    uint64_t foreignMemory{0U};
+
+    EXPECT_TRUE(sut->containsChunkManagement(chunkManagement));
+    EXPECT_FALSE(sut->containsChunkManagement(reinterpret_cast<iox::mepoo::ChunkManagement*>(&foreignMemory)));
+    EXPECT_FALSE(sut->containsChunkManagement(reinterpret_cast<iox::mepoo::ChunkManagement*>(chunkHeader)));
+    EXPECT_FALSE(sut->containsChunkManagement(
+        reinterpret_cast<iox::mepoo::ChunkManagement*>(chunkManagementAddress + sizeof(uint64_t))));
+
+    chunkStore[0] = iox::mepoo::SharedChunk(chunkManagement);
+}
+
 TEST_F(MemoryManager_test, addMemPoolWithChunkCountZeroShouldFail)
 {
     ::testing::Test::RecordProperty("TEST_ID", "be653b65-a2d1-42eb-98b5-d161c6ba7c08");
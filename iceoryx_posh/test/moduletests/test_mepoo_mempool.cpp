@@ -293,6 +293,71 @@ TEST_F(MemPool_test, GetMinFreeMethodReturnsTheNumberOfFreeChunks)
     }
 }
 
+TEST_F(MemPool_test, GetInfoReturnsTheNumberOfAllocationsAndFrees)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "691e9ce7-d028-47c6-9878-2f6254bccc53");
+    constexpr uint32_t NUMBER_OF_ALLOCATIONS{3U};
+    std::vector<void*> chunks;
+    for (uint32_t i = 0U; i < NUMBER_OF_ALLOCATIONS; ++i)
+    {
+        chunks.push_back(sut.getChunk());
+    }
+    sut.freeChunk(chunks.back());
+
+    const auto info = sut.getInfo();
+    EXPECT_THAT(info.m_numberOfAllocations, Eq(NUMBER_OF_ALLOCATIONS));
+    EXPECT_THAT(info.m_numberOfFrees, Eq(1U));
+    EXPECT_THAT(info.m_numberOfFailedAllocations, Eq(0U));
+}
+
+TEST_F(MemPool_test, GetInfoReturnsTheNumberOfFailedAllocations)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5cc05a8b-c732-4388-9b23-ce55d55066a3");
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        ASSERT_THAT(sut.getChunk(), Ne(nullptr));
+    }
+
+    EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+
+    const auto info = sut.getInfo();
+    EXPECT_THAT(info.m_numberOfAllocations, Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(info.m_numberOfFailedAllocations, Eq(1U));
+}
+
+TEST_F(MemPool_test, RecordChunkUtilizationCountsTheAllocationInTheBucketOfTheRequiredChunkSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4f5ff59d-0d9a-4339-a8e0-12ac2301bf6a");
+    constexpr uint64_t BUCKET_SIZE{CHUNK_SIZE / iox::mepoo::NUMBER_OF_CHUNK_UTILIZATION_BUCKETS};
+
+    sut.recordChunkUtilization(BUCKET_SIZE);
+    sut.recordChunkUtilization(BUCKET_SIZE + 1U);
+    sut.recordChunkUtilization(CHUNK_SIZE);
+    sut.recordChunkUtilization(CHUNK_SIZE);
+
+    const auto info = sut.getInfo();
+    EXPECT_THAT(info.m_chunkUtilization[0U], Eq(1U));
+    EXPECT_THAT(info.m_chunkUtilization[1U], Eq(1U));
+    EXPECT_THAT(info.m_chunkUtilization[iox::mepoo::NUMBER_OF_CHUNK_UTILIZATION_BUCKETS - 1U], Eq(2U));
+}
+
+TEST_F(MemPool_test, GetInfoReturnsThePercentilesOfTheRecordedLoanDurations)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1b7828d1-3746-4e05-8760-43432eef8790");
+    constexpr uint64_t SHORT_LOAN_DURATION{2U};
+    constexpr uint64_t LONG_LOAN_DURATION{3U};
+    for (uint32_t i = 0U; i < 99U; ++i)
+    {
+        sut.recordLoanDuration(SHORT_LOAN_DURATION);
+    }
+    sut.recordLoanDuration(LONG_LOAN_DURATION);
+    sut.recordLoanDuration(LONG_LOAN_DURATION);
+
+    const auto info = sut.getInfo();
+    EXPECT_THAT(info.m_loanDurationP50InNanoseconds, Eq(SHORT_LOAN_DURATION));
+    EXPECT_THAT(info.m_loanDurationP99InNanoseconds, Eq(LONG_LOAN_DURATION));
+}
+
 TEST_F(MemPool_test, dieWhenMempoolChunkSizeIsSmallerThan32Bytes)
 {
     ::testing::Test::RecordProperty("TEST_ID", "7704246e-42b5-46fd-8827-ebac200390e1");
@@ -255,6 +255,22 @@ TEST_F(IpcMessage_test, getElementAtIndex)
     EXPECT_THAT(message2.getElementAtIndex(2), Eq("13"));
 }
 
+TEST_F(IpcMessage_test, getElementAtIndexOfMessageCreatedFromString)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6b0e3f85-1c47-4d92-a8f6-d25e90c7b314");
+    IpcMessage sut("fuu,,bar,");
+
+    ASSERT_THAT(sut.getNumberOfElements(), Eq(3U));
+    EXPECT_THAT(sut.getElementAtIndex(0), Eq("fuu"));
+    EXPECT_THAT(sut.getElementAtIndex(1), Eq(""));
+    EXPECT_THAT(sut.getElementAtIndex(2), Eq("bar"));
+    EXPECT_THAT(sut.getElementAtIndex(3), Eq(""));
+
+    sut.addEntry(-42);
+    EXPECT_THAT(sut.getElementAtIndex(3), Eq("-42"));
+    EXPECT_THAT(sut.getMessage(), Eq("fuu,,bar,-42,"));
+}
+
 TEST_F(IpcMessage_test, isValidEntry)
 {
     ::testing::Test::RecordProperty("TEST_ID", "8b09e0ca-66b4-40ca-9449-2ae9e79eb48e");
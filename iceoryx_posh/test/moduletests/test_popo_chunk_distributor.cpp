@@ -600,6 +600,32 @@ TYPED_TEST(ChunkDistributor_test, DeliverToQueueWithMoreChunksThanCapacityLeadsT
     ASSERT_TRUE(queue.hasLostChunks());
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverToQueueWithMoreChunksThanCapacityIncreasesTheLossCounters)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7cfd9d2e-cc10-4a60-9766-8909af77d8ed");
+    constexpr uint32_t EXPECTED_QUEUE_INDEX{0U};
+    constexpr uint64_t NUMBER_OF_LOST_CHUNKS{3U};
+    using ChunkQueueData_t = typename TestFixture::ChunkQueueData_t;
+
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    for (uint64_t i = 0; i < ChunkQueueData_t::MAX_CAPACITY + NUMBER_OF_LOST_CHUNKS; ++i)
+    {
+        auto chunk = this->allocateChunk(i);
+        ASSERT_FALSE(sut.deliverToQueue(queueData->m_uniqueId, EXPECTED_QUEUE_INDEX, chunk).has_error());
+    }
+
+    // unlike the lost chunks flag, the counter is not reset by reading it
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    EXPECT_TRUE(queue.hasLostChunks());
+    EXPECT_THAT(queueData->m_numberOfLostChunks.load(), Eq(NUMBER_OF_LOST_CHUNKS));
+    EXPECT_THAT(sutData->m_numberOfQueueOverflows.load(), Eq(NUMBER_OF_LOST_CHUNKS));
+}
+
 TYPED_TEST(ChunkDistributor_test, DeliverToQueueWithBlockingOptionBlocksDelivery)
 {
     ::testing::Test::RecordProperty("TEST_ID", "9f594607-215e-4db5-bdae-433c185dbbcd");
@@ -723,6 +749,26 @@ TYPED_TEST(ChunkDistributor_test, DeliverHistoryOnAddWithMoreThanAvailable)
     EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(3u));
 }
 
+TYPED_TEST(ChunkDistributor_test, ForEachChunkInHistoryIsCalledForAllChunksInTheHistory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e3890fb5-d3bd-4bcf-b0c4-4e41927e7e1c");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    std::vector<const ChunkHeader*> chunkHeaderInHistory;
+    for (uint64_t i = 0U; i < 3U; ++i)
+    {
+        auto chunk = this->allocateChunk(i);
+        chunkHeaderInHistory.push_back(chunk.getChunkHeader());
+        sut.deliverToAllStoredQueues(chunk);
+    }
+
+    std::vector<const ChunkHeader*> visitedChunkHeader;
+    sut.forEachChunkInHistory([&](const ChunkHeader* chunkHeader) { visitedChunkHeader.push_back(chunkHeader); });
+
+    EXPECT_THAT(visitedChunkHeader, ElementsAreArray(chunkHeaderInHistory));
+}
+
 TYPED_TEST(ChunkDistributor_test, DeliverToSingleQueueBlocksWhenOptionsAreSetToBlocking)
 {
     ::testing::Test::RecordProperty("TEST_ID", "c0500dec-bbd8-4958-9545-a14ef68108a1");
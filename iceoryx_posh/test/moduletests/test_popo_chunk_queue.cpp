@@ -181,6 +181,24 @@ TYPED_TEST(ChunkQueue_test, PushedChunksMustBePoppedInTheSameOrder)
     }
 }
 
+TYPED_TEST(ChunkQueue_test, HighWaterMarkIsTheMaximumNumberOfQueuedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2dc18417-dce8-4d90-8b59-8842decbd6de");
+    constexpr uint64_t NUMBER_CHUNKS{3U};
+    for (uint64_t i = 0U; i < NUMBER_CHUNKS; ++i)
+    {
+        this->m_pusher.push(this->allocateChunk());
+    }
+    EXPECT_THAT(this->m_chunkData.m_queueHighWaterMark.load(), Eq(NUMBER_CHUNKS));
+
+    IOX_DISCARD_RESULT(this->m_popper.tryPop());
+    IOX_DISCARD_RESULT(this->m_popper.tryPop());
+    this->m_pusher.push(this->allocateChunk());
+
+    EXPECT_THAT(this->m_popper.size(), Eq(NUMBER_CHUNKS - 1U));
+    EXPECT_THAT(this->m_chunkData.m_queueHighWaterMark.load(), Eq(NUMBER_CHUNKS));
+}
+
 TYPED_TEST(ChunkQueue_test, PopChunkWithIncompatibleChunkHeaderCallsErrorHandler)
 {
     ::testing::Test::RecordProperty("TEST_ID", "597f1da3-6f64-4254-9e41-0c4776746a14");
@@ -411,4 +429,14 @@ TYPED_TEST(ChunkQueueSoFi_test, LostChunkInfoIsResetAfterRead)
     EXPECT_FALSE(this->m_popper.hasLostChunks());
 }
 
+TYPED_TEST(ChunkQueueSoFi_test, LostChunkCounterIsNotResetAfterRead)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5131a13c-a1d0-4515-a00a-7362029e3994");
+    this->m_pusher.lostAChunk();
+    this->m_pusher.lostAChunk();
+    this->m_popper.hasLostChunks();
+
+    EXPECT_THAT(this->m_chunkData.m_numberOfLostChunks.load(), Eq(2U));
+}
+
 } // namespace
@@ -299,6 +299,54 @@ TEST_F(ChunkSender_test, sendWithoutReceiver)
     }
 }
 
+TEST_F(ChunkSender_test, sendSetsThePublishTimestamp)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1426c3e8-dac1-467e-abeb-08b9b427d680");
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                      sizeof(DummySample),
+                                                      alignof(DummySample),
+                                                      USER_HEADER_SIZE,
+                                                      USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    auto chunkHeader = maybeChunkHeader.value();
+    EXPECT_THAT(chunkHeader->publishTimestamp(), Eq(iox::mepoo::ChunkHeader::NO_PUBLISH_TIMESTAMP));
+
+    const auto timeBeforeSend = iox::mepoo::ChunkHeader::currentPublishTime();
+    m_chunkSender.send(chunkHeader);
+    const auto timeAfterSend = iox::mepoo::ChunkHeader::currentPublishTime();
+
+    if (iox::build::IOX_LATENCY_STATISTICS_FLAG)
+    {
+        EXPECT_THAT(chunkHeader->publishTimestamp(), Ge(timeBeforeSend));
+        EXPECT_THAT(chunkHeader->publishTimestamp(), Le(timeAfterSend));
+    }
+    else
+    {
+        EXPECT_THAT(chunkHeader->publishTimestamp(), Eq(iox::mepoo::ChunkHeader::NO_PUBLISH_TIMESTAMP));
+    }
+}
+
+TEST_F(ChunkSender_test, addQueueWithHistoryStoresTheNewestHistoryPublishTimestampInTheQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5e3a9c71-8d2b-4f60-a4e7-1c9b6d3f0a58");
+    uint64_t newestPublishTimestamp{iox::mepoo::ChunkHeader::NO_PUBLISH_TIMESTAMP};
+    for (uint64_t i = 0U; i < HISTORY_CAPACITY; ++i)
+    {
+        auto maybeChunkHeader = m_chunkSenderWithHistory.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                                     sizeof(DummySample),
+                                                                     alignof(DummySample),
+                                                                     USER_HEADER_SIZE,
+                                                                     USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        m_chunkSenderWithHistory.send(*maybeChunkHeader);
+        newestPublishTimestamp = (*maybeChunkHeader)->publishTimestamp();
+    }
+
+    ASSERT_FALSE(m_chunkSenderWithHistory.tryAddQueue(&m_chunkQueueData, HISTORY_CAPACITY).has_error());
+
+    EXPECT_THAT(m_chunkQueueData.m_newestHistoryPublishTimestamp.load(), Eq(newestPublishTimestamp));
+}
+
 TEST_F(ChunkSender_test, sendMultipleWithoutReceiverAndAlwaysLast)
 {
     ::testing::Test::RecordProperty("TEST_ID", "a5b798e6-5163-460b-a2d6-cce5592d3c04");
@@ -135,10 +135,11 @@ TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstruction)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4e5f6dbc-84cc-468a-9d64-f5ed88012ebc");
     ConditionVariableData sut;
-    for (auto& notification : sut.m_activeNotifications)
+    for (auto& notifierSlot : sut.m_notifierSlots)
     {
-        EXPECT_THAT(notification, Eq(false));
+        EXPECT_THAT(notifierSlot.m_isActive, Eq(false));
     }
+    EXPECT_FALSE(sut.hasActiveNotifications());
 }
 
 TEST_F(ConditionVariable_test, CorrectRuntimeNameAfterConstructionWithRuntimeName)
@@ -150,10 +151,11 @@ TEST_F(ConditionVariable_test, CorrectRuntimeNameAfterConstructionWithRuntimeNam
 TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstructionWithRuntimeName)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4825e152-08e3-414e-a34f-d93d048f84b8");
-    for (auto& notification : m_condVarData.m_activeNotifications)
+    for (auto& notifierSlot : m_condVarData.m_notifierSlots)
     {
-        EXPECT_THAT(notification, Eq(false));
+        EXPECT_THAT(notifierSlot.m_isActive, Eq(false));
     }
+    EXPECT_FALSE(m_condVarData.hasActiveNotifications());
 }
 
 TEST_F(ConditionVariable_test, NotifyActivatesCorrectIndex)
@@ -166,15 +168,55 @@ TEST_F(ConditionVariable_test, NotifyActivatesCorrectIndex)
     {
         if (i == EVENT_INDEX)
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i], Eq(true));
+            EXPECT_THAT(m_condVarData.m_notifierSlots[i].m_isActive, Eq(true));
         }
         else
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i], Eq(false));
+            EXPECT_THAT(m_condVarData.m_notifierSlots[i].m_isActive, Eq(false));
         }
     }
 }
 
+TEST_F(ConditionVariable_test, NotifierSlotsDoNotShareCacheLines)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "53ed921b-ae3b-44e2-8e44-7417640f795b");
+    EXPECT_THAT(alignof(ConditionVariableData::NotifierSlot), Eq(ConditionVariableData::CACHE_LINE_SIZE));
+    EXPECT_THAT(sizeof(ConditionVariableData::NotifierSlot), Eq(ConditionVariableData::CACHE_LINE_SIZE));
+}
+
+TEST_F(ConditionVariable_test, RepeatedNotificationIsCoalescedUntilItIsCollected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b40fca36-b3cb-4cfe-8ba5-b6164e31116d");
+    constexpr uint64_t EVENT_INDEX{42U};
+    EXPECT_TRUE(m_condVarData.activateNotification(EVENT_INDEX));
+    EXPECT_FALSE(m_condVarData.activateNotification(EVENT_INDEX));
+
+    auto notifications = m_waiter.timedWait(m_timeToWait);
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_THAT(notifications[0U], Eq(EVENT_INDEX));
+    EXPECT_FALSE(m_condVarData.hasActiveNotifications());
+
+    EXPECT_TRUE(m_condVarData.activateNotification(EVENT_INDEX));
+}
+
+TEST_F(ConditionVariable_test, NotificationsOfDifferentBitmapWordsAreCollectedInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e16b4e07-e51b-4a84-af17-b3ee4992424f");
+    const std::vector<uint64_t> indices{iox::MAX_NUMBER_OF_NOTIFIERS - 1U, 3U, 64U, 63U};
+    for (const auto index : indices)
+    {
+        m_notifiers[index].notify();
+    }
+
+    auto notifications = m_waiter.wait();
+
+    ASSERT_THAT(notifications.size(), Eq(indices.size()));
+    EXPECT_THAT(notifications[0U], Eq(3U));
+    EXPECT_THAT(notifications[1U], Eq(63U));
+    EXPECT_THAT(notifications[2U], Eq(64U));
+    EXPECT_THAT(notifications[3U], Eq(iox::MAX_NUMBER_OF_NOTIFIERS - 1U));
+}
+
 TEST_F(ConditionVariable_test, TimedWaitWithZeroTimeoutWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "582f0b1c-c717-410e-8143-61459db672ad");
@@ -420,9 +462,9 @@ TIMING_TEST_F(ConditionVariable_test, SecondWaitBlocksUntilNewNotification, Repe
         hasWaited.store(true, std::memory_order_relaxed);
         ASSERT_THAT(activeNotifications.size(), Eq(1U));
         EXPECT_THAT(activeNotifications[0], Eq(FIRST_EVENT_INDEX));
-        for (const auto& notification : m_condVarData.m_activeNotifications)
+        for (const auto& notifierSlot : m_condVarData.m_notifierSlots)
         {
-            EXPECT_THAT(notification, Eq(false));
+            EXPECT_THAT(notifierSlot.m_isActive, Eq(false));
         }
     });
 
@@ -0,0 +1,123 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier.hpp"
+#include "test.hpp"
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+
+class DiscoveryNotifier_test : public Test
+{
+  public:
+    static constexpr uint64_t CAPACITY{130U};
+
+    std::vector<uint64_t> consumeDirtyPorts()
+    {
+        std::vector<uint64_t> dirtyPorts;
+        m_dirtyPorts.consume([&](const uint64_t index) { dirtyPorts.push_back(index); });
+        return dirtyPorts;
+    }
+
+    ConditionVariableData m_condVarData{"Hypnotoad"};
+    ConditionListener m_listener{m_condVarData};
+    DirtyPortBitmap<CAPACITY> m_dirtyPorts;
+    DiscoveryNotifier m_sut;
+};
+
+TEST_F(DiscoveryNotifier_test, NotifierIsNotAttachedAfterConstruction)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3e4bb83e-8338-4ee6-b80e-b09c7572b1be");
+    EXPECT_FALSE(m_sut.isAttached());
+}
+
+TEST_F(DiscoveryNotifier_test, NotifyWithoutBeingAttachedDoesNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b8d0fed1-51a8-434c-9d15-2b585fa1f45a");
+    m_sut.notify();
+
+    EXPECT_FALSE(m_listener.wasNotified());
+}
+
+TEST_F(DiscoveryNotifier_test, NotifyMarksThePortAndWakesUpTheDiscoveryLoop)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a2d395cb-2a48-40c4-a2b6-fa4d4493ba34");
+    constexpr uint64_t PORT_INDEX{73U};
+    m_sut.attach(m_condVarData, DiscoveryNotificationOrigin::SUBSCRIBER_PORT, m_dirtyPorts, PORT_INDEX);
+    ASSERT_TRUE(m_sut.isAttached());
+
+    m_sut.notify();
+
+    auto notifications = m_listener.tryWait();
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_THAT(notifications[0U], Eq(static_cast<uint64_t>(DiscoveryNotificationOrigin::SUBSCRIBER_PORT)));
+    EXPECT_THAT(consumeDirtyPorts(), ElementsAre(PORT_INDEX));
+}
+
+TEST_F(DiscoveryNotifier_test, NotifyOfNotifierWithoutDirtyPortBitmapOnlyWakesUpTheDiscoveryLoop)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b2da54db-d376-48c9-903c-0b375c413176");
+    m_sut.attach(m_condVarData, DiscoveryNotificationOrigin::INTERFACE_PORT);
+
+    m_sut.notify();
+
+    auto notifications = m_listener.tryWait();
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_THAT(notifications[0U], Eq(static_cast<uint64_t>(DiscoveryNotificationOrigin::INTERFACE_PORT)));
+    EXPECT_TRUE(consumeDirtyPorts().empty());
+}
+
+TEST_F(DiscoveryNotifier_test, MultipleNotificationsOfTheSamePortAreConsumedOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1c20f1b5-674d-4ce2-8ee3-cbf72f0b8d42");
+    m_sut.attach(m_condVarData, DiscoveryNotificationOrigin::PUBLISHER_PORT, m_dirtyPorts, 0U);
+
+    m_sut.notify();
+    m_sut.notify();
+    m_sut.notify();
+
+    EXPECT_THAT(m_listener.tryWait().size(), Eq(1U));
+    EXPECT_THAT(consumeDirtyPorts(), ElementsAre(0U));
+}
+
+TEST_F(DiscoveryNotifier_test, ConsumeReturnsTheMarkedPortsInAscendingOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e3631c97-a2dc-463d-89a6-7a14e33d2aa7");
+    m_dirtyPorts.mark(CAPACITY - 1U);
+    m_dirtyPorts.mark(64U);
+    m_dirtyPorts.mark(63U);
+    m_dirtyPorts.mark(0U);
+
+    EXPECT_THAT(consumeDirtyPorts(), ElementsAre(0U, 63U, 64U, CAPACITY - 1U));
+}
+
+TEST_F(DiscoveryNotifier_test, ConsumeClearsTheMarks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "55de2afc-a0d5-4661-b603-64d4a1d6b2ad");
+    m_dirtyPorts.mark(42U);
+
+    consumeDirtyPorts();
+
+    EXPECT_TRUE(consumeDirtyPorts().empty());
+}
+
+} // namespace
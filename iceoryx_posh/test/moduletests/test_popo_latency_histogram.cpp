@@ -0,0 +1,112 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
+#include "test.hpp"
+
+#include <limits>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+
+class LatencyHistogram_test : public Test
+{
+  public:
+    LatencyHistogram sut;
+};
+
+TEST_F(LatencyHistogram_test, EmptyHistogramHasNoPercentiles)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d91c9cad-6c67-4eea-b7f1-c0df8340dc0a");
+    EXPECT_THAT(sut.count(), Eq(0U));
+    EXPECT_THAT(sut.percentile(0.5), Eq(0U));
+    EXPECT_THAT(sut.percentile(0.999), Eq(0U));
+}
+
+TEST_F(LatencyHistogram_test, SmallValuesAreCountedExactly)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3b5cc2f2-696f-4993-ad39-63fc516839e3");
+    for (uint64_t i = 0U; i < LatencyHistogram::SUB_BUCKETS; ++i)
+    {
+        EXPECT_THAT(LatencyHistogram::bucketIndex(i), Eq(i));
+        EXPECT_THAT(LatencyHistogram::bucketUpperBound(i), Eq(i));
+    }
+}
+
+TEST_F(LatencyHistogram_test, EveryValueIsCountedInTheBucketWhichCoversIt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fc6eb0b6-7e0f-4ac8-863d-b1b82e7a6665");
+    for (uint64_t value : {4U, 5U, 7U, 8U, 9U, 15U, 16U, 1000U, 123456U, 987654321U})
+    {
+        const auto index = LatencyHistogram::bucketIndex(value);
+        ASSERT_THAT(index, Gt(0U));
+        EXPECT_THAT(LatencyHistogram::bucketUpperBound(index), Ge(value));
+        EXPECT_THAT(LatencyHistogram::bucketUpperBound(index - 1U), Lt(value));
+    }
+}
+
+TEST_F(LatencyHistogram_test, RelativeErrorIsBoundedBySubBuckets)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c7f071a8-206d-4230-a859-d1b66e7d535a");
+    for (uint64_t value = 100U; value < 100000000U; value = value * 3U + 1U)
+    {
+        const auto upperBound = LatencyHistogram::bucketUpperBound(LatencyHistogram::bucketIndex(value));
+        EXPECT_THAT(upperBound - value, Le(value / LatencyHistogram::SUB_BUCKETS));
+    }
+}
+
+TEST_F(LatencyHistogram_test, ValuesOutOfRangeAreCountedInTheLastBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4717b961-e2e7-41d3-b04f-b995a22e0add");
+    EXPECT_THAT(LatencyHistogram::bucketIndex(std::numeric_limits<uint64_t>::max()),
+                Eq(LatencyHistogram::NUMBER_OF_BUCKETS - 1U));
+    EXPECT_THAT(LatencyHistogram::bucketUpperBound(LatencyHistogram::NUMBER_OF_BUCKETS - 1U),
+                Eq(std::numeric_limits<uint64_t>::max()));
+}
+
+TEST_F(LatencyHistogram_test, PercentilesAreTheUpperBoundsOfTheBuckets)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b7d978ca-5f99-43ef-86f7-ecf80066fe48");
+    constexpr uint64_t FAST{2U};
+    constexpr uint64_t SLOW{1000U};
+    for (uint64_t i = 0U; i < 990U; ++i)
+    {
+        sut.record(FAST);
+    }
+    for (uint64_t i = 0U; i < 10U; ++i)
+    {
+        sut.record(SLOW);
+    }
+
+    EXPECT_THAT(sut.count(), Eq(1000U));
+    EXPECT_THAT(sut.percentile(0.5), Eq(FAST));
+    EXPECT_THAT(sut.percentile(0.99), Eq(FAST));
+    EXPECT_THAT(sut.percentile(0.999), Eq(LatencyHistogram::bucketUpperBound(LatencyHistogram::bucketIndex(SLOW))));
+}
+
+TEST_F(LatencyHistogram_test, PercentileFractionIsClamped)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c9dbadc7-744d-4d58-acf4-19b7e9ba5096");
+    sut.record(1U);
+    sut.record(3U);
+
+    EXPECT_THAT(sut.percentile(-1.0), Eq(1U));
+    EXPECT_THAT(sut.percentile(2.0), Eq(3U));
+}
+
+} // namespace
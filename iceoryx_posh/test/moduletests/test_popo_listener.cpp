@@ -139,6 +139,16 @@ class TestListener : public Listener
     }
 };
 
+constexpr uint64_t SMALL_LISTENER_CAPACITY{4U};
+class SmallTestListener : public ListenerImpl<SMALL_LISTENER_CAPACITY>
+{
+  public:
+    SmallTestListener(ConditionVariableData& data) noexcept
+        : ListenerImpl(data)
+    {
+    }
+};
+
 struct EventAndSutPair_t
 {
     SimpleEventClass* object;
@@ -156,6 +166,8 @@ iox::concurrent::smart_lock<std::vector<EventAndSutPair_t>> g_toBeDetached;
 std::array<TriggerSourceAndCount, iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER> g_triggerCallbackArg;
 uint64_t g_triggerCallbackRuntimeInMs = 0U;
 iox::optional<iox::UnnamedSemaphore> g_callbackBlocker;
+iox::concurrent::smart_lock<std::vector<uint64_t>> g_executionOrder;
+SimpleEventClass* g_eventToTriggerInCallback = nullptr;
 
 class Listener_test : public Test
 {
@@ -173,6 +185,35 @@ class Listener_test : public Test
         std::this_thread::sleep_for(std::chrono::milliseconds(g_triggerCallbackRuntimeInMs));
     }
 
+    template <uint64_t N>
+    static void recordExecutionOrderCallback(SimpleEventClass* const) noexcept
+    {
+        g_executionOrder->push_back(N);
+    }
+
+    template <uint64_t N>
+    static void recordExecutionOrderAndTriggerCallback(SimpleEventClass* const) noexcept
+    {
+        g_executionOrder->push_back(N);
+        g_eventToTriggerInCallback->triggerNoEventType();
+    }
+
+    void waitForExecutedCallbacks(const uint64_t numberOfCallbacks) noexcept
+    {
+        while (g_executionOrder->size() < numberOfCallbacks)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1U));
+        }
+    }
+
+    void waitUntilBlockedInCallback() noexcept
+    {
+        while (g_triggerCallbackArg[0U].m_count.load() == 0U)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1U));
+        }
+    }
+
     static void triggerCallbackWithUserType(SimpleEventClass* const event, uint64_t* userType) noexcept
     {
         g_triggerCallbackArg[0].m_source = event;
@@ -222,6 +263,8 @@ class Listener_test : public Test
         g_triggerCallbackRuntimeInMs = 0U;
         g_toBeAttached->clear();
         g_toBeDetached->clear();
+        g_executionOrder->clear();
+        g_eventToTriggerInCallback = nullptr;
     };
 
     void activateTriggerCallbackBlocker() noexcept
@@ -326,6 +369,48 @@ TEST_F(Listener_test, CapacityIsEqualToMAX_NUMBER_OF_EVENTS_PER_LISTENER)
     EXPECT_THAT(m_sut->capacity(), Eq(iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER));
 }
 
+TEST_F(Listener_test, CapacityIsEqualToTemplateArgument)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "581f38f0-ed7a-4a0e-9047-573fac2a3e7c");
+    ConditionVariableData condVarData{"Zoidberg"};
+    SmallTestListener sut{condVarData};
+
+    EXPECT_THAT(sut.capacity(), Eq(SMALL_LISTENER_CAPACITY));
+    EXPECT_THAT(sizeof(SmallTestListener), Lt(sizeof(TestListener)));
+}
+
+TEST_F(Listener_test, ListenerWithSmallCapacityIsFullAfterAttachingCapacityEvents)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3ab7dc16-d466-4bb7-8bdb-3bcbe12560cb");
+    ConditionVariableData condVarData{"Zoidberg"};
+    SmallTestListener sut{condVarData};
+
+    for (uint64_t i = 0U; i < SMALL_LISTENER_CAPACITY; ++i)
+    {
+        EXPECT_FALSE(sut.attachEvent(m_simpleEvents[i], createNotificationCallback(triggerCallback<0U>)).has_error());
+    }
+    auto result =
+        sut.attachEvent(m_simpleEvents[SMALL_LISTENER_CAPACITY], createNotificationCallback(triggerCallback<0U>));
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(ListenerError::LISTENER_FULL));
+    EXPECT_THAT(sut.size(), Eq(SMALL_LISTENER_CAPACITY));
+}
+
+TEST_F(Listener_test, ListenerWithSmallCapacityExecutesCallbacks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9ed44895-aa17-44c0-81cd-790d15fa413b");
+    ConditionVariableData condVarData{"Zoidberg"};
+    SmallTestListener sut{condVarData};
+    ASSERT_FALSE(
+        sut.attachEvent(m_simpleEvents[0U], createNotificationCallback(recordExecutionOrderCallback<0U>)).has_error());
+
+    m_simpleEvents[0U].triggerNoEventType();
+
+    waitForExecutedCallbacks(1U);
+    EXPECT_THAT(g_executionOrder.get_copy(), ElementsAre(0U));
+}
+
 TEST_F(Listener_test, IsEmptyWhenConstructed)
 {
     ::testing::Test::RecordProperty("TEST_ID", "9d0e1023-a8bf-42b5-a03e-c3ea764fd934");
@@ -1237,4 +1322,101 @@ TIMING_TEST_F(Listener_test, AttachingInCallbackWorks, Repeat(5), [&] {
 // END
 //////////////////////////////////
 
+//////////////////////////////////
+// BEGIN priorities
+//////////////////////////////////
+TEST_F(Listener_test, CallbacksOfEventsWithHigherPriorityAreExecutedFirst)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "15b96cd9-1edb-4232-be29-8db4ba8c339e");
+    activateTriggerCallbackBlocker();
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0U], createNotificationCallback(triggerCallback<0U>)).has_error());
+    ASSERT_FALSE(
+        m_sut->attachEvent(m_simpleEvents[1U], createNotificationCallback(recordExecutionOrderCallback<1U>), 1U)
+            .has_error());
+    ASSERT_FALSE(
+        m_sut->attachEvent(m_simpleEvents[2U], createNotificationCallback(recordExecutionOrderCallback<2U>), 5U)
+            .has_error());
+    ASSERT_FALSE(
+        m_sut->attachEvent(m_simpleEvents[3U], createNotificationCallback(recordExecutionOrderCallback<3U>), 5U)
+            .has_error());
+
+    // block the listener thread so that all following events are collected in one batch
+    m_simpleEvents[0U].triggerNoEventType();
+    waitUntilBlockedInCallback();
+    m_simpleEvents[1U].triggerNoEventType();
+    m_simpleEvents[2U].triggerNoEventType();
+    m_simpleEvents[3U].triggerNoEventType();
+    unblockTriggerCallback(1U);
+
+    waitForExecutedCallbacks(3U);
+    EXPECT_THAT(g_executionOrder.get_copy(), ElementsAre(2U, 3U, 1U));
+}
+
+TEST_F(Listener_test, EventsWithDefaultPriorityAreExecutedInOrderOfAttachment)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c392d116-9bee-4cdd-a810-2a6569740810");
+    activateTriggerCallbackBlocker();
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0U], createNotificationCallback(triggerCallback<0U>)).has_error());
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[1U], createNotificationCallback(recordExecutionOrderCallback<1U>))
+                     .has_error());
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[2U], createNotificationCallback(recordExecutionOrderCallback<2U>))
+                     .has_error());
+
+    m_simpleEvents[0U].triggerNoEventType();
+    waitUntilBlockedInCallback();
+    m_simpleEvents[2U].triggerNoEventType();
+    m_simpleEvents[1U].triggerNoEventType();
+    unblockTriggerCallback(1U);
+
+    waitForExecutedCallbacks(2U);
+    EXPECT_THAT(g_executionOrder.get_copy(), ElementsAre(1U, 2U));
+}
+
+TEST_F(Listener_test, HighPriorityEventWhichFiresDuringBatchIsExecutedBeforeRemainingLowPriorityEvents)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0adbe349-addb-4dd6-ae82-782cced30c74");
+    activateTriggerCallbackBlocker();
+    g_eventToTriggerInCallback = &m_simpleEvents[3U];
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0U], createNotificationCallback(triggerCallback<0U>)).has_error());
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(m_simpleEvents[1U],
+                                   createNotificationCallback(recordExecutionOrderAndTriggerCallback<1U>),
+                                   1U)
+                     .has_error());
+    ASSERT_FALSE(
+        m_sut->attachEvent(m_simpleEvents[2U], createNotificationCallback(recordExecutionOrderCallback<2U>), 1U)
+            .has_error());
+    ASSERT_FALSE(
+        m_sut->attachEvent(m_simpleEvents[3U], createNotificationCallback(recordExecutionOrderCallback<3U>), 9U)
+            .has_error());
+
+    m_simpleEvents[0U].triggerNoEventType();
+    waitUntilBlockedInCallback();
+    m_simpleEvents[1U].triggerNoEventType();
+    m_simpleEvents[2U].triggerNoEventType();
+    unblockTriggerCallback(1U);
+
+    waitForExecutedCallbacks(3U);
+    EXPECT_THAT(g_executionOrder.get_copy(), ElementsAre(1U, 3U, 2U));
+}
+
+TEST_F(Listener_test, DetachingPrioritizedEventAndAttachingItAgainWithDefaultPriorityWorks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b252be2d-62ff-40c2-844c-eda12110c1ec");
+    ASSERT_FALSE(
+        m_sut->attachEvent(m_simpleEvents[0U], createNotificationCallback(recordExecutionOrderCallback<0U>), 7U)
+            .has_error());
+    m_sut->detachEvent(m_simpleEvents[0U]);
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0U], createNotificationCallback(recordExecutionOrderCallback<0U>))
+                     .has_error());
+
+    m_simpleEvents[0U].triggerNoEventType();
+
+    waitForExecutedCallbacks(1U);
+    EXPECT_THAT(g_executionOrder.get_copy(), ElementsAre(0U));
+}
+//////////////////////////////////
+// END
+//////////////////////////////////
+
 } // namespace
@@ -228,7 +228,14 @@ TEST_F(ListenerWaitsetAttachments_test, ServiceDiscoveryDestructorCallsTriggerRe
                                       roudi::DEFAULT_UNIQUE_ROUDI_ID,
                                       VariantQueueTypes::SoFi_MultiProducerSingleConsumer,
                                       SubscriberOptions());
-    EXPECT_CALL(*this->runtimeMock, getMiddlewareSubscriber(_, _, _)).WillOnce(Return(&subscriberData));
+    SubscriberPortData deltaSubscriberData({SERVICE, INSTANCE, EVENT},
+                                           RUNTIME_NAME,
+                                           roudi::DEFAULT_UNIQUE_ROUDI_ID,
+                                           VariantQueueTypes::SoFi_MultiProducerSingleConsumer,
+                                           SubscriberOptions());
+    EXPECT_CALL(*this->runtimeMock, getMiddlewareSubscriber(_, _, _))
+        .WillOnce(Return(&subscriberData))
+        .WillOnce(Return(&deltaSubscriberData));
 
     optional<iox::runtime::ServiceDiscovery> serviceDiscovery;
     serviceDiscovery.emplace();
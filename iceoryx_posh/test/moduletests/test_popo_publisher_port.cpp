@@ -501,6 +501,40 @@ TEST_F(PublisherPort_test, sendWhenSubscribedDeliversAChunk)
     EXPECT_THAT(dummySample.dummy, Eq(17U));
 }
 
+TEST_F(PublisherPort_test, sendWhenOfferedUpdatesTheStatistics)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "67e378a5-0e17-4202-9509-50df1b70d897");
+    m_sutNoOfferOnCreateUserSide.offer();
+    m_sutNoOfferOnCreateRouDiSide.tryGetCaProMessage();
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    uint64_t chunkSize{0U};
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeChunkHeader = m_sutNoOfferOnCreateUserSide.tryAllocateChunk(
+            sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunkSize = maybeChunkHeader.value()->chunkSize();
+        m_sutNoOfferOnCreateUserSide.sendChunk(maybeChunkHeader.value());
+    }
+
+    auto& statistics = m_publisherPortDataNoOfferOnCreate.m_statistics;
+    EXPECT_THAT(statistics.m_chunksSent.load(), Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(statistics.m_bytesSent.load(), Eq(NUMBER_OF_CHUNKS * sizeof(DummySample)));
+    EXPECT_THAT(statistics.m_lastChunkSize.load(), Eq(chunkSize));
+}
+
+TEST_F(PublisherPort_test, sendWhenNotOfferedDoesNotUpdateTheStatistics)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ef0761be-dd80-411e-bf1f-ea349b2fffc3");
+    auto maybeChunkHeader = m_sutNoOfferOnCreateUserSide.tryAllocateChunk(
+        sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    m_sutNoOfferOnCreateUserSide.sendChunk(maybeChunkHeader.value());
+
+    EXPECT_THAT(m_publisherPortDataNoOfferOnCreate.m_statistics.m_chunksSent.load(), Eq(0U));
+    EXPECT_THAT(m_publisherPortDataNoOfferOnCreate.m_statistics.m_bytesSent.load(), Eq(0U));
+}
+
 TEST_F(PublisherPort_test, subscribeWithHistoryLikeTheARAField)
 {
     ::testing::Test::RecordProperty("TEST_ID", "12ea9650-c928-4185-8519-be949e2afcf7");
@@ -0,0 +1,185 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/readiness_fifo.hpp"
+#include "test.hpp"
+
+#include <poll.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+
+class ReadinessFifo_test : public Test
+{
+  public:
+    static bool isReadable(const int32_t fileDescriptor)
+    {
+        pollfd pollFd{fileDescriptor, POLLIN, 0};
+        return poll(&pollFd, 1U, 0) == 1 && (pollFd.revents & POLLIN) != 0;
+    }
+
+    static uint64_t numberOfPendingBytes(const int32_t fileDescriptor)
+    {
+        uint64_t numberOfBytes{0U};
+        uint8_t buffer{0U};
+        while (read(fileDescriptor, &buffer, 1U) == 1)
+        {
+            ++numberOfBytes;
+        }
+        return numberOfBytes;
+    }
+
+    ConditionVariableData m_condVarData{"Hypnotoad"};
+    ConditionListener m_listener{m_condVarData};
+};
+
+TEST_F(ReadinessFifo_test, NoFifoIsAttachedAfterConstruction)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0c7a5f3e-54a5-4d8b-9f0d-3e8fb6cbb3f1");
+    ReadinessFifo sut{m_condVarData};
+
+    EXPECT_THAT(m_condVarData.m_readinessFifoId.load(), Eq(ConditionVariableData::INVALID_READINESS_FIFO_ID));
+}
+
+TEST_F(ReadinessFifo_test, GetFileDescriptorAttachesFifoToConditionVariable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6e0d3b61-4f4a-4f2e-9c7d-3f6f4d0b2c55");
+    ReadinessFifo sut{m_condVarData};
+
+    ASSERT_FALSE(sut.getFileDescriptor().has_error());
+
+    const auto fifoId = m_condVarData.m_readinessFifoId.load();
+    EXPECT_THAT(fifoId, Ne(ConditionVariableData::INVALID_READINESS_FIFO_ID));
+    EXPECT_THAT(access(ReadinessFifo::path(fifoId).c_str(), F_OK), Eq(0));
+}
+
+TEST_F(ReadinessFifo_test, FifoIsOnlyAccessibleByTheOwnerAndTheGroup)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3a6e2f1c-8d4b-4c0e-b5a7-6f9d2e1c0b48");
+    ReadinessFifo sut{m_condVarData};
+    ASSERT_FALSE(sut.getFileDescriptor().has_error());
+
+    struct stat fifoStat
+    {
+    };
+    ASSERT_THAT(stat(ReadinessFifo::path(m_condVarData.m_readinessFifoId.load()).c_str(), &fifoStat), Eq(0));
+
+    constexpr mode_t PERMISSION_BITS{0777};
+    EXPECT_THAT(fifoStat.st_mode & PERMISSION_BITS, Eq(static_cast<mode_t>(ReadinessFifo::FIFO_PERMISSIONS.value())));
+    EXPECT_THAT(fifoStat.st_mode & static_cast<mode_t>(S_IRWXO), Eq(0U));
+}
+
+TEST_F(ReadinessFifo_test, DestructionDetachesAndRemovesFifo)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d1f5b0d4-7b8e-4b7c-8a0c-1a5c9b33e7a2");
+    uint64_t fifoId{ConditionVariableData::INVALID_READINESS_FIFO_ID};
+    {
+        ReadinessFifo sut{m_condVarData};
+        ASSERT_FALSE(sut.getFileDescriptor().has_error());
+        fifoId = m_condVarData.m_readinessFifoId.load();
+    }
+
+    EXPECT_THAT(m_condVarData.m_readinessFifoId.load(), Eq(ConditionVariableData::INVALID_READINESS_FIFO_ID));
+    EXPECT_THAT(access(ReadinessFifo::path(fifoId).c_str(), F_OK), Ne(0));
+}
+
+TEST_F(ReadinessFifo_test, DetachBeforeDestructionDoesNotAffectTheFifoOfTheNextOwner)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7c2e9a4f-1b6d-4f38-a5e0-3d8c6b1f9e27");
+    ReadinessFifo sut{m_condVarData};
+    ASSERT_FALSE(sut.getFileDescriptor().has_error());
+    sut.detach();
+    EXPECT_THAT(m_condVarData.m_readinessFifoId.load(), Eq(ConditionVariableData::INVALID_READINESS_FIFO_ID));
+
+    ReadinessFifo nextOwner{m_condVarData};
+    ASSERT_FALSE(nextOwner.getFileDescriptor().has_error());
+    const auto fifoId = m_condVarData.m_readinessFifoId.load();
+    sut.detach();
+
+    EXPECT_THAT(m_condVarData.m_readinessFifoId.load(), Eq(fifoId));
+    EXPECT_THAT(access(ReadinessFifo::path(fifoId).c_str(), F_OK), Eq(0));
+}
+
+TEST_F(ReadinessFifo_test, NotifyWithoutAttachedFifoDoesNotSetSignalPending)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2a9ab1e4-0f4c-4c18-8e4a-5e0d1a7b6c3d");
+    ConditionNotifier(m_condVarData, 0U).notify();
+
+    EXPECT_FALSE(m_condVarData.m_isReadinessSignalPending.load());
+}
+
+TEST_F(ReadinessFifo_test, MultipleNotificationsSignalTheFifoOnlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8b4e6c1f-3d2a-4f57-b0e9-c7a1d5f2e8b4");
+    ReadinessFifo sut{m_condVarData};
+    auto fileDescriptor = sut.getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+
+    ConditionNotifier(m_condVarData, 0U).notify();
+    ConditionNotifier(m_condVarData, 1U).notify();
+    ConditionNotifier(m_condVarData, 2U).notify();
+
+    EXPECT_THAT(numberOfPendingBytes(fileDescriptor.value()), Eq(1U));
+}
+
+TEST_F(ReadinessFifo_test, RearmEnablesTheNextSignal)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f3c2a9d8-6e1b-4a7f-9d5c-2b8e0a4f6c71");
+    ReadinessFifo sut{m_condVarData};
+    auto fileDescriptor = sut.getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+
+    ConditionNotifier(m_condVarData, 0U).notify();
+    sut.rearm();
+    IOX_DISCARD_RESULT(m_listener.tryWait());
+    EXPECT_FALSE(isReadable(fileDescriptor.value()));
+
+    ConditionNotifier(m_condVarData, 0U).notify();
+    EXPECT_TRUE(isReadable(fileDescriptor.value()));
+}
+
+TEST_F(ReadinessFifo_test, TryWaitAfterRearmReturnsNotifications)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5d7e1b3a-9c4f-4e2d-8a6b-0f1c3e5a7d92");
+    ReadinessFifo sut{m_condVarData};
+    ASSERT_FALSE(sut.getFileDescriptor().has_error());
+
+    ConditionNotifier(m_condVarData, 3U).notify();
+    sut.rearm();
+    auto notifications = m_listener.tryWait();
+
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_THAT(notifications[0U], Eq(3U));
+    EXPECT_THAT(m_listener.tryWait().size(), Eq(0U));
+}
+
+TEST_F(ReadinessFifo_test, PathContainsTheTempDirectory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a4b6c8d0-1e3f-4a5b-8c7d-9e0f1a2b3c4d");
+    const auto fifoPath = ReadinessFifo::path(0x1234U);
+
+    EXPECT_THAT(std::string(fifoPath.c_str()).find(iox::platform::IOX_TEMP_DIR), Eq(0U));
+    EXPECT_THAT(std::string(fifoPath.c_str()).find("1234"), Ne(std::string::npos));
+}
+
+} // namespace
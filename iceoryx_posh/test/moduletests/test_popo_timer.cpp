@@ -0,0 +1,267 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/popo/listener.hpp"
+#include "iceoryx_posh/popo/timer.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+#include "iox/duration.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::popo;
+using namespace iox::units::duration_literals;
+
+class WaitSetTest : public iox::popo::WaitSet<>
+{
+  public:
+    WaitSetTest(iox::popo::ConditionVariableData& condVarData) noexcept
+        : WaitSet(condVarData)
+    {
+    }
+};
+
+class ListenerTest : public iox::popo::Listener
+{
+  public:
+    ListenerTest(iox::popo::ConditionVariableData& condVarData) noexcept
+        : Listener(condVarData)
+    {
+    }
+};
+
+class Timer_test : public Test
+{
+  public:
+    static constexpr units::Duration FAR_FUTURE{1000_s};
+
+    uint64_t numberOfArmedTimerSlots() const
+    {
+        uint64_t numberOfArmedTimerSlots{0U};
+        for (const auto& timerSlot : m_condVar.m_timerSlots)
+        {
+            if (timerSlot.deadline() != TimerSlot::DISARMED)
+            {
+                ++numberOfArmedTimerSlots;
+            }
+        }
+        return numberOfArmedTimerSlots;
+    }
+
+    static void countCalls(Timer* const)
+    {
+        ++m_numberOfCalls;
+    }
+
+    static std::atomic<uint64_t> m_numberOfCalls;
+
+    Timer m_sut;
+    ConditionVariableData m_condVar{"Nibbler"};
+    WaitSetTest m_waitSet{m_condVar};
+};
+
+constexpr units::Duration Timer_test::FAR_FUTURE;
+std::atomic<uint64_t> Timer_test::m_numberOfCalls{0U};
+
+TEST_F(Timer_test, HasNotFiredWhenCreated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a3f2eefd-b157-493a-8ccc-74c6bab5487e");
+    EXPECT_FALSE(m_sut.hasFired());
+}
+
+TEST_F(Timer_test, DoesNotFireWhenNotAttached)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "47b3a0ae-45c0-49fb-ba9b-22b672817c6d");
+    m_sut.startAt(Timer::now() - 1_ms);
+
+    EXPECT_FALSE(m_sut.hasFired());
+    EXPECT_THAT(numberOfArmedTimerSlots(), Eq(0U));
+}
+
+TEST_F(Timer_test, DoesNotFireBeforeDeadline)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "646220f8-22f8-4267-87cd-9ab03026e51b");
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+    m_sut.startAt(Timer::now() + FAR_FUTURE);
+
+    EXPECT_THAT(m_waitSet.tryWait().size(), Eq(0U));
+    EXPECT_FALSE(m_sut.hasFired());
+}
+
+TEST_F(Timer_test, FiresWhenAbsoluteDeadlineIsReached)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b7213ebe-2079-47ab-8830-f28e4e1edc82");
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+    m_sut.startAt(Timer::now() - 1_ms);
+
+    auto notifications = m_waitSet.tryWait();
+
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_TRUE(notifications[0U]->doesOriginateFrom(&m_sut));
+}
+
+TEST_F(Timer_test, DeadlineWhichWasSetBeforeAttachingIsArmedWhenAttached)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "145d465b-dfff-4b9e-87de-0e7024ef2df5");
+    m_sut.startAt(Timer::now() - 1_ms);
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+
+    EXPECT_THAT(m_waitSet.tryWait().size(), Eq(1U));
+}
+
+TEST_F(Timer_test, OneShotTimerFiresOnlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "141ef236-7b3d-4eb9-bff2-fb9a8908a5ef");
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+    m_sut.startAt(Timer::now() - 1_ms);
+
+    EXPECT_THAT(m_waitSet.tryWait().size(), Eq(1U));
+    EXPECT_THAT(m_waitSet.tryWait().size(), Eq(0U));
+    EXPECT_THAT(numberOfArmedTimerSlots(), Eq(0U));
+}
+
+TEST_F(Timer_test, PeriodicTimerSkipsMissedPeriodsWithoutDrift)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1b646439-e9fe-492d-abab-7e3d8f65eafa");
+    constexpr units::Duration PERIOD{100_ms};
+    const auto firstDeadline = Timer::now() - 250_ms;
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+    m_sut.startPeriodicAt(firstDeadline, PERIOD);
+
+    EXPECT_THAT(m_waitSet.tryWait().size(), Eq(1U));
+
+    // two and a half periods have passed, the missed deadlines are reported once and the next deadline stays aligned
+    const auto expectedNextDeadline = (firstDeadline + PERIOD * 3U).toNanoseconds();
+    EXPECT_THAT(m_condVar.m_timerSlots[0U].deadline(), Eq(expectedNextDeadline));
+    EXPECT_THAT(m_waitSet.tryWait().size(), Eq(0U));
+}
+
+TEST_F(Timer_test, StoppedTimerDoesNotFire)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0c8b8bbc-4f0c-4adb-abdc-83e4b2ed32fb");
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+    m_sut.startAt(Timer::now() - 1_ms);
+    m_sut.stop();
+
+    EXPECT_THAT(m_waitSet.tryWait().size(), Eq(0U));
+}
+
+TEST_F(Timer_test, DetachingReleasesTheTimerSlot)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2e93c593-5fc3-45bd-8732-4c52cb9c9643");
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+    m_sut.startAt(Timer::now() + FAR_FUTURE);
+    ASSERT_THAT(numberOfArmedTimerSlots(), Eq(1U));
+
+    m_waitSet.detachEvent(m_sut);
+
+    EXPECT_THAT(numberOfArmedTimerSlots(), Eq(0U));
+    EXPECT_TRUE(m_condVar.m_timerSlots[0U].acquire(0U));
+}
+
+TEST_F(Timer_test, TimersBeyondTheSlotCapacityAreNotArmed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "41109c8c-0b55-41c3-a438-8369e9baebe0");
+    Timer timers[MAX_NUMBER_OF_TIMERS_PER_CONDITION_VARIABLE];
+    for (auto& timer : timers)
+    {
+        ASSERT_FALSE(m_waitSet.attachEvent(timer).has_error());
+        timer.startAt(Timer::now() + FAR_FUTURE);
+    }
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+    m_sut.startAt(Timer::now() - 1_ms);
+
+    EXPECT_THAT(numberOfArmedTimerSlots(), Eq(MAX_NUMBER_OF_TIMERS_PER_CONDITION_VARIABLE));
+    EXPECT_THAT(m_waitSet.tryWait().size(), Eq(0U));
+}
+
+TEST_F(Timer_test, WaitReturnsWhenDeadlineIsReached)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "43628dd1-3ab8-4820-9688-fb87bda065de");
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+    const auto deadline = Timer::now() + 10_ms;
+    m_sut.startAt(deadline);
+
+    auto notifications = m_waitSet.wait();
+
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_TRUE(notifications[0U]->doesOriginateFrom(&m_sut));
+    EXPECT_THAT(Timer::now(), Ge(deadline));
+}
+
+TEST_F(Timer_test, TimedWaitReturnsTimerBeforeTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ce81ef15-f574-4f17-9786-2937a5ef8a80");
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+    m_sut.startAt(Timer::now() + 10_ms);
+
+    auto notifications = m_waitSet.timedWait(FAR_FUTURE);
+
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_TRUE(notifications[0U]->doesOriginateFrom(&m_sut));
+}
+
+TEST_F(Timer_test, StartingTheTimerWakesUpBlockingWait)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b5f1175a-8ab7-4dbe-bb53-76f759de2754");
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+    std::atomic_bool hasReturned{false};
+
+    std::thread waiter([&] {
+        auto notifications = m_waitSet.wait();
+        EXPECT_THAT(notifications.size(), Eq(1U));
+        hasReturned = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_FALSE(hasReturned.load());
+    m_sut.startAt(Timer::now());
+    waiter.join();
+
+    EXPECT_TRUE(hasReturned.load());
+}
+
+TEST_F(Timer_test, ListenerCallsCallbackPeriodically)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "36031eee-f448-403a-b737-d0e91a08267e");
+    constexpr uint64_t EXPECTED_NUMBER_OF_CALLS{3U};
+    m_numberOfCalls = 0U;
+
+    ConditionVariableData listenerCondVar{"Leela"};
+    ListenerTest listener{listenerCondVar};
+    Timer timer;
+    ASSERT_FALSE(listener.attachEvent(timer, createNotificationCallback(Timer_test::countCalls)).has_error());
+    timer.startPeriodic(1_ms);
+
+    const auto timeout = Timer::now() + 10_s;
+    while (m_numberOfCalls.load() < EXPECTED_NUMBER_OF_CALLS && Timer::now() < timeout)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    timer.stop();
+
+    EXPECT_THAT(m_numberOfCalls.load(), Ge(EXPECTED_NUMBER_OF_CALLS));
+}
+
+} // namespace
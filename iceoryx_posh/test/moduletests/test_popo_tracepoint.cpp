@@ -0,0 +1,124 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/tracepoint.hpp"
+#include "test.hpp"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+
+class Tracepoint_test : public Test
+{
+  public:
+    std::vector<TraceEvent> collectEvents() const
+    {
+        std::vector<TraceEvent> events;
+        sut->forEachEvent([&](const TraceEvent& event) { events.push_back(event); });
+        return events;
+    }
+
+    static constexpr uint64_t THREAD_ID{42U};
+    std::unique_ptr<TraceRing> sut{std::make_unique<TraceRing>(THREAD_ID)};
+};
+
+TEST_F(Tracepoint_test, NewRingHasNoEvents)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c3e8a1f5-7b2d-4e96-8f0a-5d1c9b3e7a24");
+    EXPECT_THAT(collectEvents().size(), Eq(0U));
+    EXPECT_THAT(sut->threadId(), Eq(THREAD_ID));
+}
+
+TEST_F(Tracepoint_test, RecordedEventsAreReturnedFromTheOldestToTheNewest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5a9d2e7b-1c4f-4b83-a6e0-8f3b7d1c5e92");
+    sut->record(Tracepoint::CHUNK_LOANED, 128U);
+    sut->record(Tracepoint::CHUNK_PUBLISHED, 7U);
+    sut->record(Tracepoint::NOTIFIED, 3U);
+
+    const auto events = collectEvents();
+
+    ASSERT_THAT(events.size(), Eq(3U));
+    EXPECT_THAT(events[0].tracepoint, Eq(Tracepoint::CHUNK_LOANED));
+    EXPECT_THAT(events[0].argument, Eq(128U));
+    EXPECT_THAT(events[1].tracepoint, Eq(Tracepoint::CHUNK_PUBLISHED));
+    EXPECT_THAT(events[1].argument, Eq(7U));
+    EXPECT_THAT(events[2].tracepoint, Eq(Tracepoint::NOTIFIED));
+    EXPECT_THAT(events[2].argument, Eq(3U));
+    EXPECT_THAT(events[0].timestamp, Le(events[1].timestamp));
+    EXPECT_THAT(events[1].timestamp, Le(events[2].timestamp));
+}
+
+TEST_F(Tracepoint_test, FullRingOverwritesTheOldestEvents)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e1b7c4a9-3f6d-4d28-9c5e-2a8f0b6d4c71");
+    constexpr uint64_t NUMBER_OF_OVERWRITTEN_EVENTS{10U};
+    for (uint64_t i = 0U; i < TraceRing::CAPACITY + NUMBER_OF_OVERWRITTEN_EVENTS; ++i)
+    {
+        sut->record(Tracepoint::CHUNK_PUSHED, i);
+    }
+
+    const auto events = collectEvents();
+
+    ASSERT_THAT(events.size(), Eq(TraceRing::CAPACITY));
+    EXPECT_THAT(events.front().argument, Eq(NUMBER_OF_OVERWRITTEN_EVENTS));
+    EXPECT_THAT(events.back().argument, Eq(TraceRing::CAPACITY + NUMBER_OF_OVERWRITTEN_EVENTS - 1U));
+}
+
+TEST_F(Tracepoint_test, ThreadLocalRingIsTheSameWithinAThreadAndDiffersBetweenThreads)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8d4f1a6c-2e9b-4c57-b3a0-7e5d9c1f2b86");
+    TraceRing* ringOfThisThread = &TraceRing::threadLocalRing();
+    TraceRing* ringOfOtherThread{nullptr};
+    std::thread otherThread([&] { ringOfOtherThread = &TraceRing::threadLocalRing(); });
+    otherThread.join();
+
+    EXPECT_THAT(&TraceRing::threadLocalRing(), Eq(ringOfThisThread));
+    EXPECT_THAT(ringOfOtherThread, Ne(ringOfThisThread));
+}
+
+TEST_F(Tracepoint_test, ChromeJsonContainsTheEventsOfTheThreadLocalRing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2b6e9c3d-5a1f-4e74-8d0b-9c7a3f5e1d48");
+    auto& ring = TraceRing::threadLocalRing();
+    ring.record(Tracepoint::WOKEN_UP, 73U);
+
+    std::stringstream stream;
+    writeTraceEventsAsChromeJson(stream);
+    const auto json = stream.str();
+
+    EXPECT_THAT(json.find("{\"traceEvents\":["), Eq(0U));
+    EXPECT_THAT(json.find("\"name\":\"Tracepoint::WOKEN_UP\""), Ne(std::string::npos));
+    EXPECT_THAT(json.find("\"tid\":" + std::to_string(ring.threadId()) + ",\"args\":{\"argument\":73}"),
+                Ne(std::string::npos));
+}
+
+TEST_F(Tracepoint_test, AsStringLiteralConvertsTracepointToString)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f7a3c9e1-4d8b-4a26-9e5f-1b0c7d3a8e54");
+    EXPECT_THAT(asStringLiteral(Tracepoint::CHUNK_LOANED), StrEq("Tracepoint::CHUNK_LOANED"));
+    EXPECT_THAT(asStringLiteral(Tracepoint::CHUNK_TAKEN), StrEq("Tracepoint::CHUNK_TAKEN"));
+    EXPECT_THAT(asStringLiteral(Tracepoint::WOKEN_UP), StrEq("Tracepoint::WOKEN_UP"));
+}
+
+} // namespace
@@ -302,6 +302,44 @@ TEST_F(UsedChunkList_test, RemovingChunkFromListLetsTheSharedChunkReturnOwnershi
     EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
 }
 
+TEST_F(UsedChunkList_test, ForEachChunkIsCalledForAllChunksInTheList)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "674a8b5e-0dec-4c15-b7b1-6c7404d5531d");
+    std::vector<const ChunkHeader*> chunkHeaderInUse;
+    createMultipleChunks(USED_CHUNK_LIST_CAPACITY / 2U, [&](SharedChunk&& chunk) {
+        chunkHeaderInUse.push_back(chunk.getChunkHeader());
+        sut.insert(chunk);
+    });
+    SharedChunk removedChunk;
+    ASSERT_TRUE(sut.remove(chunkHeaderInUse.front(), removedChunk));
+    chunkHeaderInUse.erase(chunkHeaderInUse.begin());
+
+    std::vector<const ChunkHeader*> visitedChunkHeader;
+    sut.forEachChunk(
+        [&](const ChunkManagement* chunkManagement) { return memoryManager.containsChunkManagement(chunkManagement); },
+        [&](const ChunkHeader* chunkHeader) { visitedChunkHeader.push_back(chunkHeader); });
+
+    EXPECT_THAT(visitedChunkHeader, UnorderedElementsAreArray(chunkHeaderInUse));
+}
+
+TEST_F(UsedChunkList_test, ForEachChunkSkipsChunksWhichDoNotReferToAChunkManagement)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e7c98d9c-e4d2-4590-b5c2-2e99a12ab5f8");
+    createMultipleChunks(USED_CHUNK_LIST_CAPACITY / 2U, [&](SharedChunk&& chunk) { sut.insert(chunk); });
+
+    uint32_t numberOfCheckedChunks{0U};
+    uint32_t numberOfVisitedChunks{0U};
+    sut.forEachChunk(
+        [&](const ChunkManagement*) {
+            ++numberOfCheckedChunks;
+            return false;
+        },
+        [&](const ChunkHeader*) { ++numberOfVisitedChunks; });
+
+    EXPECT_THAT(numberOfCheckedChunks, Eq(USED_CHUNK_LIST_CAPACITY / 2U));
+    EXPECT_THAT(numberOfVisitedChunks, Eq(0U));
+}
+
 TEST_F(UsedChunkList_test, CallingCleanupReleasesAllChunks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "765e2726-b022-41fc-a839-77db9ac07d2b");
@@ -27,6 +27,7 @@
 
 #include <chrono>
 #include <memory>
+#include <poll.h>
 #include <thread>
 
 namespace
@@ -1202,6 +1203,95 @@ TEST_F(WaitSet_test, TimedWaitReturnsTheOneTriggeredCondition)
     WaitReturnsTheOneTriggeredCondition(this, [&] { return m_sut->timedWait(10_ms); });
 }
 
+TEST_F(WaitSet_test, TryWaitReturnsTheOneTriggeredCondition)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1b7b91fa-0fd2-41fd-a5ec-5d8a36abe0a5");
+    WaitReturnsTheOneTriggeredCondition(this, [&] { return m_sut->tryWait(); });
+}
+
+TEST_F(WaitSet_test, TryWaitReturnsNothingWhenNothingTriggered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a3efefe6-bb51-48cc-9812-fcab8a646319");
+    for (uint64_t i = 0U; i < iox::MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET; ++i)
+    {
+        ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[i], 5U + i).has_error());
+    }
+
+    auto triggerVector = m_sut->tryWait();
+    ASSERT_THAT(triggerVector.size(), Eq(0U));
+}
+
+bool isReadable(const int32_t fileDescriptor)
+{
+    pollfd pollFd{fileDescriptor, POLLIN, 0};
+    return poll(&pollFd, 1U, 0) == 1 && (pollFd.revents & POLLIN) != 0;
+}
+
+TEST_F(WaitSet_test, ReadinessFileDescriptorIsNotReadableWhenNothingTriggered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cd692e5a-7c8d-475a-8ec8-a5eb331bdd0f");
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0U], 0U).has_error());
+
+    auto fileDescriptor = m_sut->getReadinessFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+    EXPECT_FALSE(isReadable(fileDescriptor.value()));
+}
+
+TEST_F(WaitSet_test, ReadinessFileDescriptorIsReadableAfterTrigger)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c2c2c8cf-484b-4369-a71c-5646c6ccf2a8");
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0U], 0U).has_error());
+    auto fileDescriptor = m_sut->getReadinessFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+
+    m_simpleEvents[0U].trigger();
+
+    EXPECT_TRUE(isReadable(fileDescriptor.value()));
+}
+
+TEST_F(WaitSet_test, ReadinessFileDescriptorIsReadableWhenTriggeredBeforeItWasAcquired)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5e2e6e36-5af1-4dfa-8080-76956bc77d3f");
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0U], 0U).has_error());
+    m_simpleEvents[0U].trigger();
+
+    auto fileDescriptor = m_sut->getReadinessFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+
+    EXPECT_TRUE(isReadable(fileDescriptor.value()));
+}
+
+TEST_F(WaitSet_test, TryWaitRearmsReadinessFileDescriptor)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ad83f4f4-58db-4178-bc0e-56734734fc93");
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0U], 0U).has_error());
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[1U], 1U).has_error());
+    auto fileDescriptor = m_sut->getReadinessFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+
+    m_simpleEvents[0U].trigger();
+    m_simpleEvents[0U].trigger();
+    EXPECT_THAT(m_sut->tryWait().size(), Eq(1U));
+    EXPECT_FALSE(isReadable(fileDescriptor.value()));
+
+    m_simpleEvents[1U].trigger();
+    EXPECT_TRUE(isReadable(fileDescriptor.value()));
+    auto triggerVector = m_sut->tryWait();
+    ASSERT_THAT(triggerVector.size(), Eq(1U));
+    EXPECT_TRUE(triggerVector[0U]->doesOriginateFrom(&m_simpleEvents[1U]));
+}
+
+TEST_F(WaitSet_test, ReadinessFileDescriptorIsTheSameOnConsecutiveCalls)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "55abd3d1-931d-4d1a-970e-0d958a869483");
+    auto firstFileDescriptor = m_sut->getReadinessFileDescriptor();
+    auto secondFileDescriptor = m_sut->getReadinessFileDescriptor();
+
+    ASSERT_FALSE(firstFileDescriptor.has_error());
+    ASSERT_FALSE(secondFileDescriptor.has_error());
+    EXPECT_THAT(firstFileDescriptor.value(), Eq(secondFileDescriptor.value()));
+}
+
 void WaitReturnsAllTriggeredConditionWhenMultipleAreTriggered(
     WaitSet_test* test, const std::function<WaitSet<>::NotificationInfoVector()>& waitCall)
 {
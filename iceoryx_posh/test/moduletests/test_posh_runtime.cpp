@@ -345,12 +345,17 @@ TEST_F(PoshRuntime_test, GetMiddlewarePublisherWithForbiddenServiceDescriptionsF
     iox::vector<iox::capro::ServiceDescription, iox::NUMBER_OF_INTERNAL_PUBLISHERS> internalServices;
     const iox::capro::ServiceDescription serviceRegistry{
         iox::SERVICE_DISCOVERY_SERVICE_NAME, iox::SERVICE_DISCOVERY_INSTANCE_NAME, iox::SERVICE_DISCOVERY_EVENT_NAME};
+    const iox::capro::ServiceDescription serviceRegistryDelta{iox::SERVICE_DISCOVERY_SERVICE_NAME,
+                                                              iox::SERVICE_DISCOVERY_INSTANCE_NAME,
+                                                              iox::SERVICE_DISCOVERY_DELTA_EVENT_NAME};
 
     // Added by PortManager
     internalServices.push_back(serviceRegistry);
+    internalServices.push_back(serviceRegistryDelta);
     internalServices.push_back(iox::roudi::IntrospectionPortService);
     internalServices.push_back(iox::roudi::IntrospectionPortThroughputService);
     internalServices.push_back(iox::roudi::IntrospectionSubscriberPortChangingDataService);
+    internalServices.push_back(iox::roudi::IntrospectionChunkOwnershipService);
 
     // Added by ProcessManager
     internalServices.push_back(iox::roudi::IntrospectionMempoolService);
@@ -830,6 +835,103 @@ TEST_F(PoshRuntime_test, GetMiddlewareConditionVariableListOverflow)
     IOX_TESTING_EXPECT_ERROR(iox::PoshError::PORT_POOL__CONDITION_VARIABLE_LIST_OVERFLOW);
 }
 
+TEST_F(PoshRuntime_test, RequestedPortsAreHandedOutWithTheRequestedOptions)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d757cbc4-a7f8-42e6-be81-6e6064b4c6a9");
+    iox::popo::PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = 13U;
+    publisherOptions.nodeName = m_nodeName;
+    iox::popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.historyRequest = 7U;
+    subscriberOptions.queueCapacity = 42U;
+
+    const iox::runtime::PortConfigInfo portConfigInfo(11U, 22U, 33U);
+
+    PortRequests portRequests;
+    portRequests.addPublisher(iox::capro::ServiceDescription("99", "1", "20"), publisherOptions, portConfigInfo)
+        .addSubscriber(iox::capro::ServiceDescription("99", "1", "21"), subscriberOptions)
+        .addConditionVariable();
+    EXPECT_EQ(portRequests.size(), 3U);
+    m_runtime->requestPorts(portRequests);
+
+    const auto publisherPort = m_runtime->getMiddlewarePublisher(
+        iox::capro::ServiceDescription("99", "1", "20"), publisherOptions, portConfigInfo);
+    const auto subscriberPort =
+        m_runtime->getMiddlewareSubscriber(iox::capro::ServiceDescription("99", "1", "21"), subscriberOptions);
+    const auto conditionVariable = m_runtime->getMiddlewareConditionVariable();
+
+    ASSERT_NE(nullptr, publisherPort);
+    EXPECT_EQ(iox::capro::ServiceDescription("99", "1", "20"), publisherPort->m_serviceDescription);
+    EXPECT_EQ(publisherOptions.historyCapacity, publisherPort->m_chunkSenderData.m_historyCapacity);
+    ASSERT_NE(nullptr, subscriberPort);
+    EXPECT_EQ(iox::capro::ServiceDescription("99", "1", "21"), subscriberPort->m_serviceDescription);
+    EXPECT_EQ(subscriberOptions.historyRequest, subscriberPort->m_options.historyRequest);
+    EXPECT_EQ(subscriberOptions.queueCapacity, subscriberPort->m_chunkReceiverData.m_queue.capacity());
+    EXPECT_NE(nullptr, conditionVariable);
+    IOX_TESTING_EXPECT_OK();
+}
+
+TEST_F(PoshRuntime_test, RequestedPortsOfSeveralBatchesAreHandedOutWithoutFurtherRequests)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b6e62e80-1a27-42d2-837b-daada05bc5ab");
+    constexpr uint32_t NUMBER_OF_PUBLISHERS{3U * iox::MAX_PORT_REQUESTS_PER_BATCH};
+    static_assert(NUMBER_OF_PUBLISHERS <= iox::MAX_PUBLISHERS - iox::NUMBER_OF_INTERNAL_PUBLISHERS,
+                  "the test requires more publishers");
+    auto serviceDescription = [](const uint32_t i) {
+        return iox::capro::ServiceDescription(
+            "Batch", "Publisher", into<lossy<iox::capro::IdString_t>>(convert::toString(i)));
+    };
+
+    PortRequests portRequests;
+    for (uint32_t i = 0U; i < NUMBER_OF_PUBLISHERS; ++i)
+    {
+        portRequests.addPublisher(serviceDescription(i));
+    }
+    m_runtime->requestPorts(portRequests);
+
+    for (uint32_t i = 0U; i < NUMBER_OF_PUBLISHERS; ++i)
+    {
+        const auto publisherPort = m_runtime->getMiddlewarePublisher(serviceDescription(i));
+        ASSERT_NE(nullptr, publisherPort);
+        EXPECT_EQ(serviceDescription(i), publisherPort->m_serviceDescription);
+    }
+    IOX_TESTING_EXPECT_OK();
+
+    // the requested publisher was already handed out, therefore a new one is requested from RouDi
+    const auto publisherPort = m_runtime->getMiddlewarePublisher(serviceDescription(0U));
+    if (std::is_same<iox::build::CommunicationPolicy, iox::build::OneToManyPolicy>::value)
+    {
+        EXPECT_EQ(nullptr, publisherPort);
+        IOX_TESTING_EXPECT_ERROR(iox::PoshError::POSH__RUNTIME_PUBLISHER_PORT_NOT_UNIQUE);
+    }
+    else if (std::is_same<iox::build::CommunicationPolicy, iox::build::ManyToManyPolicy>::value)
+    {
+        EXPECT_NE(nullptr, publisherPort);
+    }
+}
+
+TEST_F(PoshRuntime_test, PortWhichRouDiCouldNotCreateIsRequestedAgainOnDemand)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7454d877-d0ed-4b5a-8fef-c69ac61f8115");
+    PortRequests portRequests;
+    for (uint32_t i = 0U; i < iox::MAX_NUMBER_OF_CONDITION_VARIABLES + 1U; ++i)
+    {
+        portRequests.addConditionVariable();
+    }
+    m_runtime->requestPorts(portRequests);
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::PORT_POOL__CONDITION_VARIABLE_LIST_OVERFLOW);
+
+    for (uint32_t i = 0U; i < iox::MAX_NUMBER_OF_CONDITION_VARIABLES; ++i)
+    {
+        auto conditionVariable = m_runtime->getMiddlewareConditionVariable();
+        ASSERT_NE(nullptr, conditionVariable);
+    }
+
+    auto conditionVariable = m_runtime->getMiddlewareConditionVariable();
+    EXPECT_EQ(nullptr, conditionVariable);
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::POSH__RUNTIME_ROUDI_CONDITION_VARIABLE_LIST_FULL);
+}
+
 TEST_F(PoshRuntime_test, ShutdownUnblocksBlockingPublisher)
 {
     ::testing::Test::RecordProperty("TEST_ID", "c3a97770-ee9a-46a4-baf7-80ebbac74f4b");
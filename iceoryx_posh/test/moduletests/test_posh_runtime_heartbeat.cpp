@@ -102,4 +102,26 @@ TEST(Heartbeat_test, ElapsedMillisecondsSinceLastBeatIsLargerOrEqualToSleepTimeA
     EXPECT_THAT(elapsed_ms, Ge(real_sleep_duration.toMilliseconds()));
     EXPECT_THAT(elapsed_ms, Le(real_sleep_duration.toMilliseconds() + ALLOWED_JITTER_MS));
 }
+
+TEST(Heartbeat_test, ElapsedMillisecondsSinceLastBeatRelativeToTimestampIsTheDifferenceToTheLastBeat)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4e2b7c19-8d3f-4a6e-b5c1-0f9a2d7e3b48");
+
+    constexpr uint64_t OFFSET_MS{1000};
+
+    Heartbeat sut;
+    auto now_ms = Heartbeat::milliseconds_since_epoch();
+
+    EXPECT_THAT(sut.elapsed_milliseconds_since_last_beat(now_ms + OFFSET_MS), Ge(OFFSET_MS));
+    EXPECT_THAT(sut.elapsed_milliseconds_since_last_beat(now_ms + OFFSET_MS), Le(OFFSET_MS + ALLOWED_JITTER_MS));
+}
+
+TEST(Heartbeat_test, ElapsedMillisecondsSinceLastBeatRelativeToTimestampBeforeTheLastBeatIsZero)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a7d1e5f3-2c6b-4f8a-9e0d-6b3c1a5f7e92");
+
+    Heartbeat sut;
+
+    EXPECT_THAT(sut.elapsed_milliseconds_since_last_beat(0U), Eq(0U));
+}
 } // namespace
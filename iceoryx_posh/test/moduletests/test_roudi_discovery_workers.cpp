@@ -0,0 +1,90 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/discovery_workers.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+
+TEST(DiscoveryWorkers_test, NumberOfShardsIsLimitedToAtLeastOne)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7d2e5a1c-40b9-4f86-a3c7-e18f5b96d204");
+    DiscoveryWorkers sut{0U};
+
+    EXPECT_THAT(sut.numberOfShards(), Eq(1U));
+}
+
+TEST(DiscoveryWorkers_test, NumberOfShardsIsLimitedToMaximum)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b5f39c0e-6a72-4d18-8e4b-2c9a07d1f356");
+    DiscoveryWorkers sut{DiscoveryWorkers::MAX_NUMBER_OF_SHARDS + 1U};
+
+    EXPECT_THAT(sut.numberOfShards(), Eq(DiscoveryWorkers::MAX_NUMBER_OF_SHARDS));
+}
+
+TEST(DiscoveryWorkers_test, SingleShardIsHandledByTheCallingThread)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1e84d7b3-95c0-4a2f-b6e1-d03f7a58c9e2");
+    DiscoveryWorkers sut{1U};
+
+    std::thread::id handlingThread;
+    uint32_t handledShard{DiscoveryWorkers::MAX_NUMBER_OF_SHARDS};
+    sut.run([&](const uint32_t shard) {
+        handlingThread = std::this_thread::get_id();
+        handledShard = shard;
+    });
+
+    EXPECT_THAT(handlingThread, Eq(std::this_thread::get_id()));
+    EXPECT_THAT(handledShard, Eq(0U));
+}
+
+TEST(DiscoveryWorkers_test, EveryShardIsHandledOncePerRunOnDistinctThreads)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e9a06f42-3b8d-4c15-97d2-5f1c8e0b7a63");
+    constexpr uint32_t NUMBER_OF_SHARDS{4U};
+    constexpr uint32_t NUMBER_OF_RUNS{10U};
+    DiscoveryWorkers sut{NUMBER_OF_SHARDS};
+
+    for (uint32_t run = 0U; run < NUMBER_OF_RUNS; ++run)
+    {
+        std::atomic<uint32_t> handledShards[NUMBER_OF_SHARDS]{};
+        std::mutex mutex;
+        std::set<std::thread::id> handlingThreads;
+        sut.run([&](const uint32_t shard) {
+            ASSERT_THAT(shard, Lt(NUMBER_OF_SHARDS));
+            handledShards[shard].fetch_add(1U);
+            std::lock_guard<std::mutex> lock(mutex);
+            handlingThreads.insert(std::this_thread::get_id());
+        });
+
+        for (auto& handledShard : handledShards)
+        {
+            EXPECT_THAT(handledShard.load(), Eq(1U));
+        }
+        EXPECT_THAT(handlingThreads.size(), Eq(NUMBER_OF_SHARDS));
+    }
+}
+
+} // namespace
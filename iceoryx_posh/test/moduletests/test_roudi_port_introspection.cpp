@@ -44,10 +44,18 @@ class PortIntrospectionAccess : public iox::roudi::PortIntrospection<PublisherPo
     {
         return this->m_publisherPort;
     }
+    void sendSubscriberPortsData()
+    {
+        iox::roudi::PortIntrospection<PublisherPort, SubscriberPort>::sendSubscriberPortsData();
+    }
     iox::optional<PublisherPort>& getPublisherPortThroughput()
     {
         return this->m_publisherPortThroughput;
     }
+    iox::optional<PublisherPort>& getPublisherPortSubscriberPortsData()
+    {
+        return this->m_publisherPortSubscriberPortsData;
+    }
 };
 
 class PortIntrospection_test : public Test
@@ -299,6 +307,75 @@ TEST_F(PortIntrospection_test, addAndRemovePublisher)
     chunk->sample()->~PortIntrospectionFieldTopic();
 }
 
+TEST_F(PortIntrospection_test, sendThroughputDataContainsThePublisherStatistics)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4eee277f-3313-48c2-b5c1-3a641cdfb73f");
+    using Topic = iox::roudi::PortThroughputIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    iox::mepoo::MemoryManager memoryManager;
+    iox::popo::PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = 1U;
+    iox::popo::PublisherPortData portData(iox::capro::ServiceDescription("a", "b", "c"),
+                                          iox::RuntimeName_t("name"),
+                                          iox::roudi::DEFAULT_UNIQUE_ROUDI_ID,
+                                          &memoryManager,
+                                          publisherOptions);
+    ASSERT_THAT(m_introspectionAccess.addPublisher(portData), Eq(true));
+
+    // the counters are usually increased by the publisher
+    constexpr uint64_t CHUNKS_SENT{4U};
+    constexpr uint64_t BYTES_SENT{400U};
+    constexpr uint64_t CHUNK_SIZE{256U};
+    constexpr uint64_t QUEUE_OVERFLOWS{2U};
+    portData.m_statistics.m_chunksSent.store(CHUNKS_SENT);
+    portData.m_statistics.m_bytesSent.store(BYTES_SENT);
+    portData.m_statistics.m_lastChunkSize.store(CHUNK_SIZE);
+    portData.m_chunkSenderData.m_numberOfQueueOverflows.store(QUEUE_OVERFLOWS);
+
+    iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError> tryAllocateChunkResult =
+        iox::ok(chunk.get()->chunkHeader());
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(tryAllocateChunkResult));
+
+    bool chunkWasSent = false;
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), sendChunk(_))
+        .WillRepeatedly(Invoke([&](iox::mepoo::ChunkHeader* const) { chunkWasSent = true; }));
+
+    m_introspectionAccess.sendThroughputData();
+
+    ASSERT_THAT(chunkWasSent, Eq(true));
+    {
+        ASSERT_THAT(chunk->sample()->m_throughputList.size(), Eq(1U));
+        const auto& throughput = chunk->sample()->m_throughputList[0];
+        EXPECT_THAT(throughput.m_publisherPortID, Eq(static_cast<uint64_t>(portData.m_uniqueId)));
+        EXPECT_THAT(throughput.m_chunksSent, Eq(CHUNKS_SENT));
+        EXPECT_THAT(throughput.m_bytesSent, Eq(BYTES_SENT));
+        EXPECT_THAT(throughput.m_queueOverflows, Eq(QUEUE_OVERFLOWS));
+        EXPECT_THAT(throughput.m_chunkSize, Eq(CHUNK_SIZE));
+        EXPECT_THAT(throughput.m_sampleSize, Eq(BYTES_SENT / CHUNKS_SENT));
+        EXPECT_THAT(throughput.m_isField, Eq(true));
+        EXPECT_THAT(throughput.m_chunksPerMinute, Gt(0.0));
+        EXPECT_THAT(throughput.m_lastSendIntervalInNanoseconds, Gt(0U));
+    }
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+
+    // the rates only cover the chunks which were sent since the previous sample
+    chunkWasSent = false;
+    m_introspectionAccess.sendThroughputData();
+
+    ASSERT_THAT(chunkWasSent, Eq(true));
+    {
+        ASSERT_THAT(chunk->sample()->m_throughputList.size(), Eq(1U));
+        const auto& throughput = chunk->sample()->m_throughputList[0];
+        EXPECT_THAT(throughput.m_chunksSent, Eq(CHUNKS_SENT));
+        EXPECT_THAT(throughput.m_chunksPerMinute, Eq(0.0));
+        EXPECT_THAT(throughput.m_lastSendIntervalInNanoseconds, Eq(0U));
+    }
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+}
+
 TEST_F(PortIntrospection_test, addAndRemoveSubscriber)
 {
     ::testing::Test::RecordProperty("TEST_ID", "359527ee-78a6-4a98-acd8-b39d263d8e02");
@@ -438,6 +515,61 @@ TEST_F(PortIntrospection_test, addAndRemoveSubscriber)
 }
 
 
+TEST_F(PortIntrospection_test, sendSubscriberPortsDataContainsTheQueueStatistics)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "abd48ac0-df86-4804-96d6-84c585936081");
+    using Topic = iox::roudi::SubscriberPortChangingIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    constexpr uint64_t QUEUE_CAPACITY{10U};
+    iox::popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.queueCapacity = QUEUE_CAPACITY;
+    iox::popo::SubscriberPortData portData{iox::capro::ServiceDescription("a", "b", "c"),
+                                           iox::RuntimeName_t("name"),
+                                           iox::roudi::DEFAULT_UNIQUE_ROUDI_ID,
+                                           iox::popo::VariantQueueTypes::SoFi_SingleProducerSingleConsumer,
+                                           subscriberOptions};
+    ASSERT_THAT(m_introspectionAccess.addSubscriber(portData), Eq(true));
+
+    // the counters are usually increased by the publishers and the subscriber
+    constexpr uint64_t HIGH_WATER_MARK{7U};
+    constexpr uint64_t LOST_CHUNKS{3U};
+    constexpr uint64_t CHUNKS_RECEIVED{42U};
+    portData.m_chunkReceiverData.m_queueHighWaterMark.store(HIGH_WATER_MARK);
+    portData.m_chunkReceiverData.m_numberOfLostChunks.store(LOST_CHUNKS);
+    portData.m_statistics.m_chunksReceived.store(CHUNKS_RECEIVED);
+    constexpr uint64_t LATENCY_IN_NANOSECONDS{3U};
+    portData.m_statistics.m_latency.record(LATENCY_IN_NANOSECONDS);
+
+    iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError> tryAllocateChunkResult =
+        iox::ok(chunk.get()->chunkHeader());
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortSubscriberPortsData().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(tryAllocateChunkResult));
+
+    bool chunkWasSent = false;
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortSubscriberPortsData().value(), sendChunk(_))
+        .WillRepeatedly(Invoke([&](iox::mepoo::ChunkHeader* const) { chunkWasSent = true; }));
+
+    m_introspectionAccess.sendSubscriberPortsData();
+
+    ASSERT_THAT(chunkWasSent, Eq(true));
+    ASSERT_THAT(chunk->sample()->subscriberPortChangingDataList.size(), Eq(1U));
+    const auto& subscriberData = chunk->sample()->subscriberPortChangingDataList[0];
+    EXPECT_THAT(subscriberData.fifoSize, Eq(0U));
+    EXPECT_THAT(subscriberData.fifoCapacity, Eq(QUEUE_CAPACITY));
+    EXPECT_THAT(subscriberData.fifoHighWaterMark, Eq(HIGH_WATER_MARK));
+    EXPECT_THAT(subscriberData.lostChunks, Eq(LOST_CHUNKS));
+    EXPECT_THAT(subscriberData.chunksReceived, Eq(CHUNKS_RECEIVED));
+    // without 'IOX_LATENCY_STATISTICS' the subscriber port has no storage for the latencies
+    constexpr uint64_t EXPECTED_LATENCY{iox::build::IOX_LATENCY_STATISTICS_FLAG ? LATENCY_IN_NANOSECONDS : 0U};
+    EXPECT_THAT(subscriberData.latencyP50InNanoseconds, Eq(EXPECTED_LATENCY));
+    EXPECT_THAT(subscriberData.latencyP99InNanoseconds, Eq(EXPECTED_LATENCY));
+    EXPECT_THAT(subscriberData.latencyP999InNanoseconds, Eq(EXPECTED_LATENCY));
+
+    chunk->sample()->~SubscriberPortChangingIntrospectionFieldTopic();
+}
+
 TEST_F(PortIntrospection_test, Thread)
 {
     ::testing::Test::RecordProperty("TEST_ID", "ae5b252d-0060-4bb7-a193-0c2ae0ebbb7a");
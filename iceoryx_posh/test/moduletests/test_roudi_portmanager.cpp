@@ -91,6 +91,54 @@ TEST_F(PortManager_test, DoDiscoveryWithSingleShotSubscriberFirst)
     EXPECT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
 }
 
+TEST_F(PortManager_test, OfferNotifiesTheDiscoveryConditionVariable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0ac266e9-0454-47f7-bc92-8049bff39776");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    iox::popo::ConditionListener discoveryListener{m_portManager->discoveryConditionVariableData()};
+
+    PublisherPortUser publisher(
+        m_portManager
+            ->acquirePublisherPortData(
+                {"1", "1", "1"}, publisherOptions, "guiseppe", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value());
+    ASSERT_TRUE(publisher);
+    IOX_DISCARD_RESULT(discoveryListener.tryWait());
+
+    publisher.offer();
+
+    auto notifications = discoveryListener.tryWait();
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_THAT(notifications[0U], Eq(static_cast<uint64_t>(iox::popo::DiscoveryNotificationOrigin::PUBLISHER_PORT)));
+}
+
+TEST_F(PortManager_test, DoDiscoveryForNotifiedPortsConnectsSubscriberAndPublisher)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fc4d754e-0423-499e-ad40-7bf74383dcfe");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), false};
+    iox::popo::ConditionListener discoveryListener{m_portManager->discoveryConditionVariableData()};
+
+    SubscriberPortUser subscriber(
+        m_portManager->acquireSubscriberPortData({"1", "1", "1"}, subscriberOptions, "schlomo", PortConfigInfo())
+            .value());
+    ASSERT_TRUE(subscriber);
+    subscriber.subscribe();
+
+    PublisherPortUser publisher(
+        m_portManager
+            ->acquirePublisherPortData(
+                {"1", "1", "1"}, publisherOptions, "guiseppe", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value());
+    ASSERT_TRUE(publisher);
+    publisher.offer();
+
+    m_portManager->doDiscoveryForNotifiedPorts(discoveryListener.tryWait());
+
+    ASSERT_TRUE(publisher.hasSubscribers());
+    EXPECT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+}
+
 TEST_F(PortManager_test, DoDiscoveryWithDiscoveryLoopInBetweenCreationOfSubscriberAndPublisher)
 {
     ::testing::Test::RecordProperty("TEST_ID", "bbd475bd-23fd-4b8f-b2ae-88e41c39e6e2");
@@ -153,6 +201,79 @@ TEST_F(PortManager_test, DoDiscoveryWithSubscribersCreatedBeforeAndAfterCreation
     EXPECT_THAT(subscriber2.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
 }
 
+TEST_F(PortManager_test, DoDiscoveryWithMultipleShardsConnectsSubscribersOfAllServices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f0b7c2d-8e14-4a9b-b6d5-71c2e0a9f483");
+    constexpr uint32_t NUMBER_OF_DISCOVERY_SHARDS{4U};
+    constexpr uint32_t NUMBER_OF_SERVICES{20U};
+    recreatePortManagerWithDiscoveryShards(NUMBER_OF_DISCOVERY_SHARDS);
+
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), false};
+
+    std::vector<PublisherPortUser> publishers;
+    std::vector<SubscriberPortUser> subscribers;
+    for (uint32_t i = 0U; i < NUMBER_OF_SERVICES; ++i)
+    {
+        const auto service = getUniqueSD();
+        publishers.emplace_back(m_portManager
+                                    ->acquirePublisherPortData(service,
+                                                               publisherOptions,
+                                                               "guiseppe",
+                                                               m_payloadDataSegmentMemoryManager,
+                                                               PortConfigInfo())
+                                    .value());
+        publishers.back().offer();
+
+        subscribers.emplace_back(
+            m_portManager->acquireSubscriberPortData(service, subscriberOptions, "schlomo", PortConfigInfo()).value());
+        subscribers.back().subscribe();
+    }
+
+    m_portManager->doDiscovery();
+
+    for (uint32_t i = 0U; i < NUMBER_OF_SERVICES; ++i)
+    {
+        EXPECT_TRUE(publishers[i].hasSubscribers());
+        EXPECT_THAT(subscribers[i].getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+    }
+}
+
+TEST_F(PortManager_test, DoDiscoveryWithMultipleShardsDestroysPortsAndRemovesThemFromServiceRegistry)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c8a41e95-2d6f-4b07-9f3e-5a1d8b6c0e27");
+    constexpr uint32_t NUMBER_OF_DISCOVERY_SHARDS{3U};
+    recreatePortManagerWithDiscoveryShards(NUMBER_OF_DISCOVERY_SHARDS);
+    const iox::capro::ServiceDescription service{"The", "Sharded", "Hypnotoad"};
+
+    PublisherPortUser publisher(m_portManager
+                                    ->acquirePublisherPortData(service,
+                                                               createTestPubOptions(),
+                                                               "guiseppe",
+                                                               m_payloadDataSegmentMemoryManager,
+                                                               PortConfigInfo())
+                                    .value());
+    publisher.offer();
+    m_portManager->doDiscovery();
+
+    uint64_t publisherCount{0U};
+    m_portManager->serviceRegistry().find(service.getServiceIDString(),
+                                          service.getInstanceIDString(),
+                                          service.getEventIDString(),
+                                          [&](const auto& entry) { publisherCount += entry.publisherCount; });
+    EXPECT_THAT(publisherCount, Eq(1U));
+
+    publisher.destroy();
+    m_portManager->doDiscovery();
+
+    publisherCount = 0U;
+    m_portManager->serviceRegistry().find(service.getServiceIDString(),
+                                          service.getInstanceIDString(),
+                                          service.getEventIDString(),
+                                          [&](const auto& entry) { publisherCount += entry.publisherCount; });
+    EXPECT_THAT(publisherCount, Eq(0U));
+}
+
 TEST_F(PortManager_test, SubscribeOnCreateSubscribesWithoutDiscoveryLoopWhenPublisherAvailable)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5a94cf82-d1f6-4129-88ca-34344d94e04e");
@@ -591,6 +712,39 @@ TEST_F(PortManager_test, DeleteInterfacePortfromMaximumNumberAndAddOneIsSuccessf
     }
 }
 
+TEST_F(PortManager_test, DeletePortsOfProcessDestroysOnlyTheResourcesOfTheRuntime)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2a293fb7-21f3-441f-9531-5155a13bdbad");
+    const iox::RuntimeName_t runtimeToDelete{"guiseppe"};
+    const iox::RuntimeName_t runtimeToKeep{"schlomo"};
+    PublisherOptions publisherOptions{0U, iox::NodeName_t("node"), true};
+    SubscriberOptions subscriberOptions{1U, 0U, iox::NodeName_t("node"), true};
+
+    for (const auto& runtimeName : {runtimeToDelete, runtimeToKeep})
+    {
+        ASSERT_FALSE(m_portManager
+                         ->acquirePublisherPortData(
+                             getUniqueSD(), publisherOptions, runtimeName, m_payloadDataSegmentMemoryManager, {})
+                         .has_error());
+        ASSERT_FALSE(m_portManager->acquireSubscriberPortData(getUniqueSD(), subscriberOptions, runtimeName, {})
+                         .has_error());
+        ASSERT_NE(m_portManager->acquireInterfacePortData(iox::capro::Interfaces::INTERNAL, runtimeName), nullptr);
+        ASSERT_FALSE(m_portManager->acquireConditionVariableData(runtimeName).has_error());
+    }
+
+    m_portManager->deletePortsOfProcess(runtimeToDelete);
+
+    auto& portPool = *m_roudiMemoryManager->portPool().value();
+    ASSERT_THAT(portPool.getPublisherPortDataList().size(), Eq(1U));
+    EXPECT_THAT(portPool.getPublisherPortDataList().begin()->m_runtimeName, Eq(runtimeToKeep));
+    ASSERT_THAT(portPool.getSubscriberPortDataList().size(), Eq(1U));
+    EXPECT_THAT(portPool.getSubscriberPortDataList().begin()->m_runtimeName, Eq(runtimeToKeep));
+    ASSERT_THAT(portPool.getInterfacePortDataList().size(), Eq(1U));
+    EXPECT_THAT(portPool.getInterfacePortDataList().begin()->m_runtimeName, Eq(runtimeToKeep));
+    ASSERT_THAT(portPool.getConditionVariableDataList().size(), Eq(1U));
+    EXPECT_THAT(portPool.getConditionVariableDataList().begin()->m_runtimeName, Eq(runtimeToKeep));
+}
+
 TEST_F(PortManager_test, AcquireInterfacePortDataAfterDestroyingPreviouslyAcquiredOnesIsSuccessful)
 {
     ::testing::Test::RecordProperty("TEST_ID", "0a8a52c8-2c6f-44d3-ab32-0d92f6e285f1");
@@ -791,6 +945,69 @@ TEST_F(PortManager_test, UnblockProcessShutdownUnblocksBlockedPublisher)
                                   [&] { m_portManager->unblockProcessShutdown(publisherRuntimeName); });
 }
 
+TEST_F(PortManager_test, CollectChunkOwnershipAttributesTheHeldChunksToThePorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "291790f3-bd14-4a2f-9c8f-96961f309894");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), true};
+    SubscriberOptions subscriberOptions{1U, 0U, iox::NodeName_t("node"), true};
+    auto publisher = createPublisher(publisherOptions);
+    auto subscriber = createSubscriber(subscriberOptions);
+    m_portManager->doDiscovery();
+    ASSERT_TRUE(publisher.hasSubscribers());
+
+    auto sentChunk = publisher.tryAllocateChunk(42U, 8U);
+    ASSERT_FALSE(sentChunk.has_error());
+    publisher.sendChunk(sentChunk.value());
+    auto loanedChunk = publisher.tryAllocateChunk(42U, 8U);
+    ASSERT_FALSE(loanedChunk.has_error());
+    auto receivedChunk = subscriber.tryGetChunk();
+    ASSERT_FALSE(receivedChunk.has_error());
+
+    const auto memPoolIndex = m_payloadDataSegmentMemoryManager->getMemPoolIndex(loanedChunk.value());
+    ASSERT_TRUE(memPoolIndex.has_value());
+
+    ChunkOwnershipIntrospectionTopic topic;
+    m_portManager->collectChunkOwnership(topic);
+
+    EXPECT_FALSE(topic.m_isTruncated);
+    ASSERT_THAT(topic.m_chunkOwnershipList.size(), Eq(2U));
+
+    // the first segment after the RouDi internal memory is the payload data segment
+    constexpr uint32_t PAYLOAD_DATA_SEGMENT_ID{1U};
+    const auto& publisherEntry = topic.m_chunkOwnershipList[0];
+    EXPECT_THAT(publisherEntry.m_runtimeName, Eq(RuntimeName_t("guiseppe")));
+    EXPECT_THAT(publisherEntry.m_portID, Eq(static_cast<uint64_t>(publisher.getUniqueID())));
+    EXPECT_THAT(publisherEntry.m_segmentId, Eq(PAYLOAD_DATA_SEGMENT_ID));
+    EXPECT_THAT(publisherEntry.m_memPoolIndex, Eq(memPoolIndex.value()));
+    EXPECT_THAT(publisherEntry.m_chunksInUse, Eq(1U));
+    EXPECT_THAT(publisherEntry.m_chunksRetained, Eq(1U));
+
+    const auto& subscriberEntry = topic.m_chunkOwnershipList[1];
+    EXPECT_THAT(subscriberEntry.m_runtimeName, Eq(RuntimeName_t("schlomo")));
+    EXPECT_THAT(subscriberEntry.m_portID, Eq(static_cast<uint64_t>(subscriber.getUniqueID())));
+    EXPECT_THAT(subscriberEntry.m_segmentId, Eq(PAYLOAD_DATA_SEGMENT_ID));
+    EXPECT_THAT(subscriberEntry.m_memPoolIndex, Eq(memPoolIndex.value()));
+    EXPECT_THAT(subscriberEntry.m_chunksInUse, Eq(1U));
+    EXPECT_THAT(subscriberEntry.m_chunksRetained, Eq(0U));
+
+    subscriber.releaseChunk(receivedChunk.value());
+    publisher.releaseChunk(loanedChunk.value());
+}
+
+TEST_F(PortManager_test, CollectChunkOwnershipWithoutHeldChunksHasNoEntries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "288586c4-fecc-406f-a5d2-b559eb58a826");
+    PublisherOptions publisherOptions{0U, iox::NodeName_t("node"), true};
+    auto publisher = createPublisher(publisherOptions);
+    m_portManager->doDiscovery();
+
+    ChunkOwnershipIntrospectionTopic topic;
+    m_portManager->collectChunkOwnership(topic);
+
+    EXPECT_FALSE(topic.m_isTruncated);
+    EXPECT_THAT(topic.m_chunkOwnershipList.size(), Eq(0U));
+}
+
 TEST_F(PortManager_test, PortsDestroyInProcess2ChangeStatesOfPortsInProcess1)
 {
     ::testing::Test::RecordProperty("TEST_ID", "65815512-0298-46b7-9d19-64bc51079c1a");
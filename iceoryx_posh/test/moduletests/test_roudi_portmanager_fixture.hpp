@@ -50,8 +50,8 @@ using iox::runtime::PortConfigInfo;
 class PortManagerTester : public PortManager
 {
   public:
-    PortManagerTester(IceOryxRouDiMemoryManager* roudiMemoryManager)
-        : PortManager(roudiMemoryManager)
+    PortManagerTester(IceOryxRouDiMemoryManager* roudiMemoryManager, const uint32_t numberOfDiscoveryShards = 1U)
+        : PortManager(roudiMemoryManager, numberOfDiscoveryShards)
     {
     }
 
@@ -62,6 +62,9 @@ class PortManagerTester : public PortManager
     FRIEND_TEST(PortManager_test, CreateServerWithOfferOnCreateAddsServerToServiceRegistry);
     FRIEND_TEST(PortManager_test, StopOfferRemovesServerFromServiceRegistry);
     FRIEND_TEST(PortManager_test, OfferAddsServerToServiceRegistry);
+    FRIEND_TEST(PortManager_test, DoDiscoveryWithMultipleShardsDestroysPortsAndRemovesThemFromServiceRegistry);
+    FRIEND_TEST(PortManager_test, CollectChunkOwnershipAttributesTheHeldChunksToThePorts);
+    FRIEND_TEST(PortManager_test, CollectChunkOwnershipWithoutHeldChunksHasNoEntries);
 };
 
 class PortManager_test : public Test
@@ -78,6 +81,8 @@ class PortManager_test : public Test
     vector<iox::capro::ServiceDescription, NUMBER_OF_INTERNAL_PUBLISHERS> internalServices;
     const capro::ServiceDescription serviceRegistry{
         SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_EVENT_NAME};
+    const capro::ServiceDescription serviceRegistryDelta{
+        SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_DELTA_EVENT_NAME};
 
     void SetUp() override
     {
@@ -101,6 +106,14 @@ class PortManager_test : public Test
         m_portManager->deletePortsOfProcess(iox::roudi::IPC_CHANNEL_ROUDI_NAME);
     }
 
+    void recreatePortManagerWithDiscoveryShards(const uint32_t numberOfDiscoveryShards)
+    {
+        delete m_portManager;
+        m_portManager = new PortManagerTester(m_roudiMemoryManager, numberOfDiscoveryShards);
+        m_portManager->stopPortIntrospection();
+        m_portManager->deletePortsOfProcess(iox::roudi::IPC_CHANNEL_ROUDI_NAME);
+    }
+
     void TearDown() override
     {
         delete m_portManager;
@@ -111,9 +124,11 @@ class PortManager_test : public Test
     void addInternalPublisherOfPortManagerToVector()
     {
         internalServices.push_back(serviceRegistry);
+        internalServices.push_back(serviceRegistryDelta);
         internalServices.push_back(IntrospectionPortService);
         internalServices.push_back(IntrospectionPortThroughputService);
         internalServices.push_back(IntrospectionSubscriberPortChangingDataService);
+        internalServices.push_back(IntrospectionChunkOwnershipService);
     }
 
     iox::capro::ServiceDescription getUniqueSD()
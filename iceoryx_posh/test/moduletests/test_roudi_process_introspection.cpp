@@ -134,6 +134,7 @@ TEST_F(ProcessIntrospection_test, addRemoveProcess)
         EXPECT_THAT(chunk2->sample()->m_processList.size(), Eq(1U));
         EXPECT_THAT(chunk2->sample()->m_processList[0].m_pid, Eq(PID));
         EXPECT_THAT(iox::RuntimeName_t(PROCESS_NAME) == chunk2->sample()->m_processList[0].m_name, Eq(true));
+        EXPECT_FALSE(chunk2->sample()->m_processList[0].m_isMonitored);
 
         // list should be empty after removal
         introspectionAccess->removeProcess(PID);
@@ -148,6 +149,38 @@ TEST_F(ProcessIntrospection_test, addRemoveProcess)
     }
 }
 
+TEST_F(ProcessIntrospection_test, MonitoredProcessIsSentWithHeartbeatAgeAlsoWithoutChange)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5d1c1f8e-7a0b-4f52-9b6e-3c4a2e8f91d7");
+    {
+        std::unique_ptr<ProcessIntrospectionAccess> introspectionAccess{new ProcessIntrospectionAccess()};
+        introspectionAccess->registerPublisherPort(std::move(m_mockPublisherPortUserIntrospection));
+
+        const int PID = 42;
+        const char PROCESS_NAME[] = "/chuck_norris";
+        iox::runtime::Heartbeat heartbeat;
+        heartbeat.beat();
+
+        introspectionAccess->addProcess(PID, iox::RuntimeName_t(PROCESS_NAME), &heartbeat);
+        auto chunk1 = createMemoryChunkAndSend(*introspectionAccess);
+        ASSERT_THAT(chunk1, Ne(nullptr));
+        ASSERT_THAT(chunk1->sample()->m_processList.size(), Eq(1U));
+        EXPECT_TRUE(chunk1->sample()->m_processList[0].m_isMonitored);
+
+        constexpr uint64_t SLEEP_TIME_IN_MILLISECONDS{20U};
+        std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_TIME_IN_MILLISECONDS));
+
+        // the list did not change but the heartbeat age did, therefore it is sent again
+        auto chunk2 = createMemoryChunkAndSend(*introspectionAccess);
+        ASSERT_THAT(chunk2, Ne(nullptr));
+        ASSERT_THAT(chunk2->sample()->m_processList.size(), Eq(1U));
+        EXPECT_THAT(chunk2->sample()->m_processList[0].m_heartbeatAgeInMilliseconds, Ge(SLEEP_TIME_IN_MILLISECONDS));
+
+        introspectionAccess->removeProcess(PID);
+        EXPECT_CALL(introspectionAccess->getPublisherPort().value(), stopOffer()).Times(1);
+    }
+}
+
 TEST_F(ProcessIntrospection_test, thread)
 {
     ::testing::Test::RecordProperty("TEST_ID", "3b3419dd-cc3a-4011-bf63-e2a68ab8c20f");
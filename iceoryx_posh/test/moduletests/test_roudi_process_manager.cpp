@@ -138,6 +138,23 @@ TEST_F(ProcessManager_test, RegisterAndUnregisterWorks)
     EXPECT_THAT(m_sut->registeredProcessCount(), Eq(0));
 }
 
+TEST_F(ProcessManager_test, UnregisterProcessKeepsTheOtherProcessesRegistered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7f3d9c2e-1b4a-4e8d-a6f5-2c0b9e7d4a13");
+    const iox::RuntimeName_t otherProcessname{"OtherTestProcess"};
+    IpcInterfaceCreator otherProcessIpcInterface{
+        IpcInterfaceCreator::create(otherProcessname, DEFAULT_DOMAIN_ID, ResourceType::USER_DEFINED)
+            .expect("This should never fail")};
+    m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo);
+    m_sut->registerProcess(otherProcessname, m_pid + 1U, m_user, m_isMonitored, 1U, 1U, m_versionInfo);
+
+    EXPECT_TRUE(m_sut->unregisterProcess(m_processname));
+    EXPECT_FALSE(m_sut->unregisterProcess(m_processname));
+    EXPECT_THAT(m_sut->registeredProcessCount(), Eq(1));
+    EXPECT_TRUE(m_sut->unregisterProcess(otherProcessname));
+    EXPECT_THAT(m_sut->registeredProcessCount(), Eq(0));
+}
+
 TEST_F(ProcessManager_test, HandleProcessShutdownPreparationRequestWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "741669ec-111b-494b-b243-d28510b07782");
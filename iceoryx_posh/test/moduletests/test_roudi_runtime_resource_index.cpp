@@ -0,0 +1,124 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/internal/roudi/runtime_resource_index.hpp"
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+using iox::RuntimeName_t;
+
+struct ResourceMock
+{
+    explicit ResourceMock(const RuntimeName_t& runtimeName)
+        : m_runtimeName(runtimeName)
+    {
+    }
+
+    RuntimeName_t m_runtimeName;
+};
+
+class RuntimeResourceIndex_test : public Test
+{
+  public:
+    RuntimeResourceIndex<ResourceMock> sut;
+    ResourceMock radarPublisher{"Radar"};
+    ResourceMock radarSubscriber{"Radar"};
+    ResourceMock lidarPublisher{"Lidar"};
+};
+
+TEST_F(RuntimeResourceIndex_test, FindInEmptyIndexReturnsNoResources)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b4f33881-6066-446a-a7d5-ec49727bdd26");
+    EXPECT_TRUE(sut.find(radarPublisher.m_runtimeName).empty());
+    EXPECT_THAT(sut.numberOfRuntimes(), Eq(0U));
+}
+
+TEST_F(RuntimeResourceIndex_test, FindReturnsOnlyResourcesOfTheRuntimeInInsertionOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6ab95f6c-4157-4976-b0f3-fc49a4d39681");
+    sut.add(&radarPublisher);
+    sut.add(&lidarPublisher);
+    sut.add(&radarSubscriber);
+
+    const auto& resources = sut.find("Radar");
+
+    ASSERT_THAT(resources.size(), Eq(2U));
+    EXPECT_THAT(resources[0], Eq(&radarPublisher));
+    EXPECT_THAT(resources[1], Eq(&radarSubscriber));
+    EXPECT_THAT(sut.numberOfRuntimes(), Eq(2U));
+}
+
+TEST_F(RuntimeResourceIndex_test, RemoveErasesOnlyTheProvidedResource)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "13752cbd-2442-489b-9185-db3daf442dff");
+    sut.add(&radarPublisher);
+    sut.add(&radarSubscriber);
+
+    sut.remove(&radarPublisher);
+
+    const auto& resources = sut.find(radarPublisher.m_runtimeName);
+    ASSERT_THAT(resources.size(), Eq(1U));
+    EXPECT_THAT(resources[0], Eq(&radarSubscriber));
+}
+
+TEST_F(RuntimeResourceIndex_test, RemovingTheLastResourceOfARuntimeRemovesTheRuntime)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7509f334-628f-4228-a53b-c098002e8bda");
+    sut.add(&radarPublisher);
+    sut.add(&lidarPublisher);
+
+    sut.remove(&lidarPublisher);
+
+    EXPECT_TRUE(sut.find(lidarPublisher.m_runtimeName).empty());
+    EXPECT_THAT(sut.numberOfRuntimes(), Eq(1U));
+}
+
+TEST_F(RuntimeResourceIndex_test, RemovingAResourceWhichWasNotAddedHasNoEffect)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1bd3d930-f585-4620-9c5c-5ff75c665794");
+    sut.add(&radarPublisher);
+
+    sut.remove(&lidarPublisher);
+    sut.remove(&radarSubscriber);
+
+    EXPECT_THAT(sut.find(radarPublisher.m_runtimeName).size(), Eq(1U));
+    EXPECT_THAT(sut.numberOfRuntimes(), Eq(1U));
+}
+
+TEST_F(RuntimeResourceIndex_test, HashOfEqualRuntimeNamesIsEqual)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "39d358ff-8c02-494f-8f83-88f0fac0d0c4");
+    RuntimeNameHash hash;
+
+    EXPECT_THAT(hash(radarPublisher.m_runtimeName), Eq(hash(radarSubscriber.m_runtimeName)));
+    EXPECT_THAT(hash(radarPublisher.m_runtimeName), Ne(hash(lidarPublisher.m_runtimeName)));
+}
+
+TEST_F(RuntimeResourceIndex_test, HashOfRuntimeNameIsTheStringHashOfTheServiceDescription)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b0a8d5a2-61c4-4e3b-9f7d-0c2e5b1f8a93");
+    RuntimeNameHash hash;
+    const iox::capro::IdString_t idString{"radar"};
+    const RuntimeName_t runtimeName{"radar"};
+
+    EXPECT_THAT(hash(runtimeName), Eq(iox::capro::hashIdString(idString)));
+}
+
+} // namespace
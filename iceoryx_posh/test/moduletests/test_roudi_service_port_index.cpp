@@ -0,0 +1,112 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/service_port_index.hpp"
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+using iox::capro::ServiceDescription;
+
+struct PortDataMock
+{
+    explicit PortDataMock(const ServiceDescription& service)
+        : m_serviceDescription(service)
+    {
+    }
+
+    ServiceDescription m_serviceDescription;
+};
+
+class ServicePortIndex_test : public Test
+{
+  public:
+    ServicePortIndex<PortDataMock> sut;
+    PortDataMock radar{{"Radar", "FrontLeft", "Objects"}};
+    PortDataMock otherRadar{{"Radar", "FrontLeft", "Objects"}};
+    PortDataMock lidar{{"Lidar", "FrontLeft", "Objects"}};
+};
+
+TEST_F(ServicePortIndex_test, FindInEmptyIndexReturnsNoPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f6a2d8e-51c4-4b7a-9e0d-8c2f1a6b4d73");
+    EXPECT_TRUE(sut.find(radar.m_serviceDescription).empty());
+    EXPECT_THAT(sut.numberOfServices(), Eq(0U));
+}
+
+TEST_F(ServicePortIndex_test, FindReturnsOnlyPortsWithMatchingServiceInInsertionOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b84e1c0a-6d2f-4f95-a3b7-1e9c5d0f2a68");
+    sut.add(&radar);
+    sut.add(&lidar);
+    sut.add(&otherRadar);
+
+    const auto& ports = sut.find({"Radar", "FrontLeft", "Objects"});
+
+    ASSERT_THAT(ports.size(), Eq(2U));
+    EXPECT_THAT(ports[0], Eq(&radar));
+    EXPECT_THAT(ports[1], Eq(&otherRadar));
+    EXPECT_THAT(sut.numberOfServices(), Eq(2U));
+}
+
+TEST_F(ServicePortIndex_test, RemoveErasesOnlyTheProvidedPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0d5b7e3c-2a9f-4c61-8b4e-7f1a3c9d6e25");
+    sut.add(&radar);
+    sut.add(&otherRadar);
+
+    sut.remove(&radar);
+
+    const auto& ports = sut.find(radar.m_serviceDescription);
+    ASSERT_THAT(ports.size(), Eq(1U));
+    EXPECT_THAT(ports[0], Eq(&otherRadar));
+}
+
+TEST_F(ServicePortIndex_test, RemovingTheLastPortOfAServiceRemovesTheService)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e27c4a91-8f3d-4b0e-a6c5-5d8b2f7e1c04");
+    sut.add(&radar);
+    sut.add(&lidar);
+
+    sut.remove(&lidar);
+
+    EXPECT_TRUE(sut.find(lidar.m_serviceDescription).empty());
+    EXPECT_THAT(sut.numberOfServices(), Eq(1U));
+}
+
+TEST_F(ServicePortIndex_test, RemovingAPortWhichWasNotAddedHasNoEffect)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "71a9d3f5-c0e2-4d8b-9a6f-2b4e8c1d7f30");
+    sut.add(&radar);
+
+    sut.remove(&lidar);
+    sut.remove(&otherRadar);
+
+    EXPECT_THAT(sut.find(radar.m_serviceDescription).size(), Eq(1U));
+    EXPECT_THAT(sut.numberOfServices(), Eq(1U));
+}
+
+TEST_F(ServicePortIndex_test, HashIsThePrecomputedHashOfTheServiceDescription)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9c0f6b2e-4d7a-4e13-b8c5-3a1e9f5d2b87");
+    ServiceDescriptionHash hash;
+
+    EXPECT_THAT(hash(radar.m_serviceDescription), Eq(radar.m_serviceDescription.getHash()));
+}
+
+} // namespace
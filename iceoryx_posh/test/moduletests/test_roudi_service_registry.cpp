@@ -23,6 +23,7 @@
 #include "test.hpp"
 
 #include <chrono>
+#include <memory>
 #include <random>
 #include <vector>
 
@@ -36,6 +37,7 @@ using iox::capro::IdString_t;
 using iox::capro::ServiceDescription;
 using SearchResult_t = std::vector<ServiceRegistry::ServiceDescriptionEntry>;
 
+template <typename Registry>
 struct PublisherTest
 {
     auto add(const ServiceDescription& sd)
@@ -76,9 +78,10 @@ struct PublisherTest
         return &registry;
     }
 
-    iox::roudi::ServiceRegistry registry;
+    Registry registry;
 };
 
+template <typename Registry>
 struct ServerTest
 {
     auto add(const ServiceDescription& sd)
@@ -119,7 +122,7 @@ struct ServerTest
         return &registry;
     }
 
-    iox::roudi::ServiceRegistry registry;
+    Registry registry;
 };
 
 template <typename Sut>
@@ -158,7 +161,11 @@ class ServiceRegistry_test : public Test
 
 constexpr auto CAPACITY = ServiceRegistry::CAPACITY;
 
-typedef ::testing::Types<PublisherTest, ServerTest> TestTypes;
+typedef ::testing::Types<PublisherTest<IndexedServiceRegistry>,
+                         ServerTest<IndexedServiceRegistry>,
+                         PublisherTest<ServiceRegistry>,
+                         ServerTest<ServiceRegistry>>
+    TestTypes;
 
 TYPED_TEST_SUITE(ServiceRegistry_test, TestTypes, );
 
@@ -704,6 +711,74 @@ TYPED_TEST(ServiceRegistry_test, FindWithMixOfPublishersAndServersWorks)
     EXPECT_EQ(filtered[1].serviceDescription, service3);
 }
 
+TYPED_TEST(ServiceRegistry_test, FindWithTwoStringsReturnsOnlyEntriesMatchingBoth)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d2f7a4c1-9e36-4b58-8a0d-5c1e7b3f9a64");
+    iox::capro::ServiceDescription service1("a", "a", "a");
+    iox::capro::ServiceDescription service2("a", "b", "a");
+    iox::capro::ServiceDescription service3("b", "a", "a");
+    iox::capro::ServiceDescription service4("a", "a", "b");
+
+    ASSERT_FALSE(this->sut.add(service1).has_error());
+    ASSERT_FALSE(this->sut.add(service2).has_error());
+    ASSERT_FALSE(this->sut.add(service3).has_error());
+    ASSERT_FALSE(this->sut.add(service4).has_error());
+
+    this->find(iox::capro::IdString_t("a"), iox::capro::IdString_t("a"), iox::capro::Wildcard);
+
+    ASSERT_THAT(this->searchResult.size(), Eq(2U));
+    EXPECT_THAT(this->searchResult[0].serviceDescription, Eq(service1));
+    EXPECT_THAT(this->searchResult[1].serviceDescription, Eq(service4));
+}
+
+TYPED_TEST(ServiceRegistry_test, FindReturnsEntriesInRegistryOrderWhenFreeSlotsAreReused)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7b4e0c2a-5f18-4d93-b6a7-e3c9d1f08b25");
+    iox::capro::ServiceDescription service1("a", "x", "x");
+    iox::capro::ServiceDescription service2("b", "x", "x");
+    iox::capro::ServiceDescription service3("c", "x", "x");
+    iox::capro::ServiceDescription service4("d", "x", "x");
+
+    ASSERT_FALSE(this->sut.add(service1).has_error());
+    ASSERT_FALSE(this->sut.add(service2).has_error());
+    ASSERT_FALSE(this->sut.add(service3).has_error());
+    this->sut.remove(service1);
+    ASSERT_FALSE(this->sut.add(service4).has_error());
+
+    this->find(iox::capro::Wildcard, iox::capro::IdString_t("x"), iox::capro::Wildcard);
+
+    SearchResult_t allEntries;
+    this->sut->forEach(
+        [&](const ServiceRegistry::ServiceDescriptionEntry& entry) { allEntries.push_back(entry); });
+    ASSERT_THAT(this->searchResult.size(), Eq(3U));
+    ASSERT_THAT(allEntries.size(), Eq(3U));
+    for (uint64_t i = 0U; i < allEntries.size(); ++i)
+    {
+        EXPECT_THAT(this->searchResult[i].serviceDescription, Eq(allEntries[i].serviceDescription));
+    }
+}
+
+TEST(IndexedServiceRegistry_test, PublishedRegistryFindsTheSameEntries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a0c6e9f3-2d71-4b8e-95f4-6e2b8d7c1a39");
+    iox::capro::ServiceDescription service1("a", "b", "c");
+    iox::capro::ServiceDescription service2("a", "d", "e");
+
+    std::unique_ptr<IndexedServiceRegistry> sut{new IndexedServiceRegistry};
+    ASSERT_FALSE(sut->addPublisher(service1).has_error());
+    ASSERT_FALSE(sut->addServer(service2).has_error());
+
+    std::unique_ptr<ServiceRegistry> copy{new ServiceRegistry(sut->registry())};
+    SearchResult_t result;
+    copy->find(iox::capro::IdString_t("a"),
+               iox::capro::IdString_t("d"),
+               iox::capro::IdString_t("e"),
+               [&](const ServiceRegistry::ServiceDescriptionEntry& entry) { result.push_back(entry); });
+
+    ASSERT_THAT(result.size(), Eq(1U));
+    EXPECT_THAT(result[0].serviceDescription, Eq(service2));
+}
+
 TYPED_TEST(ServiceRegistry_test, HasDataChangedSinceLastCallReturnsTrueOnInitialCall)
 {
     ::testing::Test::RecordProperty("TEST_ID", "51398abb-53b2-4dce-9267-73f02f9d7574");
@@ -0,0 +1,201 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry_delta.hpp"
+
+#include "test.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+using iox::capro::ServiceDescription;
+
+class ServiceRegistryDelta_test : public Test
+{
+  public:
+    // the registries are too large for the stack
+    std::unique_ptr<ServiceRegistry> m_roudiRegistry{new ServiceRegistry};
+    std::unique_ptr<ServiceRegistry> m_discoveryRegistry{new ServiceRegistry};
+    ServiceRegistryDelta m_delta{m_roudiRegistry->changeCounter()};
+
+    void addPublisher(const ServiceDescription& service)
+    {
+        ASSERT_TRUE(m_delta.record(ServiceRegistryDelta::Operation::ADD_PUBLISHER, service));
+        ASSERT_FALSE(m_roudiRegistry->addPublisher(service).has_error());
+    }
+
+    void removePublisher(const ServiceDescription& service)
+    {
+        ASSERT_TRUE(m_delta.record(ServiceRegistryDelta::Operation::REMOVE_PUBLISHER, service));
+        m_roudiRegistry->removePublisher(service);
+    }
+
+    void addServer(const ServiceDescription& service)
+    {
+        ASSERT_TRUE(m_delta.record(ServiceRegistryDelta::Operation::ADD_SERVER, service));
+        ASSERT_FALSE(m_roudiRegistry->addServer(service).has_error());
+    }
+
+    void finishDelta()
+    {
+        m_delta.setChangeCounter(m_roudiRegistry->changeCounter());
+    }
+
+    static std::vector<ServiceRegistry::ServiceDescriptionEntry> content(const ServiceRegistry& registry)
+    {
+        std::vector<ServiceRegistry::ServiceDescriptionEntry> entries;
+        registry.forEach([&](const auto& entry) { entries.emplace_back(entry); });
+        return entries;
+    }
+
+    static void expectEqual(const ServiceRegistry& lhs, const ServiceRegistry& rhs)
+    {
+        EXPECT_THAT(lhs.changeCounter(), Eq(rhs.changeCounter()));
+
+        const auto lhsEntries = content(lhs);
+        const auto rhsEntries = content(rhs);
+        ASSERT_THAT(lhsEntries.size(), Eq(rhsEntries.size()));
+        for (uint64_t i = 0U; i < lhsEntries.size(); ++i)
+        {
+            EXPECT_THAT(lhsEntries[i].serviceDescription, Eq(rhsEntries[i].serviceDescription));
+            EXPECT_THAT(lhsEntries[i].publisherCount, Eq(rhsEntries[i].publisherCount));
+            EXPECT_THAT(lhsEntries[i].serverCount, Eq(rhsEntries[i].serverCount));
+        }
+    }
+};
+
+TEST_F(ServiceRegistryDelta_test, ChangeCounterIsIncreasedWithEveryModification)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f0c9e52-7a1d-4b68-9e2f-5c4d8a1b6e07");
+    const ServiceDescription service{"Ferdinand", "Spitz", "Schnüffler"};
+    const auto initialChangeCounter = m_roudiRegistry->changeCounter();
+
+    ASSERT_FALSE(m_roudiRegistry->addPublisher(service).has_error());
+    ASSERT_FALSE(m_roudiRegistry->addPublisher(service).has_error());
+    m_roudiRegistry->removePublisher(service);
+
+    EXPECT_THAT(m_roudiRegistry->changeCounter(), Eq(initialChangeCounter + 3U));
+}
+
+TEST_F(ServiceRegistryDelta_test, EmptyDeltaCanBeAppliedToRegistryWithSameChangeCounter)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b61e2d47-0c8f-4a93-8d15-e2a7f3c90b64");
+    finishDelta();
+
+    EXPECT_TRUE(m_delta.isComplete());
+    EXPECT_TRUE(m_delta.applyTo(*m_discoveryRegistry));
+    expectEqual(*m_discoveryRegistry, *m_roudiRegistry);
+}
+
+TEST_F(ServiceRegistryDelta_test, AppliedDeltaResultsInSameRegistry)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7c2a5f18-d9e4-4b07-a3c6-1f8e0d5b2a93");
+    const ServiceDescription service1{"Ferdinand", "Spitz", "Schnüffler"};
+    const ServiceDescription service2{"Ferdinand", "Spitz", "Kläffer"};
+    const ServiceDescription service3{"Hypnotoad", "All", "Glory"};
+
+    addPublisher(service1);
+    addPublisher(service1);
+    addPublisher(service2);
+    addServer(service3);
+    removePublisher(service1);
+    removePublisher(service2);
+    finishDelta();
+
+    EXPECT_THAT(m_delta.previousChangeCounter(), Eq(m_discoveryRegistry->changeCounter()));
+    EXPECT_TRUE(m_delta.applyTo(*m_discoveryRegistry));
+    expectEqual(*m_discoveryRegistry, *m_roudiRegistry);
+}
+
+TEST_F(ServiceRegistryDelta_test, ConsecutiveDeltasResultInSameRegistry)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e4d93b06-58a2-4f1c-b7e0-9a6c2d3f8e15");
+    const ServiceDescription service1{"Ferdinand", "Spitz", "Schnüffler"};
+    const ServiceDescription service2{"Hypnotoad", "All", "Glory"};
+
+    addPublisher(service1);
+    addServer(service2);
+    finishDelta();
+    ASSERT_TRUE(m_delta.applyTo(*m_discoveryRegistry));
+
+    m_delta.reset(m_roudiRegistry->changeCounter());
+    removePublisher(service1);
+    finishDelta();
+
+    EXPECT_TRUE(m_delta.applyTo(*m_discoveryRegistry));
+    expectEqual(*m_discoveryRegistry, *m_roudiRegistry);
+}
+
+TEST_F(ServiceRegistryDelta_test, DeltaIsNotAppliedToRegistryWithOtherChangeCounter)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1a8f6c3d-2e5b-4d90-8f47-c3b1e9a07d26");
+    const ServiceDescription service1{"Ferdinand", "Spitz", "Schnüffler"};
+    const ServiceDescription service2{"Hypnotoad", "All", "Glory"};
+
+    addPublisher(service1);
+    finishDelta();
+    // the ServiceDiscovery missed this delta
+    m_delta.reset(m_roudiRegistry->changeCounter());
+    addPublisher(service2);
+    finishDelta();
+
+    EXPECT_FALSE(m_delta.applyTo(*m_discoveryRegistry));
+    EXPECT_THAT(content(*m_discoveryRegistry).size(), Eq(0U));
+}
+
+TEST_F(ServiceRegistryDelta_test, OverflowMakesTheDeltaIncomplete)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9d4b2e71-6f3a-4c85-a0d9-5e7f1b8c3a42");
+    const ServiceDescription service{"Ferdinand", "Spitz", "Schnüffler"};
+
+    for (uint32_t i = 0U; i < ServiceRegistryDelta::CAPACITY; ++i)
+    {
+        addPublisher(service);
+    }
+    EXPECT_TRUE(m_delta.isComplete());
+
+    EXPECT_FALSE(m_delta.record(ServiceRegistryDelta::Operation::ADD_PUBLISHER, service));
+    EXPECT_FALSE(m_delta.isComplete());
+    finishDelta();
+
+    EXPECT_FALSE(m_delta.applyTo(*m_discoveryRegistry));
+    EXPECT_THAT(content(*m_discoveryRegistry).size(), Eq(0U));
+}
+
+TEST_F(ServiceRegistryDelta_test, ResetMakesTheDeltaCompleteAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5b0e7a93-c1d6-4f28-9b3e-8a2d4f6c0e17");
+    const ServiceDescription service{"Ferdinand", "Spitz", "Schnüffler"};
+
+    for (uint32_t i = 0U; i <= ServiceRegistryDelta::CAPACITY; ++i)
+    {
+        IOX_DISCARD_RESULT(m_delta.record(ServiceRegistryDelta::Operation::ADD_PUBLISHER, service));
+    }
+    ASSERT_FALSE(m_delta.isComplete());
+
+    m_delta.reset(42U);
+
+    EXPECT_TRUE(m_delta.isComplete());
+    EXPECT_THAT(m_delta.previousChangeCounter(), Eq(42U));
+    EXPECT_THAT(m_delta.changeCounter(), Eq(42U));
+}
+
+} // namespace
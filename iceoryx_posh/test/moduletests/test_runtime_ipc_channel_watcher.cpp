@@ -0,0 +1,73 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#if defined(__linux__)
+#include "iceoryx_posh/internal/runtime/ipc_channel_watcher.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_interface_creator.hpp"
+
+#include "test.hpp"
+
+#include <chrono>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::runtime;
+using namespace iox::units::duration_literals;
+
+constexpr char channelName[] = "watched_channel";
+
+class IpcChannelWatcher_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        EXPECT_FALSE(platform::IoxIpcChannelType::unlinkIfExists(channelName).has_error());
+    }
+};
+
+TEST_F(IpcChannelWatcher_test, DirectoryOfIpcChannelsIsWatched)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9c1f4e7a-2b58-4d06-a3e9-71d5c0b8f264");
+    IpcChannelWatcher sut;
+
+    EXPECT_TRUE(sut.isWatching());
+}
+
+TEST_F(IpcChannelWatcher_test, CreationOfIpcChannelWakesUpWaitForChange)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e4a7b2d9-6f13-4c85-9e0a-3d8c5f1b7a42");
+    IpcChannelWatcher sut;
+    ASSERT_TRUE(sut.isWatching());
+
+    std::thread creator([] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        auto channel = IpcInterfaceCreator::create(channelName, DEFAULT_DOMAIN_ID, ResourceType::USER_DEFINED);
+        EXPECT_FALSE(channel.has_error());
+    });
+
+    const auto start = std::chrono::steady_clock::now();
+    sut.waitForChange(10_s);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    creator.join();
+
+    EXPECT_THAT(std::chrono::duration_cast<std::chrono::seconds>(elapsed).count(), Lt(5));
+}
+
+} // namespace
+#endif
@@ -0,0 +1,249 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/request_channel.hpp"
+
+#include "test.hpp"
+
+#include <memory>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::runtime;
+using namespace iox::units::duration_literals;
+
+class RequestChannel_test : public Test
+{
+  public:
+    RequestChannel& acquireChannel(const RuntimeName_t& runtimeName)
+    {
+        auto channel = m_sut->acquire(runtimeName);
+        EXPECT_TRUE(channel.has_value());
+        return *channel.value();
+    }
+
+    // the pool is too large for the stack
+    std::unique_ptr<RequestChannelPool> m_sut{new RequestChannelPool()};
+};
+
+TEST_F(RequestChannel_test, AcquiredChannelIsOwnedByTheRuntime)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cd5246cd-47df-4754-be41-a18fa0ef785f");
+    auto& channel = acquireChannel("Brain");
+
+    EXPECT_THAT(channel.getRuntimeName(), Eq(RuntimeName_t("Brain")));
+}
+
+TEST_F(RequestChannel_test, AcquireFailsWhenAllChannelsAreInUse)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e230fe6e-fc0e-4947-9638-b149911c02c6");
+    for (uint32_t i = 0U; i < MAX_PROCESS_NUMBER; ++i)
+    {
+        ASSERT_TRUE(m_sut->acquire("Pinky").has_value());
+    }
+
+    EXPECT_FALSE(m_sut->acquire("Pinky").has_value());
+}
+
+TEST_F(RequestChannel_test, ReleasedChannelCanBeAcquiredAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "22e4f9e3-b786-45a4-a2d8-0729018581ef");
+    for (uint32_t i = 0U; i < MAX_PROCESS_NUMBER - 1U; ++i)
+    {
+        ASSERT_TRUE(m_sut->acquire("Pinky").has_value());
+    }
+    auto& channel = acquireChannel("Pinky");
+
+    m_sut->release(channel);
+
+    auto reacquiredChannel = m_sut->acquire("Brain");
+    ASSERT_TRUE(reacquiredChannel.has_value());
+    EXPECT_THAT(reacquiredChannel.value(), Eq(&channel));
+    EXPECT_THAT(channel.getRuntimeName(), Eq(RuntimeName_t("Brain")));
+}
+
+TEST_F(RequestChannel_test, WaitForRequestWithoutRequestTimesOut)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "245d9112-e3ca-4a9b-9d3c-c5cab72f6b62");
+    IOX_DISCARD_RESULT(acquireChannel("Brain"));
+
+    EXPECT_FALSE(m_sut->waitForRequest(1_ms).has_value());
+}
+
+TEST_F(RequestChannel_test, RequestIsTransferredToRouDiAndResponseBackToTheApplication)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "da84566a-2133-4be1-81c2-2f4c9919e1c3");
+    auto& channel = acquireChannel("Brain");
+
+    IpcMessage answer;
+    bool hasReceivedAnswer{false};
+    std::thread application([&] {
+        IpcMessage request;
+        request << "CREATE_PUBLISHER"
+                << "Brain";
+        hasReceivedAnswer = channel.sendRequest(request, answer);
+    });
+
+    auto requestChannel = m_sut->waitForRequest(10_s);
+    ASSERT_TRUE(requestChannel.has_value());
+    EXPECT_THAT(requestChannel.value(), Eq(&channel));
+    auto request = requestChannel.value()->takeRequest();
+    ASSERT_TRUE(request.has_value());
+    EXPECT_THAT(request->getElementAtIndex(0U), Eq("CREATE_PUBLISHER"));
+    EXPECT_THAT(request->getElementAtIndex(1U), Eq("Brain"));
+
+    IpcMessage response;
+    response << "CREATE_PUBLISHER_ACK" << 42;
+    EXPECT_TRUE(requestChannel.value()->sendResponse(response));
+    application.join();
+
+    EXPECT_TRUE(hasReceivedAnswer);
+    EXPECT_THAT(answer.getNumberOfElements(), Eq(2U));
+    EXPECT_THAT(answer.getElementAtIndex(0U), Eq("CREATE_PUBLISHER_ACK"));
+    EXPECT_THAT(answer.getElementAtIndex(1U), Eq("42"));
+}
+
+TEST_F(RequestChannel_test, FinishRequestWithoutResponseUnblocksTheApplicationWithEmptyResponse)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "53941d9d-5502-4bb9-8a28-cc1f720fe31b");
+    auto& channel = acquireChannel("Brain");
+
+    IpcMessage answer("NOT_EMPTY,");
+    std::thread application([&] {
+        IpcMessage request;
+        request << "UNKNOWN"
+                << "Brain";
+        EXPECT_TRUE(channel.sendRequest(request, answer));
+    });
+
+    auto requestChannel = m_sut->waitForRequest(10_s);
+    ASSERT_TRUE(requestChannel.has_value());
+    ASSERT_TRUE(requestChannel.value()->takeRequest().has_value());
+    requestChannel.value()->finishRequest();
+    application.join();
+
+    EXPECT_THAT(answer.getNumberOfElements(), Eq(0U));
+}
+
+TEST_F(RequestChannel_test, SendResponseWithoutTakenRequestFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "56ee55f3-ee5a-4463-ab6f-ce1f0bea2f6a");
+    auto& channel = acquireChannel("Brain");
+
+    EXPECT_FALSE(channel.takeRequest().has_value());
+    EXPECT_FALSE(channel.sendResponse(IpcMessage("TERMINATION_ACK,")));
+}
+
+TEST_F(RequestChannel_test, SendRequestWhichExceedsTheMessageSizeFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b7f257d5-3f83-4e98-bf0e-291c224f964c");
+    auto& channel = acquireChannel("Brain");
+
+    IpcMessage request;
+    request << std::string(REQUEST_CHANNEL_MESSAGE_SIZE, 'x');
+    IpcMessage answer;
+
+    EXPECT_FALSE(channel.sendRequest(request, answer));
+    EXPECT_FALSE(m_sut->waitForRequest(1_ms).has_value());
+}
+
+TEST_F(RequestChannel_test, RequestAndResponseWhichExceedTheIpcChannelMessageSizeAreTransferred)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0b6f3e9d-7c21-4d58-a4e3-5f8b2c1d9e67");
+    auto& channel = acquireChannel("Brain");
+    const std::string largeEntry(ROUDI_MESSAGE_SIZE, 'x');
+
+    IpcMessage answer;
+    bool hasReceivedAnswer{false};
+    std::thread application([&] {
+        IpcMessage request;
+        request << "CREATE_PUBLISHER" << largeEntry;
+        hasReceivedAnswer = channel.sendRequest(request, answer);
+    });
+
+    auto requestChannel = m_sut->waitForRequest(10_s);
+    ASSERT_TRUE(requestChannel.has_value());
+    auto request = requestChannel.value()->takeRequest();
+    ASSERT_TRUE(request.has_value());
+    EXPECT_TRUE(request->isValid());
+    EXPECT_THAT(request->getElementAtIndex(1U), Eq(largeEntry));
+
+    IpcMessage response;
+    response << "CREATE_PUBLISHER_ACK" << largeEntry;
+    EXPECT_TRUE(requestChannel.value()->sendResponse(response));
+    application.join();
+
+    EXPECT_TRUE(hasReceivedAnswer);
+    EXPECT_THAT(answer.getNumberOfElements(), Eq(2U));
+    EXPECT_THAT(answer.getElementAtIndex(1U), Eq(largeEntry));
+}
+
+
+TEST_F(RequestChannel_test, RequestWithoutResponseIsWithdrawnAfterTheTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4f1c8e2a-9b3d-4a67-8e5f-2c7d1b9a6e30");
+    auto& channel = acquireChannel("Brain");
+
+    IpcMessage request;
+    request << "CREATE_PUBLISHER"
+            << "Brain";
+    IpcMessage answer;
+
+    EXPECT_FALSE(channel.sendRequest(request, answer, 1_ms));
+
+    // the outdated index is still in the queue but the withdrawn request cannot be taken
+    auto requestChannel = m_sut->waitForRequest(1_ms);
+    ASSERT_TRUE(requestChannel.has_value());
+    EXPECT_FALSE(requestChannel.value()->takeRequest().has_value());
+}
+
+TEST_F(RequestChannel_test, RequestWhichTimesOutWhileItIsProcessedIsAbandoned)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a8d3b6f1-2e7c-4c95-b0a4-6f9e3d1c5b72");
+    auto& channel = acquireChannel("Brain");
+
+    IpcMessage request;
+    request << "CREATE_PUBLISHER"
+            << "Brain";
+    std::thread application([&] {
+        IpcMessage answer;
+        EXPECT_FALSE(channel.sendRequest(request, answer, 500_ms));
+    });
+
+    auto requestChannel = m_sut->waitForRequest(10_s);
+    ASSERT_TRUE(requestChannel.has_value());
+    ASSERT_TRUE(requestChannel.value()->takeRequest().has_value());
+    application.join();
+
+    EXPECT_FALSE(requestChannel.value()->sendResponse(IpcMessage("CREATE_PUBLISHER_ACK,")));
+
+    // the abandoned request does not block the next request
+    application = std::thread([&] {
+        IpcMessage answer;
+        EXPECT_TRUE(channel.sendRequest(request, answer));
+        EXPECT_THAT(answer.getElementAtIndex(0U), Eq("CREATE_PUBLISHER_ACK"));
+    });
+    requestChannel = m_sut->waitForRequest(10_s);
+    ASSERT_TRUE(requestChannel.has_value());
+    ASSERT_TRUE(requestChannel.value()->takeRequest().has_value());
+    EXPECT_TRUE(requestChannel.value()->sendResponse(IpcMessage("CREATE_PUBLISHER_ACK,")));
+    application.join();
+}
+
+} // namespace
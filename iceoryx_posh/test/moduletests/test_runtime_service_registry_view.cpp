@@ -0,0 +1,300 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry_delta.hpp"
+#include "iceoryx_posh/internal/runtime/service_registry_view.hpp"
+#include "iox/unique_ptr.hpp"
+
+#include "test.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+using iox::nullopt;
+using iox::capro::IdString_t;
+using iox::capro::ServiceDescription;
+using iox::runtime::ServiceRegistryView;
+
+using Content_t = std::map<ServiceDescription, std::pair<uint64_t, uint64_t>>;
+
+class ServiceRegistryView_test : public Test
+{
+  public:
+    // declared before the view since the view releases its snapshot on destruction
+    const ServiceRegistry* m_snapshotRegistry{nullptr};
+    uint64_t m_numberOfHeldSnapshots{0U};
+
+    // the registries are too large for the stack
+    std::unique_ptr<ServiceRegistry> m_roudiRegistry{new ServiceRegistry};
+    std::unique_ptr<ServiceRegistryView> m_sut{new ServiceRegistryView};
+    ServiceRegistryDelta m_delta{0U};
+
+    void publishSnapshot()
+    {
+        auto* snapshot = new ServiceRegistry(*m_roudiRegistry);
+        m_snapshotRegistry = snapshot;
+        ++m_numberOfHeldSnapshots;
+        auto deleter = [this](const ServiceRegistry* registry) {
+            --m_numberOfHeldSnapshots;
+            delete registry;
+        };
+        m_sut->setSnapshot(ServiceRegistryView::Snapshot_t(iox::unique_ptr<const ServiceRegistry>(snapshot, deleter)));
+        m_delta.reset(m_roudiRegistry->changeCounter());
+    }
+
+    bool publishDelta()
+    {
+        m_delta.setChangeCounter(m_roudiRegistry->changeCounter());
+        const bool isApplied = m_sut->apply(m_delta);
+        m_delta.reset(m_roudiRegistry->changeCounter());
+        return isApplied;
+    }
+
+    void addPublisher(const ServiceDescription& service)
+    {
+        ASSERT_TRUE(m_delta.record(ServiceRegistryDelta::Operation::ADD_PUBLISHER, service));
+        IOX_DISCARD_RESULT(m_roudiRegistry->addPublisher(service));
+    }
+
+    void removePublisher(const ServiceDescription& service)
+    {
+        ASSERT_TRUE(m_delta.record(ServiceRegistryDelta::Operation::REMOVE_PUBLISHER, service));
+        m_roudiRegistry->removePublisher(service);
+    }
+
+    void addServer(const ServiceDescription& service)
+    {
+        ASSERT_TRUE(m_delta.record(ServiceRegistryDelta::Operation::ADD_SERVER, service));
+        IOX_DISCARD_RESULT(m_roudiRegistry->addServer(service));
+    }
+
+    void removeServer(const ServiceDescription& service)
+    {
+        ASSERT_TRUE(m_delta.record(ServiceRegistryDelta::Operation::REMOVE_SERVER, service));
+        m_roudiRegistry->removeServer(service);
+    }
+
+    static ServiceDescription service(const uint64_t id)
+    {
+        return ServiceDescription{IdString_t(iox::TruncateToCapacity, std::to_string(id % 7U).c_str()),
+                                  IdString_t(iox::TruncateToCapacity, std::to_string(id).c_str()),
+                                  "Event"};
+    }
+
+    static Content_t content(const ServiceRegistry& registry,
+                             const iox::optional<IdString_t>& service = nullopt,
+                             const iox::optional<IdString_t>& instance = nullopt)
+    {
+        Content_t result;
+        registry.find(service, instance, nullopt, [&](const ServiceRegistry::ServiceDescriptionEntry& entry) {
+            result[entry.serviceDescription] = {entry.publisherCount, entry.serverCount};
+        });
+        return result;
+    }
+
+    Content_t viewContent(const iox::optional<IdString_t>& service = nullopt,
+                          const iox::optional<IdString_t>& instance = nullopt)
+    {
+        Content_t result;
+        uint64_t numberOfCallbacks{0U};
+        m_sut->find(service, instance, nullopt, [&](const ServiceRegistry::ServiceDescriptionEntry& entry) {
+            result[entry.serviceDescription] = {entry.publisherCount, entry.serverCount};
+            ++numberOfCallbacks;
+        });
+        EXPECT_THAT(numberOfCallbacks, Eq(result.size()));
+        return result;
+    }
+};
+
+TEST_F(ServiceRegistryView_test, InitialViewIsEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4e1b7c92-3a5d-4f08-b6e1-9c2d0a7f5e34");
+    EXPECT_THAT(m_sut->changeCounter(), Eq(0U));
+    EXPECT_TRUE(viewContent().empty());
+}
+
+TEST_F(ServiceRegistryView_test, SnapshotIsSearchedInPlace)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a2f6d813-5c7e-4b90-8d4a-1e3f6b9c0d27");
+    ASSERT_FALSE(m_roudiRegistry->addPublisher(service(1U)).has_error());
+    ASSERT_FALSE(m_roudiRegistry->addServer(service(2U)).has_error());
+    publishSnapshot();
+
+    const ServiceRegistry::ServiceDescriptionEntry* foundEntry{nullptr};
+    m_sut->find(service(1U).getServiceIDString(),
+                service(1U).getInstanceIDString(),
+                service(1U).getEventIDString(),
+                [&](const ServiceRegistry::ServiceDescriptionEntry& entry) { foundEntry = &entry; });
+
+    ASSERT_THAT(foundEntry, Ne(nullptr));
+    const auto* snapshotBegin = reinterpret_cast<const uint8_t*>(m_snapshotRegistry);
+    const auto* entryAddress = reinterpret_cast<const uint8_t*>(foundEntry);
+    EXPECT_TRUE(entryAddress >= snapshotBegin && entryAddress < snapshotBegin + sizeof(ServiceRegistry));
+    EXPECT_THAT(m_sut->changeCounter(), Eq(m_roudiRegistry->changeCounter()));
+    EXPECT_THAT(viewContent(), Eq(content(*m_roudiRegistry)));
+}
+
+TEST_F(ServiceRegistryView_test, DeltasOnTopOfSnapshotResultInContentOfRegistry)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6c8e0f24-9b1a-4d37-a5e2-7f4c3b8d1a90");
+    for (uint64_t i = 0U; i < 10U; ++i)
+    {
+        ASSERT_FALSE(m_roudiRegistry->addPublisher(service(i)).has_error());
+    }
+    publishSnapshot();
+
+    addPublisher(service(3U));
+    removePublisher(service(4U));
+    addServer(service(5U));
+    addPublisher(service(20U));
+    removePublisher(service(21U));
+    ASSERT_TRUE(publishDelta());
+
+    removePublisher(service(3U));
+    removeServer(service(5U));
+    addServer(service(22U));
+    ASSERT_TRUE(publishDelta());
+
+    EXPECT_THAT(m_sut->changeCounter(), Eq(m_roudiRegistry->changeCounter()));
+    EXPECT_THAT(viewContent(), Eq(content(*m_roudiRegistry)));
+    EXPECT_THAT(viewContent(service(20U).getServiceIDString()),
+                Eq(content(*m_roudiRegistry, service(20U).getServiceIDString())));
+    EXPECT_THAT(viewContent(nullopt, service(4U).getInstanceIDString()),
+                Eq(content(*m_roudiRegistry, nullopt, service(4U).getInstanceIDString())));
+}
+
+TEST_F(ServiceRegistryView_test, RemovedServiceOfSnapshotIsNotFound)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d05a3e71-2f8c-4b6d-9e14-8c7b2a5f3d06");
+    ASSERT_FALSE(m_roudiRegistry->addPublisher(service(1U)).has_error());
+    ASSERT_FALSE(m_roudiRegistry->addPublisher(service(2U)).has_error());
+    publishSnapshot();
+
+    removePublisher(service(1U));
+    ASSERT_TRUE(publishDelta());
+
+    const auto result = viewContent();
+    EXPECT_THAT(result.size(), Eq(1U));
+    EXPECT_THAT(result.count(service(1U)), Eq(0U));
+}
+
+TEST_F(ServiceRegistryView_test, DeltaWithOtherPreviousChangeCounterIsRejected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "81b4c6e9-7d3f-4a52-b0c8-e6a1f9d2c347");
+    publishSnapshot();
+    addPublisher(service(1U));
+    m_delta.setChangeCounter(m_roudiRegistry->changeCounter());
+    // the view missed this delta
+    m_delta.reset(m_roudiRegistry->changeCounter());
+
+    addPublisher(service(2U));
+    EXPECT_FALSE(publishDelta());
+    EXPECT_TRUE(viewContent().empty());
+}
+
+TEST_F(ServiceRegistryView_test, ManyDeltasOnTopOfSnapshotResultInContentOfRegistry)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f3e9a1c5-0b7d-4e26-8f93-2d5c7a4b6e18");
+    for (uint64_t i = 0U; i < 10U; ++i)
+    {
+        ASSERT_FALSE(m_roudiRegistry->addPublisher(service(i)).has_error());
+    }
+    publishSnapshot();
+
+    constexpr uint64_t NUMBER_OF_DELTAS{ServiceRegistryDelta::SNAPSHOT_INTERVAL};
+    uint64_t id{5U};
+    for (uint64_t i = 0U; i < NUMBER_OF_DELTAS; ++i)
+    {
+        for (uint64_t k = 0U; k < ServiceRegistryDelta::CAPACITY / 2U; ++k)
+        {
+            addPublisher(service(id));
+            removePublisher(service(id - 5U));
+            ++id;
+        }
+        ASSERT_TRUE(publishDelta());
+    }
+
+    EXPECT_THAT(m_sut->changeCounter(), Eq(m_roudiRegistry->changeCounter()));
+    EXPECT_THAT(viewContent(), Eq(content(*m_roudiRegistry)));
+}
+
+TEST_F(ServiceRegistryView_test, NewSnapshotReplacesAppliedDeltas)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2b7d5f08-e4c1-4a9b-93d6-0f8e1c3a5b72");
+    publishSnapshot();
+    addPublisher(service(1U));
+    ASSERT_TRUE(publishDelta());
+
+    ASSERT_FALSE(m_roudiRegistry->addServer(service(2U)).has_error());
+    m_roudiRegistry->removePublisher(service(1U));
+    publishSnapshot();
+
+    EXPECT_THAT(m_sut->changeCounter(), Eq(m_roudiRegistry->changeCounter()));
+    EXPECT_THAT(viewContent(), Eq(content(*m_roudiRegistry)));
+}
+
+TEST_F(ServiceRegistryView_test, NewSnapshotReleasesThePreviousSnapshot)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9d4f2a71-6c3e-4b85-a1f0-5e8b7c2d9a46");
+    publishSnapshot();
+    addPublisher(service(1U));
+    ASSERT_TRUE(publishDelta());
+    publishSnapshot();
+
+    EXPECT_THAT(m_numberOfHeldSnapshots, Eq(1U));
+    m_sut.reset();
+    EXPECT_THAT(m_numberOfHeldSnapshots, Eq(0U));
+}
+
+TEST_F(ServiceRegistryView_test, DeltaWhichExceedsTheOverlayIsRejectedUntilTheNextSnapshot)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c1e7b3d9-4a2f-4e68-b5c0-8f3a6d1e7b24");
+    publishSnapshot();
+
+    uint64_t id{0U};
+    const auto addDistinctPublishers = [&] {
+        for (uint64_t k = 0U; k < ServiceRegistryDelta::CAPACITY; ++k)
+        {
+            addPublisher(service(id));
+            ++id;
+        }
+    };
+    for (uint64_t i = 0U; i < ServiceRegistryView::OVERLAY_CAPACITY / ServiceRegistryDelta::CAPACITY; ++i)
+    {
+        addDistinctPublishers();
+        ASSERT_TRUE(publishDelta());
+    }
+    const auto changeCounterBeforeRejection = m_roudiRegistry->changeCounter();
+    const auto contentBeforeRejection = content(*m_roudiRegistry);
+
+    addDistinctPublishers();
+    EXPECT_FALSE(publishDelta());
+    EXPECT_THAT(m_sut->changeCounter(), Eq(changeCounterBeforeRejection));
+    EXPECT_THAT(viewContent(), Eq(contentBeforeRejection));
+
+    publishSnapshot();
+    EXPECT_THAT(m_sut->changeCounter(), Eq(m_roudiRegistry->changeCounter()));
+    EXPECT_THAT(viewContent(), Eq(content(*m_roudiRegistry)));
+}
+
+} // namespace
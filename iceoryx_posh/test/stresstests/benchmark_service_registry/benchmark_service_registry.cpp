@@ -0,0 +1,122 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iox/optional.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+
+using iox::capro::IdString_t;
+using iox::roudi::IndexedServiceRegistry;
+
+namespace
+{
+constexpr uint64_t NUMBER_OF_SERVICES{10000U};
+constexpr uint64_t NUMBER_OF_INSTANCES{100U};
+constexpr uint64_t NUMBER_OF_EVENTS{10U};
+constexpr uint64_t NUMBER_OF_LOOKUPS{100000U};
+
+IdString_t idString(const char* prefix, const uint64_t number)
+{
+    return IdString_t(iox::TruncateToCapacity, (std::string(prefix) + std::to_string(number)).c_str());
+}
+
+template <typename Lookup>
+void benchmark(const char* name, const uint64_t numberOfLookups, Lookup lookup)
+{
+    uint64_t numberOfMatches{0U};
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0U; i < numberOfLookups; ++i)
+    {
+        numberOfMatches += lookup(i);
+    }
+    auto end = std::chrono::steady_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::setw(10) << duration / static_cast<int64_t>(numberOfLookups) << " (nanosecs/lookup) : "
+              << std::setw(10) << numberOfMatches / numberOfLookups << " (matches/lookup) : " << name << std::endl;
+}
+} // namespace
+
+int main()
+{
+    // one slot is kept free for the add and remove benchmark
+    const uint64_t numberOfServices = std::min<uint64_t>(NUMBER_OF_SERVICES, IndexedServiceRegistry::CAPACITY - 1U);
+    if (numberOfServices < NUMBER_OF_SERVICES)
+    {
+        std::cout << "The registry capacity is limited to " << IndexedServiceRegistry::CAPACITY
+                  << " services; configure the build with a larger IOX_MAX_PUBLISHERS to benchmark "
+                  << NUMBER_OF_SERVICES << " services" << std::endl;
+    }
+
+    // the registry is too large for the stack
+    std::unique_ptr<IndexedServiceRegistry> registry{new IndexedServiceRegistry};
+    for (uint64_t i = 0U; i < numberOfServices; ++i)
+    {
+        IOX_DISCARD_RESULT(registry->addPublisher({idString("Service", i),
+                                                   idString("Instance", i % NUMBER_OF_INSTANCES),
+                                                   idString("Event", i % NUMBER_OF_EVENTS)}));
+    }
+    std::cout << "Registered services: " << numberOfServices << std::endl;
+
+    const auto find = [&](const iox::optional<IdString_t>& service,
+                          const iox::optional<IdString_t>& instance,
+                          const iox::optional<IdString_t>& event) {
+        uint64_t numberOfMatches{0U};
+        registry->find(service, instance, event, [&](const auto&) { ++numberOfMatches; });
+        return numberOfMatches;
+    };
+
+    benchmark("add and remove", NUMBER_OF_LOOKUPS, [&](const uint64_t i) {
+        iox::capro::ServiceDescription service{
+            idString("Service", i % numberOfServices), idString("Instance", i), idString("Event", i)};
+        IOX_DISCARD_RESULT(registry->addPublisher(service));
+        registry->removePublisher(service);
+        return 0U;
+    });
+    benchmark("find service, instance and event", NUMBER_OF_LOOKUPS, [&](const uint64_t i) {
+        const auto n = i % numberOfServices;
+        return find(idString("Service", n),
+                    idString("Instance", n % NUMBER_OF_INSTANCES),
+                    idString("Event", n % NUMBER_OF_EVENTS));
+    });
+    benchmark("find service", NUMBER_OF_LOOKUPS, [&](const uint64_t i) {
+        return find(idString("Service", i % numberOfServices), iox::nullopt, iox::nullopt);
+    });
+    benchmark("find instance", NUMBER_OF_LOOKUPS, [&](const uint64_t i) {
+        return find(iox::nullopt, idString("Instance", i % NUMBER_OF_INSTANCES), iox::nullopt);
+    });
+    benchmark("find instance and event", NUMBER_OF_LOOKUPS, [&](const uint64_t i) {
+        return find(iox::nullopt,
+                    idString("Instance", i % NUMBER_OF_INSTANCES),
+                    idString("Event", i % NUMBER_OF_EVENTS));
+    });
+    benchmark("find non-existing service", NUMBER_OF_LOOKUPS, [&](const uint64_t i) {
+        return find(idString("Unknown", i), iox::nullopt, iox::nullopt);
+    });
+    benchmark("find all", NUMBER_OF_LOOKUPS / 100U, [&](const uint64_t) {
+        return find(iox::nullopt, iox::nullopt, iox::nullopt);
+    });
+
+    return 0;
+}
@@ -75,6 +75,7 @@ class PoshRuntimeMock : public iox::runtime::PoshRuntime
                 (const iox::capro::Interfaces, const iox::NodeName_t&),
                 (noexcept, override));
     MOCK_METHOD(iox::popo::ConditionVariableData*, getMiddlewareConditionVariable, (), (noexcept, override));
+    MOCK_METHOD(void, requestPorts, (const iox::runtime::PortRequests&), (noexcept, override));
     MOCK_METHOD(bool,
                 sendRequestToRouDi,
                 (const iox::runtime::IpcMessage&, iox::runtime::IpcMessage&),
@@ -17,8 +17,10 @@
 #define IOX_TOOLS_ICEORYX_INTROSPECTION_INTROSPECTION_APP_HPP
 
 #include "iceoryx_introspection/introspection_types.hpp"
+#include "iceoryx_introspection/performance_view.hpp"
 #include "iceoryx_platform/getopt.hpp"
 #include "iceoryx_posh/popo/subscriber.hpp"
+#include "iox/optional.hpp"
 
 #include <map>
 #include <ncurses.h>
@@ -38,13 +40,18 @@ static constexpr option longOptions[] = {{"help", no_argument, nullptr, 'h'},
                                          {"port", no_argument, nullptr, 0},
                                          {"process", no_argument, nullptr, 0},
                                          {"all", no_argument, nullptr, 0},
+                                         {"top", no_argument, nullptr, 0},
+                                         {"sort", required_argument, nullptr, 's'},
+                                         {"snapshot", required_argument, nullptr, 0},
                                          {nullptr, 0, nullptr, 0}};
 
-static constexpr const char* shortOptions = "hvt:d:";
+static constexpr const char* shortOptions = "hvt:d:s:";
 
 static constexpr iox::units::Duration MIN_UPDATE_PERIOD = 500_ms;
 static constexpr iox::units::Duration DEFAULT_UPDATE_PERIOD = 1000_ms;
 static constexpr iox::units::Duration MAX_UPDATE_PERIOD = 10000_ms;
+/// @brief a snapshot is written when two throughput samples were received or at the latest after this timeout
+static constexpr iox::units::Duration SNAPSHOT_TIMEOUT = 5000_ms;
 
 /// @brief color pairs for terminal printing
 enum class ColorPairs : uint8_t
@@ -132,6 +139,14 @@ class IntrospectionApp
     /// @brief prints table showing current mempool usage
     void printMemPoolInfo(const MemPoolIntrospectionInfo& introspectionInfo);
 
+    /// @brief prints the publishers, mempools and processes of the performance view; the table which belongs to the
+    ///        sort key is printed first
+    void printPerformanceView();
+
+    /// @brief prints an error to the terminal or to stderr when a snapshot is written
+    /// @param[in] message to print
+    void printError(const std::string& message);
+
     template <typename Topic>
     iox::unique_ptr<iox::popo::Subscriber<Topic>>
     createSubscriber(const iox::capro::ServiceDescription& serviceDescription) noexcept;
@@ -169,6 +184,14 @@ class IntrospectionApp
     /// @bried the domain ID to connect to RouDi
     iox::DomainId domainId{iox::DEFAULT_DOMAIN_ID};
 
+    /// @brief the criterion by which the performance view is sorted, it can be changed with keys at runtime
+    PerformanceSortKey performanceSortKey{PerformanceSortKey::MESSAGE_RATE};
+
+    /// @brief if set, a single snapshot of the performance view is written to stdout instead of running the terminal
+    optional<SnapshotFormat> snapshotFormat;
+
+    PerformanceView performanceView;
+
     /// @brief ncurses pad
     WINDOW* pad;
 
@@ -0,0 +1,178 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_TOOLS_ICEORYX_INTROSPECTION_PERFORMANCE_VIEW_HPP
+#define IOX_TOOLS_ICEORYX_INTROSPECTION_PERFORMANCE_VIEW_HPP
+
+#include "iceoryx_introspection/introspection_types.hpp"
+
+#include <chrono>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace iox
+{
+namespace client
+{
+namespace introspection
+{
+/// @brief The criterion by which the performance view is sorted; every criterion sorts the table it belongs to in
+///        descending order and shows this table first
+enum class PerformanceSortKey : uint8_t
+{
+    MESSAGE_RATE,
+    BANDWIDTH,
+    DROPS,
+    MEMPOOL_PRESSURE,
+    HEARTBEAT_AGE
+};
+
+/// @brief The machine-readable formats of a performance snapshot
+enum class SnapshotFormat : uint8_t
+{
+    JSON,
+    CSV
+};
+
+/// @brief The throughput of a publisher port; the deltas refer to the previous throughput sample
+struct PublisherPerformance
+{
+    uint64_t publisherPortId{0U};
+    std::string runtimeName;
+    std::string service;
+    std::string instance;
+    std::string event;
+    uint64_t chunksSent{0U};
+    uint64_t bytesSent{0U};
+    uint64_t queueOverflows{0U};
+    /// @brief false for the first sample of the port, then the deltas and rates are not available
+    bool hasDelta{false};
+    uint64_t deltaChunksSent{0U};
+    uint64_t deltaBytesSent{0U};
+    uint64_t deltaQueueOverflows{0U};
+    double chunksPerSecond{0.0};
+    double bytesPerSecond{0.0};
+};
+
+/// @brief The usage of a mempool; the deltas refer to the previous mempool sample
+struct MemPoolPerformance
+{
+    uint32_t segmentId{0U};
+    /// @brief starts with 1 like in the mempool view
+    uint32_t memPoolNumber{0U};
+    uint64_t chunkSize{0U};
+    uint32_t usedChunks{0U};
+    uint32_t numChunks{0U};
+    /// @brief the fraction of the chunks which are in use
+    double pressure{0.0};
+    uint64_t failedAllocations{0U};
+    /// @brief false for the first sample of the mempool, then the deltas are not available
+    bool hasDelta{false};
+    int64_t deltaUsedChunks{0};
+    uint64_t deltaFailedAllocations{0U};
+};
+
+/// @brief The liveness of a process
+struct ProcessPerformance
+{
+    int pid{0};
+    std::string runtimeName;
+    /// @brief false if RouDi does not monitor the heartbeat of the process
+    bool isMonitored{false};
+    uint64_t heartbeatAgeInMilliseconds{0U};
+};
+
+/// @brief Derives rates and deltas from consecutive introspection samples and sorts them like 'top'. It does not
+///        depend on the terminal, therefore it is also used to export machine-readable snapshots.
+class PerformanceView
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief Updates the publisher rows with a new throughput sample
+    /// @param[in] portData is the port sample which provides the names of the publishers
+    /// @param[in] throughputData is the throughput sample
+    /// @param[in] sampleTime is the time when the throughput sample was taken
+    void updatePublishers(const PortIntrospectionFieldTopic& portData,
+                          const PortThroughputIntrospectionFieldTopic& throughputData,
+                          const Clock::time_point sampleTime) noexcept;
+
+    /// @brief Updates the mempool rows with a new mempool sample
+    /// @param[in] memPoolData is the mempool sample
+    void updateMemPools(const MemPoolIntrospectionInfoContainer& memPoolData) noexcept;
+
+    /// @brief Updates the process rows with a new process sample
+    /// @param[in] processData is the process sample
+    void updateProcesses(const ProcessIntrospectionFieldTopic& processData) noexcept;
+
+    /// @brief Sorts all tables; the publishers are sorted by the message rate unless the bandwidth or the drops are
+    ///        requested, the mempools by the pressure and the processes by the heartbeat age. Publishers without
+    ///        deltas are listed last and are sorted by the totals.
+    /// @param[in] sortKey is the requested criterion
+    void sort(const PerformanceSortKey sortKey) noexcept;
+
+    /// @brief Returns true if at least one publisher row has deltas to the previous sample
+    bool hasPublisherDeltas() const noexcept;
+
+    const std::vector<PublisherPerformance>& publishers() const noexcept;
+    const std::vector<MemPoolPerformance>& memPools() const noexcept;
+    const std::vector<ProcessPerformance>& processes() const noexcept;
+
+    /// @brief Writes all tables as one JSON object; deltas and rates which are not available are null
+    /// @param[in] stream to which the snapshot is written
+    void writeJson(std::ostream& stream) const noexcept;
+
+    /// @brief Writes all tables as CSV with one line per row; the first column names the table and every table is
+    ///        preceded by its header line. Deltas and rates which are not available are empty.
+    /// @param[in] stream to which the snapshot is written
+    void writeCsv(std::ostream& stream) const noexcept;
+
+  private:
+    struct PublisherCounters
+    {
+        uint64_t chunksSent{0U};
+        uint64_t bytesSent{0U};
+        uint64_t queueOverflows{0U};
+    };
+
+    struct MemPoolCounters
+    {
+        uint32_t usedChunks{0U};
+        uint64_t failedAllocations{0U};
+    };
+
+    std::vector<PublisherPerformance> m_publishers;
+    std::vector<MemPoolPerformance> m_memPools;
+    std::vector<ProcessPerformance> m_processes;
+
+    std::map<uint64_t, PublisherCounters> m_previousPublisherCounters;
+    Clock::time_point m_previousPublisherSampleTime;
+    std::map<std::pair<uint32_t, uint32_t>, MemPoolCounters> m_previousMemPoolCounters;
+};
+
+/// @brief Converts the sort key to the name which is used on the command line
+/// @param[in] value to convert
+/// @return pointer to a string literal
+const char* asStringLiteral(const PerformanceSortKey value) noexcept;
+
+} // namespace introspection
+} // namespace client
+} // namespace iox
+
+#endif // IOX_TOOLS_ICEORYX_INTROSPECTION_PERFORMANCE_VIEW_HPP
@@ -22,6 +22,7 @@
 #include "iceoryx_versions.hpp"
 #include "iox/duration.hpp"
 #include "iox/into.hpp"
+#include "iox/logging.hpp"
 #include "iox/std_string_support.hpp"
 
 #if __has_include("iox/posh/experimental/node.hpp")
@@ -31,6 +32,7 @@
 
 #include <chrono>
 #include <iomanip>
+#include <iostream>
 #include <poll.h>
 #include <thread>
 
@@ -77,6 +79,16 @@ void IntrospectionApp::printHelp() noexcept
                  "  --mempool               Subscribe to mempool introspection data.\n"
                  "  --port                  Subscribe to port introspection data.\n"
                  "  --process               Subscribe to process introspection data.\n"
+                 "  --top                   Show the publishers, mempools and processes sorted like 'top', with the\n"
+                 "                          changes since the previous sample.\n"
+                 "                          Keys: [r]ate, [b]andwidth, [d]rops, [m]empool pressure, [h]eartbeat age\n"
+                 "  -s, --sort <KEY>        Initial sort key of '--top'\n"
+                 "                          <KEY> rate, bandwidth, drops, pressure, heartbeat [default: rate]\n"
+                 "  --snapshot <FORMAT>     Write one sample of '--top' to stdout and exit; the rates require a second\n"
+                 "                          sample, which is awaited for at most "
+              << SNAPSHOT_TIMEOUT.toMilliseconds()
+              << " ms\n"
+                 "                          <FORMAT> json, csv\n"
               << std::endl;
 }
 
@@ -137,6 +149,29 @@ void IntrospectionApp::parseCmdLineArguments(int argc,
             break;
         }
 
+        case 's':
+        {
+            constexpr PerformanceSortKey SORT_KEYS[] = {PerformanceSortKey::MESSAGE_RATE,
+                                                        PerformanceSortKey::BANDWIDTH,
+                                                        PerformanceSortKey::DROPS,
+                                                        PerformanceSortKey::MEMPOOL_PRESSURE,
+                                                        PerformanceSortKey::HEARTBEAT_AGE};
+            bool isValidSortKey{false};
+            for (const auto sortKey : SORT_KEYS)
+            {
+                if (strcmp(optarg, asStringLiteral(sortKey)) == 0)
+                {
+                    performanceSortKey = sortKey;
+                    isValidSortKey = true;
+                }
+            }
+            if (!isValidSortKey)
+            {
+                std::cout << "Invalid argument for 's'! Will be ignored!";
+            }
+            break;
+        }
+
         case 0:
             if (longOptions[index].flag != 0)
                 break;
@@ -161,6 +196,30 @@ void IntrospectionApp::parseCmdLineArguments(int argc,
                 introspectionSelection.mempool = true;
                 doIntrospection = true;
             }
+            else if (strcmp(longOptions[index].name, "top") == 0)
+            {
+                introspectionSelection.performance = true;
+                doIntrospection = true;
+            }
+            else if (strcmp(longOptions[index].name, "snapshot") == 0)
+            {
+                if (strcmp(optarg, "json") == 0)
+                {
+                    snapshotFormat.emplace(SnapshotFormat::JSON);
+                }
+                else if (strcmp(optarg, "csv") == 0)
+                {
+                    snapshotFormat.emplace(SnapshotFormat::CSV);
+                }
+                else
+                {
+                    std::cout << "Invalid argument for 'snapshot'! ";
+                    printShortInfo(argv[0]);
+                    exit(EXIT_FAILURE);
+                }
+                introspectionSelection.performance = true;
+                doIntrospection = true;
+            }
 
             break;
 
@@ -239,6 +298,27 @@ void IntrospectionApp::updateDisplayYX()
     {
         xPad += xIncrement;
     }
+    // the new sort key is applied with the next refresh of the introspection data
+    else if (ch == 'r')
+    {
+        performanceSortKey = PerformanceSortKey::MESSAGE_RATE;
+    }
+    else if (ch == 'b')
+    {
+        performanceSortKey = PerformanceSortKey::BANDWIDTH;
+    }
+    else if (ch == 'd')
+    {
+        performanceSortKey = PerformanceSortKey::DROPS;
+    }
+    else if (ch == 'm')
+    {
+        performanceSortKey = PerformanceSortKey::MEMPOOL_PRESSURE;
+    }
+    else if (ch == 'h')
+    {
+        performanceSortKey = PerformanceSortKey::HEARTBEAT_AGE;
+    }
     else
     {
         // Nothing to do
@@ -268,6 +348,18 @@ void IntrospectionApp::prettyPrint(const std::string& str, const PrettyOptions p
     wattroff(pad, prettyMap.find(pr)->second);
 }
 
+void IntrospectionApp::printError(const std::string& message)
+{
+    if (snapshotFormat.has_value())
+    {
+        std::cerr << message;
+    }
+    else
+    {
+        prettyPrint(message, PrettyOptions::error);
+    }
+}
+
 void IntrospectionApp::printProcessIntrospectionData(const ProcessIntrospectionFieldTopic* processIntrospectionField)
 {
     constexpr int32_t pidWidth{-10};
@@ -298,14 +390,23 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
     constexpr int32_t minFreechunksWidth{9};
     constexpr int32_t chunkSizeWidth{11};
     constexpr int32_t chunkPayloadSizeWidth{13};
+    constexpr int32_t rateWidth{10};
+    constexpr int32_t failedAllocationsWidth{8};
+    constexpr int32_t loanDurationWidth{14};
 
     wprintw(pad, "%*s |", memPoolWidth, "MemPool");
     wprintw(pad, "%*s |", usedchunksWidth, "Chunks In Use");
     wprintw(pad, "%*s |", numchunksWidth, "Total");
     wprintw(pad, "%*s |", minFreechunksWidth, "Min Free");
     wprintw(pad, "%*s |", chunkSizeWidth, "Chunk Size");
-    wprintw(pad, "%*s\n", chunkPayloadSizeWidth, "Chunk Payload Size");
-    wprintw(pad, "--------------------------------------------------------------------------------\n");
+    wprintw(pad, "%*s |", chunkPayloadSizeWidth, "Chunk Payload Size");
+    wprintw(pad, "%*s |", rateWidth, "Allocs/s");
+    wprintw(pad, "%*s |", rateWidth, "Frees/s");
+    wprintw(pad, "%*s |", failedAllocationsWidth, "Failed");
+    wprintw(pad, "%*s\n", loanDurationWidth, "Loan p99 [us]");
+    wprintw(pad,
+            "--------------------------------------------------------------------------------"
+            "-----------------------------------------------------\n");
 
     for (size_t i = 0u; i < introspectionInfo.m_mempoolInfo.size(); ++i)
     {
@@ -317,7 +418,14 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
             wprintw(pad, "%*d |", numchunksWidth, info.m_numChunks);
             wprintw(pad, "%*d |", minFreechunksWidth, info.m_minFreeChunks);
             wprintw(pad, "%*ld |", chunkSizeWidth, info.m_chunkSize);
-            wprintw(pad, "%*ld\n", chunkPayloadSizeWidth, info.m_chunkPayloadSize);
+            wprintw(pad, "%*ld |", chunkPayloadSizeWidth, info.m_chunkPayloadSize);
+            wprintw(pad, "%*.1f |", rateWidth, info.m_allocationsPerSecond);
+            wprintw(pad, "%*.1f |", rateWidth, info.m_freesPerSecond);
+            wprintw(pad, "%*ld |", failedAllocationsWidth, info.m_numberOfFailedAllocations);
+            wprintw(pad,
+                    "%*.1f\n",
+                    loanDurationWidth,
+                    static_cast<double>(info.m_loanDurationP99InNanoseconds) / 1000.0);
         }
     }
     wprintw(pad, "\n");
@@ -330,13 +438,15 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     constexpr int32_t instanceWidth{16};
     constexpr int32_t eventWidth{21};
     constexpr int32_t runtimeNameWidth{23};
-    // uncomment once this information is needed
-    // constexpr int32_t sampleSizeWidth{12};
-    // constexpr int32_t chunkSizeWidth{12};
-    // constexpr int32_t chunksWidth{12};
-    // constexpr int32_t intervalWidth{19};
+    constexpr int32_t sampleSizeWidth{12};
+    constexpr int32_t chunkSizeWidth{12};
+    constexpr int32_t chunksWidth{12};
+    constexpr int32_t intervalWidth{19};
+    constexpr int32_t overflowsWidth{10};
     constexpr int32_t subscriptionStateWidth{14};
-    // constexpr int32_t fifoWidth{17};    // uncomment once this information is needed
+    constexpr int32_t fifoWidth{17};
+    constexpr int32_t highWaterMarkWidth{10};
+    constexpr int32_t lostChunksWidth{10};
     constexpr int32_t scopeWidth{12};
     constexpr int32_t interfaceSourceWidth{8};
 
@@ -346,26 +456,26 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     wprintw(pad, " %*s |", instanceWidth, "Instance");
     wprintw(pad, " %*s |", eventWidth, "Event");
     wprintw(pad, " %*s |", runtimeNameWidth, "Process");
-    // uncomment once this information is needed
-    // wprintw(pad, " %*s |", sampleSizeWidth, "Sample Size");
-    // wprintw(pad, " %*s |", chunkSizeWidth, "Chunk Size");
-    // wprintw(pad, " %*s |", chunksWidth, "Chunks");
-    // wprintw(pad, " %*s |", intervalWidth, "Last Send Interval");
+    wprintw(pad, " %*s |", sampleSizeWidth, "Sample Size");
+    wprintw(pad, " %*s |", chunkSizeWidth, "Chunk Size");
+    wprintw(pad, " %*s |", chunksWidth, "Chunks");
+    wprintw(pad, " %*s |", intervalWidth, "Last Send Interval");
+    wprintw(pad, " %*s |", overflowsWidth, "Overflows");
     wprintw(pad, " %*s\n", interfaceSourceWidth, "Src. Itf.");
 
     wprintw(pad, " %*s |", serviceWidth, "");
     wprintw(pad, " %*s |", instanceWidth, "");
     wprintw(pad, " %*s |", eventWidth, "");
     wprintw(pad, " %*s |", runtimeNameWidth, "");
-    // uncomment once this information is needed
-    // wprintw(pad, " %*s |", sampleSizeWidth, "[Byte]");
-    // wprintw(pad, " %*s |", chunkSizeWidth, "[Byte]");
-    // wprintw(pad, " %*s |", chunksWidth, "[/Minute]");
-    // wprintw(pad, " %*s |", intervalWidth, "[Milliseconds]");
+    wprintw(pad, " %*s |", sampleSizeWidth, "[Byte]");
+    wprintw(pad, " %*s |", chunkSizeWidth, "[Byte]");
+    wprintw(pad, " %*s |", chunksWidth, "[/Minute]");
+    wprintw(pad, " %*s |", intervalWidth, "[Milliseconds]");
+    wprintw(pad, " %*s |", overflowsWidth, "[Total]");
     wprintw(pad, " %*s\n", interfaceSourceWidth, "");
 
-    wprintw(pad,
-            "---------------------------------------------------------------------------------------------------\n");
+    wprintw(pad, "---------------------------------------------------------------------------------------------------");
+    wprintw(pad, "--------------------------------------------------------------------------------\n");
 
     bool needsLineBreak{false};
     uint32_t currentLine{0U};
@@ -402,11 +512,12 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
 
     for (auto& publisherPort : publisherPortData)
     {
-        // uncomment once this information is needed
-        // std::string m_sampleSize{"n/a"};
-        // std::string m_chunkSize{"n/a"};
-        // std::string m_chunksPerMinute{"n/a"};
-        // std::string sendInterval{"n/a"};
+        const auto& throughput = *publisherPort.throughputData;
+        std::stringstream chunksPerMinute;
+        chunksPerMinute << std::fixed << std::setprecision(1) << throughput.m_chunksPerMinute;
+        std::stringstream sendInterval;
+        sendInterval << std::fixed << std::setprecision(3)
+                     << static_cast<double>(throughput.m_lastSendIntervalInNanoseconds) / 1000000.0;
 
         currentLine = 0;
         do
@@ -426,11 +537,11 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
             wprintw(pad,
                     " %s |",
                     printEntry(runtimeNameWidth, iox::into<std::string>(publisherPort.portData->m_name)).c_str());
-            // uncomment once this information is needed
-            // wprintw(pad, " %s |", printEntry(sampleSizeWidth, m_sampleSize).c_str());
-            // wprintw(pad, " %s |", printEntry(chunkSizeWidth, m_chunkSize).c_str());
-            // wprintw(pad, " %s |", printEntry(chunksWidth, m_chunksPerMinute).c_str());
-            // wprintw(pad, " %s |", printEntry(intervalWidth, sendInterval).c_str());
+            wprintw(pad, " %s |", printEntry(sampleSizeWidth, std::to_string(throughput.m_sampleSize)).c_str());
+            wprintw(pad, " %s |", printEntry(chunkSizeWidth, std::to_string(throughput.m_chunkSize)).c_str());
+            wprintw(pad, " %s |", printEntry(chunksWidth, chunksPerMinute.str()).c_str());
+            wprintw(pad, " %s |", printEntry(intervalWidth, sendInterval.str()).c_str());
+            wprintw(pad, " %s |", printEntry(overflowsWidth, std::to_string(throughput.m_queueOverflows)).c_str());
             wprintw(
                 pad,
                 " %s\n",
@@ -452,7 +563,9 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     wprintw(pad, " %*s |", eventWidth, "Event");
     wprintw(pad, " %*s |", runtimeNameWidth, "Process");
     wprintw(pad, " %*s |", subscriptionStateWidth, "Subscription");
-    // wprintw(pad, " %*s |", fifoWidth, "FiFo"); // uncomment once this information is needed
+    wprintw(pad, " %*s |", fifoWidth, "FiFo");
+    wprintw(pad, " %*s |", highWaterMarkWidth, "High Water");
+    wprintw(pad, " %*s |", lostChunksWidth, "Lost");
     wprintw(pad, " %*s\n", scopeWidth, "Propagation");
 
     wprintw(pad, " %*s |", serviceWidth, "");
@@ -460,11 +573,13 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     wprintw(pad, " %*s |", eventWidth, "");
     wprintw(pad, " %*s |", runtimeNameWidth, "");
     wprintw(pad, " %*s |", subscriptionStateWidth, "State");
-    // wprintw(pad, " %*s |", fifoWidth, "size / capacity"); // uncomment once this information is needed
+    wprintw(pad, " %*s |", fifoWidth, "size / capacity");
+    wprintw(pad, " %*s |", highWaterMarkWidth, "Mark");
+    wprintw(pad, " %*s |", lostChunksWidth, "Chunks");
     wprintw(pad, " %*s\n", scopeWidth, "scope");
 
     wprintw(pad, "---------------------------------------------------------------------------------------------------");
-    wprintw(pad, "--------------------\n");
+    wprintw(pad, "-------------------------------------------------------------------\n");
 
     auto subscriptionStateToString = [](iox::SubscribeState subState) -> std::string {
         switch (subState)
@@ -507,20 +622,24 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
                     printEntry(subscriptionStateWidth,
                                subscriptionStateToString(subscriber.subscriberPortChangingData->subscriptionState))
                         .c_str());
-            // uncomment once this information is needed
-            // if (currentLine == 0)
-            //{
-            // std::string fifoSize{"n/a"};     // std::to_string(subscriber.subscriberPortChangingData->fifoSize))
-            // std::string fifoCapacity{"n/a"}; // std::to_string(subscriber.subscriberPortChangingData->fifoCapacity))
-            // wprintw(pad,
-            //" %s / %s |",
-            // printEntry(((fifoWidth / 2) - 1), fifoSize).c_str(),
-            // printEntry(((fifoWidth / 2) - 1), fifoCapacity).c_str());
-            //}
-            // else
-            //{
-            // wprintw(pad, " %*s |", fifoWidth, "");
-            //}
+            if (currentLine == 0)
+            {
+                const auto& changingData = *subscriber.subscriberPortChangingData;
+                wprintw(pad,
+                        " %*s / %-*s |",
+                        ((fifoWidth / 2) - 1),
+                        std::to_string(changingData.fifoSize).c_str(),
+                        ((fifoWidth / 2) - 1),
+                        std::to_string(changingData.fifoCapacity).c_str());
+                wprintw(pad, " %*s |", highWaterMarkWidth, std::to_string(changingData.fifoHighWaterMark).c_str());
+                wprintw(pad, " %*s |", lostChunksWidth, std::to_string(changingData.lostChunks).c_str());
+            }
+            else
+            {
+                wprintw(pad, " %*s |", fifoWidth, "");
+                wprintw(pad, " %*s |", highWaterMarkWidth, "");
+                wprintw(pad, " %*s |", lostChunksWidth, "");
+            }
             wprintw(pad,
                     " %s\n",
                     printEntry(scopeWidth,
@@ -536,12 +655,170 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
         wprintw(pad, " %*s |", eventWidth, "");
         wprintw(pad, " %*s |", runtimeNameWidth, "");
         wprintw(pad, " %*s |", subscriptionStateWidth, "");
-        // wprintw(pad, " %*s |", fifoWidth, ""); // uncomment once this information is needed
+        wprintw(pad, " %*s |", fifoWidth, "");
+        wprintw(pad, " %*s |", highWaterMarkWidth, "");
+        wprintw(pad, " %*s |", lostChunksWidth, "");
         wprintw(pad, " %*s", scopeWidth, "");
         wprintw(pad, "\n");
     }
 }
 
+void IntrospectionApp::printPerformanceView()
+{
+    constexpr int32_t serviceWidth{16};
+    constexpr int32_t instanceWidth{16};
+    constexpr int32_t eventWidth{21};
+    constexpr int32_t runtimeNameWidth{23};
+    constexpr int32_t idWidth{8};
+    constexpr int32_t valueWidth{12};
+    constexpr int32_t columnSeparatorWidth{3};
+    constexpr const char* MISSING_VALUE{"-"};
+
+    auto printSeparator = [&](const int32_t numberOfNameColumns, const int32_t numberOfValueColumns) {
+        const auto width = numberOfNameColumns * (runtimeNameWidth + columnSeparatorWidth)
+                           + numberOfValueColumns * (valueWidth + columnSeparatorWidth);
+        wprintw(pad, "%s\n", std::string(static_cast<size_t>(width), '-').c_str());
+    };
+
+    auto truncated = [](const std::string& value, const int32_t width) {
+        return value.substr(0U, static_cast<size_t>(width));
+    };
+
+    // deltas are printed with their sign to distinguish them from the totals
+    auto formatIfAvailable = [&](const bool isAvailable, const auto value, const bool isDelta) {
+        if (!isAvailable)
+        {
+            return std::string(MISSING_VALUE);
+        }
+        std::stringstream stream;
+        stream << std::fixed << std::setprecision(1) << (isDelta ? std::showpos : std::noshowpos) << value;
+        return stream.str();
+    };
+
+    auto printPublishers = [&] {
+        prettyPrint("Publishers\n", PrettyOptions::bold);
+        wprintw(pad, " %*s |", serviceWidth, "Service");
+        wprintw(pad, " %*s |", instanceWidth, "Instance");
+        wprintw(pad, " %*s |", eventWidth, "Event");
+        wprintw(pad, " %*s |", runtimeNameWidth, "Process");
+        wprintw(pad, " %*s |", valueWidth, "Chunks/s");
+        wprintw(pad, " %*s |", valueWidth, "KiB/s");
+        wprintw(pad, " %*s |", valueWidth, "Chunks");
+        wprintw(pad, " %*s |", valueWidth, "Drops");
+        wprintw(pad, " %*s\n", valueWidth, "Drops");
+        wprintw(pad, " %*s |", serviceWidth, "");
+        wprintw(pad, " %*s |", instanceWidth, "");
+        wprintw(pad, " %*s |", eventWidth, "");
+        wprintw(pad, " %*s |", runtimeNameWidth, "");
+        wprintw(pad, " %*s |", valueWidth, "");
+        wprintw(pad, " %*s |", valueWidth, "");
+        wprintw(pad, " %*s |", valueWidth, "[Delta]");
+        wprintw(pad, " %*s |", valueWidth, "[Delta]");
+        wprintw(pad, " %*s\n", valueWidth, "[Total]");
+        printSeparator(4, 5);
+
+        constexpr double BYTES_PER_KIBIBYTE{1024.0};
+        for (const auto& row : performanceView.publishers())
+        {
+            wprintw(pad, " %-*s |", serviceWidth, truncated(row.service, serviceWidth).c_str());
+            wprintw(pad, " %-*s |", instanceWidth, truncated(row.instance, instanceWidth).c_str());
+            wprintw(pad, " %-*s |", eventWidth, truncated(row.event, eventWidth).c_str());
+            wprintw(pad, " %-*s |", runtimeNameWidth, truncated(row.runtimeName, runtimeNameWidth).c_str());
+            wprintw(pad, " %*s |", valueWidth, formatIfAvailable(row.hasDelta, row.chunksPerSecond, false).c_str());
+            wprintw(pad,
+                    " %*s |",
+                    valueWidth,
+                    formatIfAvailable(row.hasDelta, row.bytesPerSecond / BYTES_PER_KIBIBYTE, false).c_str());
+            wprintw(pad, " %*s |", valueWidth, formatIfAvailable(row.hasDelta, row.deltaChunksSent, true).c_str());
+            wprintw(
+                pad, " %*s |", valueWidth, formatIfAvailable(row.hasDelta, row.deltaQueueOverflows, true).c_str());
+            wprintw(pad, " %*s\n", valueWidth, std::to_string(row.queueOverflows).c_str());
+        }
+        wprintw(pad, "\n");
+    };
+
+    auto printMemPools = [&] {
+        prettyPrint("MemPools\n", PrettyOptions::bold);
+        wprintw(pad, " %*s |", idWidth, "Segment");
+        wprintw(pad, " %*s |", idWidth, "MemPool");
+        wprintw(pad, " %*s |", valueWidth, "Chunk Size");
+        wprintw(pad, " %*s |", valueWidth, "In Use");
+        wprintw(pad, " %*s |", valueWidth, "Total");
+        wprintw(pad, " %*s |", valueWidth, "Pressure");
+        wprintw(pad, " %*s |", valueWidth, "In Use");
+        wprintw(pad, " %*s\n", valueWidth, "Failed");
+        wprintw(pad, " %*s |", idWidth, "");
+        wprintw(pad, " %*s |", idWidth, "");
+        wprintw(pad, " %*s |", valueWidth, "[Byte]");
+        wprintw(pad, " %*s |", valueWidth, "");
+        wprintw(pad, " %*s |", valueWidth, "");
+        wprintw(pad, " %*s |", valueWidth, "[%]");
+        wprintw(pad, " %*s |", valueWidth, "[Delta]");
+        wprintw(pad, " %*s\n", valueWidth, "[Delta]");
+        printSeparator(1, 6);
+
+        constexpr double PERCENT{100.0};
+        for (const auto& row : performanceView.memPools())
+        {
+            wprintw(pad, " %*u |", idWidth, row.segmentId);
+            wprintw(pad, " %*u |", idWidth, row.memPoolNumber);
+            wprintw(pad, " %*lu |", valueWidth, row.chunkSize);
+            wprintw(pad, " %*u |", valueWidth, row.usedChunks);
+            wprintw(pad, " %*u |", valueWidth, row.numChunks);
+            wprintw(pad, " %*.1f |", valueWidth, row.pressure * PERCENT);
+            wprintw(pad, " %*s |", valueWidth, formatIfAvailable(row.hasDelta, row.deltaUsedChunks, true).c_str());
+            wprintw(
+                pad, " %*s\n", valueWidth, formatIfAvailable(row.hasDelta, row.deltaFailedAllocations, true).c_str());
+        }
+        wprintw(pad, "\n");
+    };
+
+    auto printProcesses = [&] {
+        prettyPrint("Processes\n", PrettyOptions::bold);
+        wprintw(pad, " %*s |", idWidth, "PID");
+        wprintw(pad, " %*s |", runtimeNameWidth, "Process");
+        wprintw(pad, " %*s\n", valueWidth, "Heartbeat");
+        wprintw(pad, " %*s |", idWidth, "");
+        wprintw(pad, " %*s |", runtimeNameWidth, "");
+        wprintw(pad, " %*s\n", valueWidth, "Age [ms]");
+        printSeparator(1, 2);
+
+        for (const auto& row : performanceView.processes())
+        {
+            wprintw(pad, " %*d |", idWidth, row.pid);
+            wprintw(pad, " %-*s |", runtimeNameWidth, truncated(row.runtimeName, runtimeNameWidth).c_str());
+            wprintw(pad,
+                    " %*s\n",
+                    valueWidth,
+                    formatIfAvailable(row.isMonitored, row.heartbeatAgeInMilliseconds, false).c_str());
+        }
+        wprintw(pad, "\n");
+    };
+
+    prettyPrint("### Performance ###", PrettyOptions::highlight);
+    prettyPrint(std::string(" sorted by ") + asStringLiteral(performanceSortKey), PrettyOptions::bold);
+    wprintw(pad, "    Keys: [r]ate [b]andwidth [d]rops [m]empool pressure [h]eartbeat age\n\n");
+
+    switch (performanceSortKey)
+    {
+    case PerformanceSortKey::MEMPOOL_PRESSURE:
+        printMemPools();
+        printPublishers();
+        printProcesses();
+        break;
+    case PerformanceSortKey::HEARTBEAT_AGE:
+        printProcesses();
+        printPublishers();
+        printMemPools();
+        break;
+    default:
+        printPublishers();
+        printMemPools();
+        printProcesses();
+        break;
+    }
+}
+
 template <typename Topic>
 iox::unique_ptr<iox::popo::Subscriber<Topic>>
 IntrospectionApp::createSubscriber(const iox::capro::ServiceDescription& serviceDescription) noexcept
@@ -576,7 +853,8 @@ IntrospectionApp::composePublisherPortData(const PortIntrospectionFieldTopic* po
     std::vector<ComposedPublisherPortData> publisherPortData;
     publisherPortData.reserve(portData->m_publisherList.size());
 
-    const PortThroughputData dummyThroughputData;
+    // the composed data keeps a pointer to the throughput data, therefore the dummy must outlive this function
+    static const PortThroughputData dummyThroughputData;
 
     auto& m_publisherList = portData->m_publisherList;
     auto& m_throughputList = throughputData->m_throughputList;
@@ -648,6 +926,12 @@ std::vector<ComposedSubscriberPortData> IntrospectionApp::composeSubscriberPortD
 void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
                                         const IntrospectionSelection introspectionSelection)
 {
+    // the logger writes to stdout, where it would corrupt the snapshot
+    if (snapshotFormat.has_value())
+    {
+        iox::log::Logger::setLogLevel(iox::log::LogLevel::ERROR);
+    }
+
 #ifdef HAS_EXPERIMENTAL_POSH
     auto nodeResult = iox::posh::experimental::NodeBuilder(iox::roudi::INTROSPECTION_APP_NAME)
                           .roudi_registration_timeout(iox::runtime::PROCESS_WAITING_FOR_ROUDI_TIMEOUT)
@@ -666,8 +950,11 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
 
     using namespace iox::roudi;
 
-    initTerminal();
-    prettyPrint("### Iceoryx Introspection Client ###\n\n", PrettyOptions::title);
+    if (!snapshotFormat.has_value())
+    {
+        initTerminal();
+        prettyPrint("### Iceoryx Introspection Client ###\n\n", PrettyOptions::title);
+    }
 
 
     // mempool
@@ -680,14 +967,13 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
 #else
     auto memPoolSubscriber = createSubscriber<MemPoolIntrospectionInfoContainer>(IntrospectionMempoolService);
 #endif
-    if (introspectionSelection.mempool == true)
+    if (introspectionSelection.mempool == true || introspectionSelection.performance == true)
     {
         memPoolSubscriber->subscribe();
 
         if (waitForSubscription(memPoolSubscriber) == false)
         {
-            prettyPrint("Timeout while waiting for subscription for mempool introspection data!\n",
-                        PrettyOptions::error);
+            printError("Timeout while waiting for subscription for mempool introspection data!\n");
         }
     }
 
@@ -702,14 +988,13 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
     auto processSubscriber = createSubscriber<ProcessIntrospectionFieldTopic>(IntrospectionProcessService);
 #endif
 
-    if (introspectionSelection.process == true)
+    if (introspectionSelection.process == true || introspectionSelection.performance == true)
     {
         processSubscriber->subscribe();
 
         if (waitForSubscription(processSubscriber) == false)
         {
-            prettyPrint("Timeout while waiting for subscription for process introspection data!\n",
-                        PrettyOptions::error);
+            printError("Timeout while waiting for subscription for process introspection data!\n");
         }
     }
 
@@ -738,7 +1023,7 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
         createSubscriber<SubscriberPortChangingIntrospectionFieldTopic>(IntrospectionSubscriberPortChangingDataService);
 #endif
 
-    if (introspectionSelection.port == true)
+    if (introspectionSelection.port == true || introspectionSelection.performance == true)
     {
         portSubscriber->subscribe();
         portThroughputSubscriber->subscribe();
@@ -746,22 +1031,23 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
 
         if (waitForSubscription(portSubscriber) == false)
         {
-            prettyPrint("Timeout while waiting for subscription for port introspection data!\n", PrettyOptions::error);
+            printError("Timeout while waiting for subscription for port introspection data!\n");
         }
         if (waitForSubscription(portThroughputSubscriber) == false)
         {
-            prettyPrint("Timeout while waiting for subscription for port throughput introspection data!\n",
-                        PrettyOptions::error);
+            printError("Timeout while waiting for subscription for port throughput introspection data!\n");
         }
         if (waitForSubscription(subscriberPortChangingDataSubscriber) == false)
         {
-            prettyPrint("Timeout while waiting for Subscription for Subscriber Port Introspection Changing Data!\n",
-                        PrettyOptions::error);
+            printError("Timeout while waiting for Subscription for Subscriber Port Introspection Changing Data!\n");
         }
     }
 
     // Refresh once in case of timeout messages
-    refreshTerminal();
+    if (!snapshotFormat.has_value())
+    {
+        refreshTerminal();
+    }
 
     optional<popo::Sample<const MemPoolIntrospectionInfoContainer>> memPoolSample;
     optional<popo::Sample<const ProcessIntrospectionFieldTopic>> processSample;
@@ -771,8 +1057,84 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
 
     auto domainIdString = iox::convert::toString(static_cast<DomainId::value_type>(domainId));
 
+    uint64_t numberOfThroughputSamples{0U};
+    const auto snapshotDeadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(SNAPSHOT_TIMEOUT.toMilliseconds());
+
     while (true)
     {
+        // the performance view derives its deltas from consecutive samples, therefore it is only updated with new ones
+        bool hasNewMemPoolSample{false};
+        bool hasNewProcessSample{false};
+        bool hasNewThroughputSample{false};
+        if (introspectionSelection.mempool == true || introspectionSelection.performance == true)
+        {
+            memPoolSubscriber->take().and_then([&](auto& sample) {
+                memPoolSample = std::move(sample);
+                hasNewMemPoolSample = true;
+            });
+        }
+        if (introspectionSelection.process == true || introspectionSelection.performance == true)
+        {
+            processSubscriber->take().and_then([&](auto& sample) {
+                processSample = std::move(sample);
+                hasNewProcessSample = true;
+            });
+        }
+        if (introspectionSelection.port == true || introspectionSelection.performance == true)
+        {
+            portSubscriber->take().and_then([&](auto& sample) { portSample = std::move(sample); });
+
+            portThroughputSubscriber->take().and_then([&](auto& sample) {
+                portThroughputSample = std::move(sample);
+                hasNewThroughputSample = true;
+            });
+
+            subscriberPortChangingDataSubscriber->take().and_then(
+                [&](auto& sample) { subscriberPortChangingDataSamples = std::move(sample); });
+        }
+
+        if (introspectionSelection.performance == true)
+        {
+            if (hasNewThroughputSample && portSample)
+            {
+                performanceView.updatePublishers(*portSample.value().get(),
+                                                 *portThroughputSample.value().get(),
+                                                 std::chrono::steady_clock::now());
+                ++numberOfThroughputSamples;
+            }
+            if (hasNewMemPoolSample)
+            {
+                performanceView.updateMemPools(*memPoolSample.value().get());
+            }
+            if (hasNewProcessSample)
+            {
+                performanceView.updateProcesses(*processSample.value().get());
+            }
+            performanceView.sort(performanceSortKey);
+        }
+
+        if (snapshotFormat.has_value())
+        {
+            constexpr uint64_t NUMBER_OF_THROUGHPUT_SAMPLES_FOR_RATES{2U};
+            if (numberOfThroughputSamples >= NUMBER_OF_THROUGHPUT_SAMPLES_FOR_RATES
+                || std::chrono::steady_clock::now() >= snapshotDeadline)
+            {
+                if (snapshotFormat.value() == SnapshotFormat::JSON)
+                {
+                    performanceView.writeJson(std::cout);
+                }
+                else
+                {
+                    performanceView.writeCsv(std::cout);
+                }
+                std::cout.flush();
+                return;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(WAIT_INTERVAL.toMilliseconds()));
+            continue;
+        }
+
         // get and print time
         auto now = std::chrono::system_clock::now();
         auto in_time_t = std::chrono::system_clock::to_time_t(now);
@@ -793,8 +1155,6 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
         {
             prettyPrint("### MemPool Status ###\n\n", PrettyOptions::highlight);
 
-            memPoolSubscriber->take().and_then([&](auto& sample) { memPoolSample = std::move(sample); });
-
             if (memPoolSample)
             {
                 for (const auto& i : *(memPoolSample.value().get()))
@@ -812,7 +1172,6 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
         if (introspectionSelection.process == true)
         {
             prettyPrint("### Processes ###\n\n", PrettyOptions::highlight);
-            processSubscriber->take().and_then([&](auto& sample) { processSample = std::move(sample); });
 
             if (processSample)
             {
@@ -827,13 +1186,6 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
         // print port information
         if (introspectionSelection.port == true)
         {
-            portSubscriber->take().and_then([&](auto& sample) { portSample = std::move(sample); });
-
-            portThroughputSubscriber->take().and_then([&](auto& sample) { portThroughputSample = std::move(sample); });
-
-            subscriberPortChangingDataSubscriber->take().and_then(
-                [&](auto& sample) { subscriberPortChangingDataSamples = std::move(sample); });
-
             if (portSample && portThroughputSample && subscriberPortChangingDataSamples)
             {
                 prettyPrint("### Connections ###\n\n", PrettyOptions::highlight);
@@ -850,6 +1202,12 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
             }
         }
 
+        // print the performance view
+        if (introspectionSelection.performance == true)
+        {
+            printPerformanceView();
+        }
+
         prettyPrint("\n");
         clearToBottom();
         refreshTerminal();
@@ -0,0 +1,382 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_introspection/performance_view.hpp"
+#include "iox/into.hpp"
+#include "iox/std_string_support.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+namespace iox
+{
+namespace client
+{
+namespace introspection
+{
+namespace
+{
+std::string escapeJson(const std::string& value)
+{
+    std::stringstream stream;
+    for (const auto character : value)
+    {
+        if (character == '"' || character == '\\')
+        {
+            stream << '\\' << character;
+        }
+        else if (static_cast<unsigned char>(character) < 0x20U)
+        {
+            stream << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                   << static_cast<uint32_t>(static_cast<unsigned char>(character)) << std::dec << std::setfill(' ');
+        }
+        else
+        {
+            stream << character;
+        }
+    }
+    return stream.str();
+}
+
+std::string escapeCsv(const std::string& value)
+{
+    if (value.find_first_of(",\"\n") == std::string::npos)
+    {
+        return value;
+    }
+
+    std::string escapedValue{"\""};
+    for (const auto character : value)
+    {
+        if (character == '"')
+        {
+            escapedValue.push_back('"');
+        }
+        escapedValue.push_back(character);
+    }
+    escapedValue.push_back('"');
+    return escapedValue;
+}
+
+/// @brief Writes the value if it is available, otherwise the placeholder for a missing value
+template <typename T>
+void writeIfAvailable(std::ostream& stream, const bool isAvailable, const T value, const char* const missingValue)
+{
+    if (isAvailable)
+    {
+        stream << value;
+    }
+    else
+    {
+        stream << missingValue;
+    }
+}
+} // namespace
+
+const char* asStringLiteral(const PerformanceSortKey value) noexcept
+{
+    switch (value)
+    {
+    case PerformanceSortKey::MESSAGE_RATE:
+        return "rate";
+    case PerformanceSortKey::BANDWIDTH:
+        return "bandwidth";
+    case PerformanceSortKey::DROPS:
+        return "drops";
+    case PerformanceSortKey::MEMPOOL_PRESSURE:
+        return "pressure";
+    case PerformanceSortKey::HEARTBEAT_AGE:
+        return "heartbeat";
+    }
+
+    return "[Undefined PerformanceSortKey]";
+}
+
+void PerformanceView::updatePublishers(const PortIntrospectionFieldTopic& portData,
+                                       const PortThroughputIntrospectionFieldTopic& throughputData,
+                                       const Clock::time_point sampleTime) noexcept
+{
+    const auto hasPreviousSample = !m_previousPublisherCounters.empty();
+    const auto elapsedSeconds = std::chrono::duration<double>(sampleTime - m_previousPublisherSampleTime).count();
+
+    std::map<uint64_t, PublisherCounters> currentCounters;
+    m_publishers.clear();
+    for (const auto& throughput : throughputData.m_throughputList)
+    {
+        PublisherPerformance row;
+        row.publisherPortId = throughput.m_publisherPortID;
+        row.chunksSent = throughput.m_chunksSent;
+        row.bytesSent = throughput.m_bytesSent;
+        row.queueOverflows = throughput.m_queueOverflows;
+
+        for (const auto& publisher : portData.m_publisherList)
+        {
+            if (publisher.m_publisherPortID == throughput.m_publisherPortID)
+            {
+                row.runtimeName = iox::into<std::string>(publisher.m_name);
+                row.service = iox::into<std::string>(publisher.m_caproServiceID);
+                row.instance = iox::into<std::string>(publisher.m_caproInstanceID);
+                row.event = iox::into<std::string>(publisher.m_caproEventMethodID);
+                break;
+            }
+        }
+
+        // the counters of a port only grow, a smaller value belongs to a new port which reuses the ID
+        auto previous = m_previousPublisherCounters.find(row.publisherPortId);
+        if (hasPreviousSample && elapsedSeconds > 0.0 && previous != m_previousPublisherCounters.end()
+            && previous->second.chunksSent <= row.chunksSent && previous->second.bytesSent <= row.bytesSent
+            && previous->second.queueOverflows <= row.queueOverflows)
+        {
+            row.hasDelta = true;
+            row.deltaChunksSent = row.chunksSent - previous->second.chunksSent;
+            row.deltaBytesSent = row.bytesSent - previous->second.bytesSent;
+            row.deltaQueueOverflows = row.queueOverflows - previous->second.queueOverflows;
+            row.chunksPerSecond = static_cast<double>(row.deltaChunksSent) / elapsedSeconds;
+            row.bytesPerSecond = static_cast<double>(row.deltaBytesSent) / elapsedSeconds;
+        }
+
+        currentCounters[row.publisherPortId] = {row.chunksSent, row.bytesSent, row.queueOverflows};
+        m_publishers.push_back(row);
+    }
+
+    m_previousPublisherCounters = std::move(currentCounters);
+    m_previousPublisherSampleTime = sampleTime;
+}
+
+void PerformanceView::updateMemPools(const MemPoolIntrospectionInfoContainer& memPoolData) noexcept
+{
+    std::map<std::pair<uint32_t, uint32_t>, MemPoolCounters> currentCounters;
+    m_memPools.clear();
+    for (const auto& segment : memPoolData)
+    {
+        for (uint32_t index = 0U; index < segment.m_mempoolInfo.size(); ++index)
+        {
+            const auto& info = segment.m_mempoolInfo[index];
+            if (info.m_numChunks == 0U)
+            {
+                continue;
+            }
+
+            MemPoolPerformance row;
+            row.segmentId = segment.m_id;
+            row.memPoolNumber = index + 1U;
+            row.chunkSize = info.m_chunkSize;
+            row.usedChunks = info.m_usedChunks;
+            row.numChunks = info.m_numChunks;
+            row.pressure = static_cast<double>(info.m_usedChunks) / static_cast<double>(info.m_numChunks);
+            row.failedAllocations = info.m_numberOfFailedAllocations;
+
+            const auto key = std::make_pair(row.segmentId, row.memPoolNumber);
+            auto previous = m_previousMemPoolCounters.find(key);
+            if (previous != m_previousMemPoolCounters.end()
+                && previous->second.failedAllocations <= row.failedAllocations)
+            {
+                row.hasDelta = true;
+                row.deltaUsedChunks =
+                    static_cast<int64_t>(row.usedChunks) - static_cast<int64_t>(previous->second.usedChunks);
+                row.deltaFailedAllocations = row.failedAllocations - previous->second.failedAllocations;
+            }
+
+            currentCounters[key] = {row.usedChunks, row.failedAllocations};
+            m_memPools.push_back(row);
+        }
+    }
+
+    m_previousMemPoolCounters = std::move(currentCounters);
+}
+
+void PerformanceView::updateProcesses(const ProcessIntrospectionFieldTopic& processData) noexcept
+{
+    m_processes.clear();
+    for (const auto& process : processData.m_processList)
+    {
+        ProcessPerformance row;
+        row.pid = process.m_pid;
+        row.runtimeName = iox::into<std::string>(process.m_name);
+        row.isMonitored = process.m_isMonitored;
+        row.heartbeatAgeInMilliseconds = process.m_heartbeatAgeInMilliseconds;
+        m_processes.push_back(row);
+    }
+}
+
+void PerformanceView::sort(const PerformanceSortKey sortKey) noexcept
+{
+    // rows without deltas, e.g. of new publishers, are listed after the rows with deltas and are sorted by their
+    // totals; rates and totals must not be compared with each other, otherwise the order would not be strict weak
+    std::stable_sort(m_publishers.begin(),
+                     m_publishers.end(),
+                     [sortKey](const PublisherPerformance& lhs, const PublisherPerformance& rhs) {
+                         if (lhs.hasDelta != rhs.hasDelta)
+                         {
+                             return lhs.hasDelta;
+                         }
+                         const bool hasDeltas = lhs.hasDelta;
+                         switch (sortKey)
+                         {
+                         case PerformanceSortKey::BANDWIDTH:
+                             return hasDeltas ? lhs.bytesPerSecond > rhs.bytesPerSecond
+                                              : lhs.bytesSent > rhs.bytesSent;
+                         case PerformanceSortKey::DROPS:
+                             return hasDeltas ? lhs.deltaQueueOverflows > rhs.deltaQueueOverflows
+                                              : lhs.queueOverflows > rhs.queueOverflows;
+                         default:
+                             return hasDeltas ? lhs.chunksPerSecond > rhs.chunksPerSecond
+                                              : lhs.chunksSent > rhs.chunksSent;
+                         }
+                     });
+
+    std::stable_sort(
+        m_memPools.begin(), m_memPools.end(), [](const MemPoolPerformance& lhs, const MemPoolPerformance& rhs) {
+            return lhs.pressure > rhs.pressure;
+        });
+
+    // unmonitored processes have no heartbeat age and are listed last
+    std::stable_sort(
+        m_processes.begin(), m_processes.end(), [](const ProcessPerformance& lhs, const ProcessPerformance& rhs) {
+            if (lhs.isMonitored != rhs.isMonitored)
+            {
+                return lhs.isMonitored;
+            }
+            return lhs.heartbeatAgeInMilliseconds > rhs.heartbeatAgeInMilliseconds;
+        });
+}
+
+bool PerformanceView::hasPublisherDeltas() const noexcept
+{
+    return std::any_of(
+        m_publishers.begin(), m_publishers.end(), [](const PublisherPerformance& row) { return row.hasDelta; });
+}
+
+const std::vector<PublisherPerformance>& PerformanceView::publishers() const noexcept
+{
+    return m_publishers;
+}
+
+const std::vector<MemPoolPerformance>& PerformanceView::memPools() const noexcept
+{
+    return m_memPools;
+}
+
+const std::vector<ProcessPerformance>& PerformanceView::processes() const noexcept
+{
+    return m_processes;
+}
+
+void PerformanceView::writeJson(std::ostream& stream) const noexcept
+{
+    constexpr const char* MISSING_VALUE{"null"};
+
+    stream << std::fixed << std::setprecision(3) << "{\"publishers\":[";
+    bool isFirstRow{true};
+    for (const auto& row : m_publishers)
+    {
+        stream << (isFirstRow ? "\n" : ",\n") << "{\"portId\":" << row.publisherPortId << ",\"process\":\""
+               << escapeJson(row.runtimeName) << "\",\"service\":\"" << escapeJson(row.service)
+               << "\",\"instance\":\"" << escapeJson(row.instance) << "\",\"event\":\"" << escapeJson(row.event)
+               << "\",\"chunksSent\":" << row.chunksSent << ",\"bytesSent\":" << row.bytesSent
+               << ",\"queueOverflows\":" << row.queueOverflows << ",\"deltaChunksSent\":";
+        writeIfAvailable(stream, row.hasDelta, row.deltaChunksSent, MISSING_VALUE);
+        stream << ",\"deltaBytesSent\":";
+        writeIfAvailable(stream, row.hasDelta, row.deltaBytesSent, MISSING_VALUE);
+        stream << ",\"deltaQueueOverflows\":";
+        writeIfAvailable(stream, row.hasDelta, row.deltaQueueOverflows, MISSING_VALUE);
+        stream << ",\"chunksPerSecond\":";
+        writeIfAvailable(stream, row.hasDelta, row.chunksPerSecond, MISSING_VALUE);
+        stream << ",\"bytesPerSecond\":";
+        writeIfAvailable(stream, row.hasDelta, row.bytesPerSecond, MISSING_VALUE);
+        stream << "}";
+        isFirstRow = false;
+    }
+
+    stream << "\n],\"mempools\":[";
+    isFirstRow = true;
+    for (const auto& row : m_memPools)
+    {
+        stream << (isFirstRow ? "\n" : ",\n") << "{\"segmentId\":" << row.segmentId
+               << ",\"mempool\":" << row.memPoolNumber << ",\"chunkSize\":" << row.chunkSize
+               << ",\"usedChunks\":" << row.usedChunks << ",\"numChunks\":" << row.numChunks
+               << ",\"pressure\":" << row.pressure << ",\"failedAllocations\":" << row.failedAllocations
+               << ",\"deltaUsedChunks\":";
+        writeIfAvailable(stream, row.hasDelta, row.deltaUsedChunks, MISSING_VALUE);
+        stream << ",\"deltaFailedAllocations\":";
+        writeIfAvailable(stream, row.hasDelta, row.deltaFailedAllocations, MISSING_VALUE);
+        stream << "}";
+        isFirstRow = false;
+    }
+
+    stream << "\n],\"processes\":[";
+    isFirstRow = true;
+    for (const auto& row : m_processes)
+    {
+        stream << (isFirstRow ? "\n" : ",\n") << "{\"pid\":" << row.pid << ",\"process\":\""
+               << escapeJson(row.runtimeName) << "\",\"heartbeatAgeMs\":";
+        writeIfAvailable(stream, row.isMonitored, row.heartbeatAgeInMilliseconds, MISSING_VALUE);
+        stream << "}";
+        isFirstRow = false;
+    }
+    stream << "\n]}\n";
+}
+
+void PerformanceView::writeCsv(std::ostream& stream) const noexcept
+{
+    constexpr const char* MISSING_VALUE{""};
+
+    stream << std::fixed << std::setprecision(3);
+    stream << "table,portId,process,service,instance,event,chunksSent,bytesSent,queueOverflows,deltaChunksSent,"
+              "deltaBytesSent,deltaQueueOverflows,chunksPerSecond,bytesPerSecond\n";
+    for (const auto& row : m_publishers)
+    {
+        stream << "publisher," << row.publisherPortId << ',' << escapeCsv(row.runtimeName) << ','
+               << escapeCsv(row.service) << ',' << escapeCsv(row.instance) << ',' << escapeCsv(row.event) << ','
+               << row.chunksSent << ',' << row.bytesSent << ',' << row.queueOverflows << ',';
+        writeIfAvailable(stream, row.hasDelta, row.deltaChunksSent, MISSING_VALUE);
+        stream << ',';
+        writeIfAvailable(stream, row.hasDelta, row.deltaBytesSent, MISSING_VALUE);
+        stream << ',';
+        writeIfAvailable(stream, row.hasDelta, row.deltaQueueOverflows, MISSING_VALUE);
+        stream << ',';
+        writeIfAvailable(stream, row.hasDelta, row.chunksPerSecond, MISSING_VALUE);
+        stream << ',';
+        writeIfAvailable(stream, row.hasDelta, row.bytesPerSecond, MISSING_VALUE);
+        stream << '\n';
+    }
+
+    stream << "table,segmentId,mempool,chunkSize,usedChunks,numChunks,pressure,failedAllocations,deltaUsedChunks,"
+              "deltaFailedAllocations\n";
+    for (const auto& row : m_memPools)
+    {
+        stream << "mempool," << row.segmentId << ',' << row.memPoolNumber << ',' << row.chunkSize << ','
+               << row.usedChunks << ',' << row.numChunks << ',' << row.pressure << ',' << row.failedAllocations
+               << ',';
+        writeIfAvailable(stream, row.hasDelta, row.deltaUsedChunks, MISSING_VALUE);
+        stream << ',';
+        writeIfAvailable(stream, row.hasDelta, row.deltaFailedAllocations, MISSING_VALUE);
+        stream << '\n';
+    }
+
+    stream << "table,pid,process,heartbeatAgeMs\n";
+    for (const auto& row : m_processes)
+    {
+        stream << "process," << row.pid << ',' << escapeCsv(row.runtimeName) << ',';
+        writeIfAvailable(stream, row.isMonitored, row.heartbeatAgeInMilliseconds, MISSING_VALUE);
+        stream << '\n';
+    }
+}
+
+} // namespace introspection
+} // namespace client
+} // namespace iox
@@ -0,0 +1,347 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/testing/test.hpp"
+#include "iceoryx_introspection/performance_view.hpp"
+
+#include <sstream>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::client::introspection;
+
+class PerformanceView_test : public Test
+{
+  public:
+    using Clock = PerformanceView::Clock;
+
+    void addPublisher(const uint64_t portId, const char* const runtimeName, const char* const instance = "Instance")
+    {
+        PublisherPortData publisher;
+        publisher.m_publisherPortID = portId;
+        publisher.m_name = iox::RuntimeName_t(iox::TruncateToCapacity, runtimeName);
+        publisher.m_caproServiceID = "Service";
+        publisher.m_caproInstanceID = iox::capro::IdString_t(iox::TruncateToCapacity, instance);
+        publisher.m_caproEventMethodID = "Event";
+        m_portData.m_publisherList.emplace_back(publisher);
+    }
+
+    void setThroughput(const uint64_t portId,
+                       const uint64_t chunksSent,
+                       const uint64_t bytesSent,
+                       const uint64_t queueOverflows)
+    {
+        for (auto& throughput : m_throughputData.m_throughputList)
+        {
+            if (throughput.m_publisherPortID == portId)
+            {
+                throughput.m_chunksSent = chunksSent;
+                throughput.m_bytesSent = bytesSent;
+                throughput.m_queueOverflows = queueOverflows;
+                return;
+            }
+        }
+
+        PortThroughputData throughput;
+        throughput.m_publisherPortID = portId;
+        throughput.m_chunksSent = chunksSent;
+        throughput.m_bytesSent = bytesSent;
+        throughput.m_queueOverflows = queueOverflows;
+        m_throughputData.m_throughputList.emplace_back(throughput);
+    }
+
+    void updatePublishers(const std::chrono::milliseconds timeSinceStart)
+    {
+        sut.updatePublishers(m_portData, m_throughputData, m_startTime + timeSinceStart);
+    }
+
+    static MemPoolInfo memPoolInfo(const uint32_t usedChunks, const uint32_t numChunks, const uint64_t failed)
+    {
+        MemPoolInfo info;
+        info.m_usedChunks = usedChunks;
+        info.m_numChunks = numChunks;
+        info.m_chunkSize = 128U;
+        info.m_numberOfFailedAllocations = failed;
+        return info;
+    }
+
+    static ProcessIntrospectionData
+    processData(const int pid, const char* const name, const bool isMonitored, const uint64_t age)
+    {
+        ProcessIntrospectionData process;
+        process.m_pid = pid;
+        process.m_name = iox::RuntimeName_t(iox::TruncateToCapacity, name);
+        process.m_isMonitored = isMonitored;
+        process.m_heartbeatAgeInMilliseconds = age;
+        return process;
+    }
+
+    std::vector<uint64_t> publisherPortIds() const
+    {
+        std::vector<uint64_t> portIds;
+        for (const auto& publisher : sut.publishers())
+        {
+            portIds.push_back(publisher.publisherPortId);
+        }
+        return portIds;
+    }
+
+    PortIntrospectionFieldTopic m_portData;
+    PortThroughputIntrospectionFieldTopic m_throughputData;
+    const Clock::time_point m_startTime{Clock::now()};
+    PerformanceView sut;
+};
+
+TEST_F(PerformanceView_test, FirstPublisherSampleHasNoDeltas)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7efb3535-376d-4bae-8c12-b54d9bdade70");
+    addPublisher(1U, "radar");
+    setThroughput(1U, 10U, 1000U, 2U);
+
+    updatePublishers(std::chrono::milliseconds(0));
+
+    ASSERT_THAT(sut.publishers().size(), Eq(1U));
+    const auto& publisher = sut.publishers()[0];
+    EXPECT_FALSE(publisher.hasDelta);
+    EXPECT_FALSE(sut.hasPublisherDeltas());
+    EXPECT_THAT(publisher.runtimeName, Eq("radar"));
+    EXPECT_THAT(publisher.service, Eq("Service"));
+    EXPECT_THAT(publisher.chunksSent, Eq(10U));
+    EXPECT_THAT(publisher.bytesSent, Eq(1000U));
+    EXPECT_THAT(publisher.queueOverflows, Eq(2U));
+}
+
+TEST_F(PerformanceView_test, SecondPublisherSampleProvidesDeltasAndRates)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "03221080-888b-4672-ba51-23e322a1930b");
+    addPublisher(1U, "radar");
+    setThroughput(1U, 10U, 1000U, 2U);
+    updatePublishers(std::chrono::milliseconds(0));
+
+    setThroughput(1U, 30U, 5000U, 5U);
+    updatePublishers(std::chrono::milliseconds(2000));
+
+    ASSERT_THAT(sut.publishers().size(), Eq(1U));
+    const auto& publisher = sut.publishers()[0];
+    EXPECT_TRUE(publisher.hasDelta);
+    EXPECT_TRUE(sut.hasPublisherDeltas());
+    EXPECT_THAT(publisher.deltaChunksSent, Eq(20U));
+    EXPECT_THAT(publisher.deltaBytesSent, Eq(4000U));
+    EXPECT_THAT(publisher.deltaQueueOverflows, Eq(3U));
+    EXPECT_THAT(publisher.chunksPerSecond, DoubleEq(10.0));
+    EXPECT_THAT(publisher.bytesPerSecond, DoubleEq(2000.0));
+}
+
+TEST_F(PerformanceView_test, SmallerCounterOfAReusedPortIdHasNoDelta)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4ab940ed-9e3a-4f5b-b195-f83fd91861ca");
+    addPublisher(1U, "radar");
+    setThroughput(1U, 100U, 1000U, 0U);
+    updatePublishers(std::chrono::milliseconds(0));
+
+    setThroughput(1U, 5U, 50U, 0U);
+    updatePublishers(std::chrono::milliseconds(1000));
+
+    ASSERT_THAT(sut.publishers().size(), Eq(1U));
+    EXPECT_FALSE(sut.publishers()[0].hasDelta);
+
+    setThroughput(1U, 15U, 150U, 0U);
+    updatePublishers(std::chrono::milliseconds(2000));
+
+    ASSERT_THAT(sut.publishers().size(), Eq(1U));
+    EXPECT_TRUE(sut.publishers()[0].hasDelta);
+    EXPECT_THAT(sut.publishers()[0].deltaChunksSent, Eq(10U));
+}
+
+TEST_F(PerformanceView_test, PublisherWhichAppearedInTheLatestSampleHasNoDelta)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b090f899-0c84-4fc7-9502-f82c860ede88");
+    addPublisher(1U, "radar");
+    setThroughput(1U, 10U, 100U, 0U);
+    updatePublishers(std::chrono::milliseconds(0));
+
+    addPublisher(2U, "lidar");
+    setThroughput(1U, 20U, 200U, 0U);
+    setThroughput(2U, 50U, 500U, 0U);
+    updatePublishers(std::chrono::milliseconds(1000));
+
+    ASSERT_THAT(sut.publishers().size(), Eq(2U));
+    EXPECT_TRUE(sut.publishers()[0].hasDelta);
+    EXPECT_FALSE(sut.publishers()[1].hasDelta);
+}
+
+TEST_F(PerformanceView_test, SortByMessageRateListsPublishersWithoutDeltasLastSortedByTheirTotals)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "39d36747-1d32-4c6a-8af6-84bd96e1c68f");
+    // A has the higher rate but the smaller total than B; C has no delta and a total between them
+    addPublisher(1U, "A");
+    addPublisher(2U, "B");
+    setThroughput(1U, 0U, 0U, 0U);
+    setThroughput(2U, 99U, 0U, 0U);
+    updatePublishers(std::chrono::milliseconds(0));
+
+    addPublisher(3U, "C");
+    addPublisher(4U, "D");
+    setThroughput(1U, 10U, 0U, 0U);
+    setThroughput(2U, 100U, 0U, 0U);
+    setThroughput(3U, 50U, 0U, 0U);
+    setThroughput(4U, 70U, 0U, 0U);
+    updatePublishers(std::chrono::milliseconds(1000));
+
+    sut.sort(PerformanceSortKey::MESSAGE_RATE);
+
+    EXPECT_THAT(publisherPortIds(), ElementsAre(1U, 2U, 4U, 3U));
+}
+
+TEST_F(PerformanceView_test, SortByBandwidthOrdersPublishersByTheBytesPerSecond)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2b8dede8-b461-4b09-b383-e2317eaee2f8");
+    addPublisher(1U, "A");
+    addPublisher(2U, "B");
+    addPublisher(3U, "C");
+    setThroughput(1U, 0U, 0U, 0U);
+    setThroughput(2U, 0U, 0U, 0U);
+    setThroughput(3U, 0U, 0U, 0U);
+    updatePublishers(std::chrono::milliseconds(0));
+
+    setThroughput(1U, 100U, 100U, 0U);
+    setThroughput(2U, 1U, 10000U, 0U);
+    setThroughput(3U, 10U, 1000U, 0U);
+    updatePublishers(std::chrono::milliseconds(1000));
+
+    sut.sort(PerformanceSortKey::BANDWIDTH);
+    EXPECT_THAT(publisherPortIds(), ElementsAre(2U, 3U, 1U));
+
+    sut.sort(PerformanceSortKey::MESSAGE_RATE);
+    EXPECT_THAT(publisherPortIds(), ElementsAre(1U, 3U, 2U));
+}
+
+TEST_F(PerformanceView_test, SortByDropsOrdersPublishersByTheNewQueueOverflows)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9c4714af-cda7-498d-907b-4c4a07d3f90a");
+    addPublisher(1U, "A");
+    addPublisher(2U, "B");
+    setThroughput(1U, 0U, 0U, 100U);
+    setThroughput(2U, 0U, 0U, 0U);
+    updatePublishers(std::chrono::milliseconds(0));
+
+    setThroughput(1U, 0U, 0U, 101U);
+    setThroughput(2U, 0U, 0U, 5U);
+    updatePublishers(std::chrono::milliseconds(1000));
+
+    sut.sort(PerformanceSortKey::DROPS);
+
+    EXPECT_THAT(publisherPortIds(), ElementsAre(2U, 1U));
+}
+
+TEST_F(PerformanceView_test, MemPoolsProvidePressureAndDeltasAndSkipUnusedMemPools)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "09b0921a-766f-4f3f-847e-030668f45c81");
+    MemPoolIntrospectionInfoContainer memPoolData;
+    memPoolData.emplace_back();
+    memPoolData[0].m_id = 1U;
+    memPoolData[0].m_mempoolInfo.emplace_back(memPoolInfo(2U, 10U, 0U));
+    memPoolData[0].m_mempoolInfo.emplace_back(memPoolInfo(0U, 0U, 0U));
+    memPoolData[0].m_mempoolInfo.emplace_back(memPoolInfo(9U, 10U, 1U));
+
+    sut.updateMemPools(memPoolData);
+
+    ASSERT_THAT(sut.memPools().size(), Eq(2U));
+    EXPECT_FALSE(sut.memPools()[0].hasDelta);
+
+    memPoolData[0].m_mempoolInfo[0] = memPoolInfo(1U, 10U, 0U);
+    memPoolData[0].m_mempoolInfo[2] = memPoolInfo(10U, 10U, 4U);
+    sut.updateMemPools(memPoolData);
+    sut.sort(PerformanceSortKey::MEMPOOL_PRESSURE);
+
+    ASSERT_THAT(sut.memPools().size(), Eq(2U));
+    const auto& fullMemPool = sut.memPools()[0];
+    EXPECT_THAT(fullMemPool.segmentId, Eq(1U));
+    EXPECT_THAT(fullMemPool.memPoolNumber, Eq(3U));
+    EXPECT_THAT(fullMemPool.pressure, DoubleEq(1.0));
+    EXPECT_TRUE(fullMemPool.hasDelta);
+    EXPECT_THAT(fullMemPool.deltaUsedChunks, Eq(1));
+    EXPECT_THAT(fullMemPool.deltaFailedAllocations, Eq(3U));
+
+    const auto& emptierMemPool = sut.memPools()[1];
+    EXPECT_THAT(emptierMemPool.memPoolNumber, Eq(1U));
+    EXPECT_THAT(emptierMemPool.deltaUsedChunks, Eq(-1));
+}
+
+TEST_F(PerformanceView_test, SortByHeartbeatAgeListsUnmonitoredProcessesLast)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9a4ee08f-4af8-4baa-a2ae-36e50838db0e");
+    ProcessIntrospectionFieldTopic processes;
+    processes.m_processList.emplace_back(processData(1, "unmonitored", false, 0U));
+    processes.m_processList.emplace_back(processData(2, "fresh", true, 10U));
+    processes.m_processList.emplace_back(processData(3, "stale", true, 900U));
+
+    sut.updateProcesses(processes);
+    sut.sort(PerformanceSortKey::HEARTBEAT_AGE);
+
+    ASSERT_THAT(sut.processes().size(), Eq(3U));
+    EXPECT_THAT(sut.processes()[0].pid, Eq(3));
+    EXPECT_THAT(sut.processes()[1].pid, Eq(2));
+    EXPECT_THAT(sut.processes()[2].pid, Eq(1));
+    EXPECT_THAT(sut.processes()[2].runtimeName, Eq("unmonitored"));
+}
+
+TEST_F(PerformanceView_test, JsonEscapesStringsAndWritesMissingValuesAsNull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0bfe7ce8-b939-43c9-8fd9-4c5b0a18fb1e");
+    addPublisher(1U, "app\"with\\quotes", "tab\there");
+    setThroughput(1U, 10U, 100U, 0U);
+    updatePublishers(std::chrono::milliseconds(0));
+    ProcessIntrospectionFieldTopic processes;
+    processes.m_processList.emplace_back(processData(7, "unmonitored", false, 0U));
+    sut.updateProcesses(processes);
+
+    std::stringstream stream;
+    sut.writeJson(stream);
+    const auto json = stream.str();
+
+    EXPECT_THAT(json, HasSubstr(R"("process":"app\"with\\quotes")"));
+    EXPECT_THAT(json, HasSubstr(R"("instance":"tab\u0009here")"));
+    EXPECT_THAT(json, HasSubstr(R"("deltaChunksSent":null)"));
+    EXPECT_THAT(json, HasSubstr(R"("chunksPerSecond":null)"));
+    EXPECT_THAT(json, HasSubstr(R"({"pid":7,"process":"unmonitored","heartbeatAgeMs":null})"));
+}
+
+TEST_F(PerformanceView_test, CsvQuotesFieldsWithSeparatorsAndLeavesMissingValuesEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "eacc00a2-0946-4d88-9442-7072430b96e1");
+    addPublisher(1U, "app\"1", "front,left");
+    setThroughput(1U, 10U, 100U, 2U);
+    updatePublishers(std::chrono::milliseconds(0));
+
+    std::stringstream stream;
+    sut.writeCsv(stream);
+
+    EXPECT_THAT(stream.str(), HasSubstr("publisher,1,\"app\"\"1\",Service,\"front,left\",Event,10,100,2,,,,,\n"));
+}
+
+TEST_F(PerformanceView_test, SortKeysAreConvertedToTheirCommandLineNames)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2b5ef299-4bfe-449a-ac5f-53301d7fef18");
+    EXPECT_THAT(asStringLiteral(PerformanceSortKey::MESSAGE_RATE), StrEq("rate"));
+    EXPECT_THAT(asStringLiteral(PerformanceSortKey::BANDWIDTH), StrEq("bandwidth"));
+    EXPECT_THAT(asStringLiteral(PerformanceSortKey::DROPS), StrEq("drops"));
+    EXPECT_THAT(asStringLiteral(PerformanceSortKey::MEMPOOL_PRESSURE), StrEq("pressure"));
+    EXPECT_THAT(asStringLiteral(PerformanceSortKey::HEARTBEAT_AGE), StrEq("heartbeat"));
+}
+
+} // namespace